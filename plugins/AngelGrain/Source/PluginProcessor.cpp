@@ -1,79 +1,13 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
-juce::AudioProcessorValueTreeState::ParameterLayout AngelGrainAudioProcessor::createParameterLayout()
-{
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    // delayTime - Float (50-2000ms, default 500, skew 0.5)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "delayTime", 1 },
-        "Delay Time",
-        juce::NormalisableRange<float>(50.0f, 2000.0f, 0.1f, 0.5f),
-        500.0f,
-        "ms"
-    ));
-
-    // grainSize - Float (5-500ms, default 100, skew 0.5)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "grainSize", 1 },
-        "Grain Size",
-        juce::NormalisableRange<float>(5.0f, 500.0f, 0.1f, 0.5f),
-        100.0f,
-        "ms"
-    ));
-
-    // feedback - Float (0-100%, default 30, skew 1.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "feedback", 1 },
-        "Feedback",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        30.0f,
-        "%"
-    ));
-
-    // chaos - Float (0-100%, default 25, skew 1.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "chaos", 1 },
-        "Chaos",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        25.0f,
-        "%"
-    ));
-
-    // character - Float (0-100%, default 50, skew 1.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "character", 1 },
-        "Character",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        50.0f,
-        "%"
-    ));
-
-    // mix - Float (0-100%, default 50, skew 1.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "mix", 1 },
-        "Mix",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        50.0f,
-        "%"
-    ));
-
-    // tempoSync - Bool (default true)
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        juce::ParameterID { "tempoSync", 1 },
-        "Tempo Sync",
-        true
-    ));
-
-    return layout;
-}
+static_assert(pfs::hasUniqueIds(AngelGrainAudioProcessor::kParamSpecs), "duplicate parameter ID");
 
 AngelGrainAudioProcessor::AngelGrainAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withInput("Input", juce::AudioChannelSet::stereo(), true)
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , parameters(*this, nullptr, "Parameters", createParameterLayout())
+    , parameters(*this, nullptr, "Parameters", pfs::createParameterLayout(kParamSpecs))
 {
 }
 
@@ -84,6 +18,7 @@ AngelGrainAudioProcessor::~AngelGrainAudioProcessor()
 void AngelGrainAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate = sampleRate;
+    params.prepare(sampleRate);
 
     // Setup DSP spec for stereo
     spec.sampleRate = sampleRate;
@@ -125,8 +60,7 @@ void AngelGrainAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBl
     feedbackSampleR = 0.0f;
 
     // Calculate initial grain interval from delayTime parameter
-    auto* delayTimeParam = parameters.getRawParameterValue("delayTime");
-    float delayTimeMs = delayTimeParam->load();
+    float delayTimeMs = params.get(kDelayTime);
     nextGrainInterval = static_cast<int>((delayTimeMs / 1000.0f) * sampleRate);
 
     // Pre-allocate stereo buffers for real-time safety
@@ -152,20 +86,17 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
         dryBuffer.setSize(2, numSamples, false, false, true);
     }
 
-    // Read parameters atomically
-    auto* delayTimeParam = parameters.getRawParameterValue("delayTime");
-    auto* mixParam = parameters.getRawParameterValue("mix");
-    auto* feedbackParam = parameters.getRawParameterValue("feedback");
-    auto* characterParam = parameters.getRawParameterValue("character");
-    auto* chaosParam = parameters.getRawParameterValue("chaos");
-    auto* tempoSyncParam = parameters.getRawParameterValue("tempoSync");
-
-    float delayTimeMs = delayTimeParam->load();
-    float mixValue = mixParam->load() / 100.0f;
-    float feedbackGain = (feedbackParam->load() / 100.0f) * 0.95f;  // Map 0-100% to 0-0.95
-    float characterAmount = characterParam->load() / 100.0f;
-    float chaosAmount = chaosParam->load() / 100.0f;
-    bool tempoSyncEnabled = tempoSyncParam->load() > 0.5f;
+    // Read parameters (cached atomics)
+    float delayTimeMs = params.get(kDelayTime);
+    float characterAmount = params.get(kCharacter) / 100.0f;
+    float chaosAmount = params.get(kChaos) / 100.0f;
+    bool tempoSyncEnabled = params.getBool(kTempoSync);
+
+    // Feedback and mix are applied per sample, so they glide over 20 ms
+    const auto feedbackRamp = params.getRamp(kFeedback, numSamples);
+    const auto mixRamp = params.getRamp(kMix, numSamples);
+    const float feedbackGainStart = (feedbackRamp.start / 100.0f) * 0.95f;  // Map 0-100% to 0-0.95
+    const float feedbackGainStep = (feedbackRamp.getStep() / 100.0f) * 0.95f;
 
     // Tempo sync: quantize delay time to note divisions
     if (tempoSyncEnabled)
@@ -287,6 +218,7 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
         }
 
         // Apply feedback gain and soft saturation (stereo)
+        const float feedbackGain = feedbackGainStart + feedbackGainStep * static_cast<float>(sample);
         float feedbackL = leftOutput * feedbackGain;
         float feedbackR = rightOutput * feedbackGain;
 
@@ -306,11 +238,14 @@ void AngelGrainAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, ju
 
     // Linear dry/wet mix (full dry + scaled wet for 0-100%)
     // At 0%: dry only, At 100%: wet only, At 50%: full dry + full wet
-    float dryGain = 1.0f - mixValue;  // 1.0 at 0%, 0.0 at 100%
-    float wetGain = mixValue;          // 0.0 at 0%, 1.0 at 100%
+    const float mixStart = mixRamp.start / 100.0f;
+    const float mixStep = mixRamp.getStep() / 100.0f;
 
     for (int i = 0; i < numSamples; ++i)
     {
+        float wetGain = mixStart + mixStep * static_cast<float>(i);  // 0.0 at 0%, 1.0 at 100%
+        float dryGain = 1.0f - wetGain;                               // 1.0 at 0%, 0.0 at 100%
+
         float dryL = dryBuffer.getSample(0, i);
         float dryR = dryBuffer.getSample(1, i);
         float wetL = wetBuffer.getSample(0, i);
@@ -351,13 +286,9 @@ void AngelGrainAudioProcessor::spawnGrain()
     auto& voice = grainVoices[static_cast<size_t>(voiceIndex)];
 
     // Read parameters
-    auto* grainSizeParam = parameters.getRawParameterValue("grainSize");
-    auto* delayTimeParam = parameters.getRawParameterValue("delayTime");
-    auto* chaosParam = parameters.getRawParameterValue("chaos");
-
-    float grainSizeMs = grainSizeParam->load();
-    float delayTimeMs = delayTimeParam->load();
-    float chaosAmount = chaosParam->load() / 100.0f;  // Normalize to 0.0-1.0
+    float grainSizeMs = params.get(kGrainSize);
+    float delayTimeMs = params.get(kDelayTime);
+    float chaosAmount = params.get(kChaos) / 100.0f;  // Normalize to 0.0-1.0
 
     // Calculate grain length in samples
     voice.grainLengthSamples = static_cast<int>((grainSizeMs / 1000.0f) * currentSampleRate);
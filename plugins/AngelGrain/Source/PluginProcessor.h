@@ -1,6 +1,8 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Parameters.h>
+#include <pfs/RandomSeed.h>
 
 // Grain voice structure for polyphonic grain management
 struct GrainVoice
@@ -42,10 +44,25 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // Parameter table: builds the layout and the cached atomic pointers below
+    enum Param { kDelayTime, kGrainSize, kFeedback, kChaos, kCharacter, kMix, kTempoSync, kNumParams };
+
+    static constexpr std::array<pfs::ParamSpec, kNumParams> kParamSpecs {{
+        pfs::floatParam("delayTime", "Delay Time", 50.0f, 2000.0f, 0.1f, 0.5f, 500.0f, "ms"),
+        pfs::floatParam("grainSize", "Grain Size", 5.0f, 500.0f, 0.1f, 0.5f, 100.0f, "ms"),
+        // feedback and mix glide over 20 ms (applied per sample)
+        pfs::floatParam("feedback", "Feedback", 0.0f, 100.0f, 0.1f, 1.0f, 30.0f, "%", 0.02f),
+        pfs::floatParam("chaos", "Chaos", 0.0f, 100.0f, 0.1f, 1.0f, 25.0f, "%"),
+        pfs::floatParam("character", "Character", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f, "%"),
+        pfs::floatParam("mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f, "%", 0.02f),
+        pfs::boolParam("tempoSync", "Tempo Sync", true),
+    }};
+
     juce::AudioProcessorValueTreeState parameters;
 
 private:
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    // Resolved once from kParamSpecs (spawnGrain() reads them per grain)
+    pfs::ParameterSet<Param, kNumParams> params { parameters, kParamSpecs };
 
     // DSP Components
     juce::dsp::ProcessSpec spec;
@@ -69,8 +86,8 @@ private:
 
     // Note: Using manual linear dry/wet mixing for intuitive 50% behavior
 
-    // Random number generator
-    juce::Random random;
+    // Random number generator (fixed seed under the golden-render harness)
+    juce::Random random { pfs::nextRandomSeed() };
 
     // Current sample rate for calculations
     double currentSampleRate = 44100.0;
@@ -1,31 +1,7 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
-//==============================================================================
-// Parameter Layout (BEFORE constructor)
-//==============================================================================
-juce::AudioProcessorValueTreeState::ParameterLayout AutoClipAudioProcessor::createParameterLayout()
-{
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    // clipThreshold - Float (0-100%, linear)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "clipThreshold", 1 },
-        "Clip Threshold",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f, 1.0f),  // min, max, step, skew
-        0.0f,
-        "%"
-    ));
-
-    // soloClipped - Bool (default: false)
-    layout.add(std::make_unique<juce::AudioParameterBool>(
-        juce::ParameterID { "soloClipped", 1 },
-        "Clip Solo",
-        false
-    ));
-
-    return layout;
-}
+static_assert(pfs::hasUniqueIds(AutoClipAudioProcessor::kParamSpecs), "duplicate parameter ID");
 
 //==============================================================================
 // Constructor
@@ -34,7 +10,7 @@ AutoClipAudioProcessor::AutoClipAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withInput("Input", juce::AudioChannelSet::stereo(), true)
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , parameters(*this, nullptr, "Parameters", createParameterLayout())
+    , parameters(*this, nullptr, "Parameters", pfs::createParameterLayout(kParamSpecs))
 {
 }
 
@@ -65,6 +41,8 @@ void AutoClipAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
     smoothedGain.reset(sampleRate, 0.05);  // 50ms smoothing
     smoothedGain.setCurrentAndTargetValue(1.0f);  // Default gain = 1.0
 
+    params.prepare(sampleRate);
+
     // Phase 4.3: Preallocate original buffer for clip solo
     originalBuffer.setSize(getTotalNumOutputChannels(), samplesPerBlock);
     originalBuffer.clear();
@@ -81,15 +59,14 @@ void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
     juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
 
-    // Read parameters (atomic, real-time safe)
-    auto* clipThresholdParam = parameters.getRawParameterValue("clipThreshold");
-    float clipThresholdPercent = clipThresholdParam->load();
-    float clipThreshold = clipThresholdPercent * 0.01f;  // Convert 0-100% to 0.0-1.0
+    const int numSamples = buffer.getNumSamples();
 
-    auto* soloClippedParam = parameters.getRawParameterValue("soloClipped");
-    bool soloClipped = soloClippedParam->load() > 0.5f;
+    // Read parameters (cached atomics; threshold ramps across the block)
+    const auto thresholdRamp = params.getRamp(kClipThreshold, numSamples);
+    const float clipThresholdStart = thresholdRamp.start * 0.01f;  // Convert 0-100% to 0.0-1.0
+    const float clipThresholdStep = thresholdRamp.getStep() * 0.01f;
+    bool soloClipped = params.getBool(kSoloClipped);
 
-    const int numSamples = buffer.getNumSamples();
     const int numChannels = buffer.getNumChannels();
 
     // Phase 4.3: Store original signal before processing
@@ -121,6 +98,7 @@ void AutoClipAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce
             inputPeak = juce::jmax(inputPeak, std::abs(delayedSample));
 
             // Phase 4.1: Apply hard clipping
+            const float clipThreshold = clipThresholdStart + clipThresholdStep * static_cast<float>(sample);
             float clippedSample = juce::jlimit(-clipThreshold, clipThreshold, delayedSample);
 
             // Phase 4.2: Analyze output peak from clipped signal
@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Parameters.h>
 
 class AutoClipAudioProcessor : public juce::AudioProcessor
 {
@@ -30,12 +31,20 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // Parameter table (layout + cached atomics)
+    enum Param { kClipThreshold, kSoloClipped, kNumParams };
+
+    static constexpr std::array<pfs::ParamSpec, kNumParams> kParamSpecs {{
+        // clipThreshold - 0-100%, linear; glides over 20 ms so automation does not zipper
+        pfs::floatParam("clipThreshold", "Clip Threshold", 0.0f, 100.0f, 0.01f, 1.0f, 0.0f, "%", 0.02f),
+        pfs::boolParam("soloClipped", "Clip Solo", false),
+    }};
+
     // Public APVTS for editor binding
     juce::AudioProcessorValueTreeState parameters;
 
 private:
-    // Parameter layout creation
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    pfs::ParameterSet<Param, kNumParams> params { parameters, kParamSpecs };
 
     // DSP Components (Phase 4.1: Core Processing)
     juce::dsp::ProcessSpec spec;
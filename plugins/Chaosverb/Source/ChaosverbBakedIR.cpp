@@ -0,0 +1,332 @@
+#include "ChaosverbBakedIR.h"
+
+#include <cmath>
+#include <limits>
+
+namespace nbs {
+
+bool IRBakeSettings::operator==(const IRBakeSettings &other) const {
+  return quality == other.quality &&
+         snapshot.feedbackGain == other.snapshot.feedbackGain &&
+         snapshot.topologyBlend == other.snapshot.topologyBlend &&
+         snapshot.modDepthSamples == other.snapshot.modDepthSamples &&
+         snapshot.resoSmoothCoeff == other.snapshot.resoSmoothCoeff &&
+         densityNorm == other.densityNorm &&
+         spectralTilt == other.spectralTilt && resonance == other.resonance &&
+         modRateHz == other.modRateHz &&
+         modDepthPercent == other.modDepthPercent &&
+         decaySeconds == other.decaySeconds;
+}
+
+ChaosverbBakedIR::ChaosverbBakedIR() : juce::Thread("Chaosverb IR baker") {}
+
+ChaosverbBakedIR::~ChaosverbBakedIR() {
+  stopThread(2000);
+
+  BakedConvolver item;
+  while (baked.pop(item))
+    delete item.convolver;
+  freeRetiredConvolvers();
+}
+
+void ChaosverbBakedIR::prepare(const juce::dsp::ProcessSpec &spec) {
+  // The worker reads sampleRate and uses the rings; all are reset with it
+  // stopped. Convolvers baked at the old rate are dropped.
+  stopThread(2000);
+
+  BakedConvolver item;
+  while (baked.pop(item))
+    delete item.convolver;
+  freeRetiredConvolvers();
+  convolver.reset();
+  installedIRSize = 0;
+
+  sampleRate = spec.sampleRate;
+  for (auto &scratch : convScratch)
+    scratch.assign(static_cast<size_t>(kMaxBlockSize), 0.0f);
+
+  requests.reset();
+  retired.reset();
+  baked.reset();
+  requestedGeneration = 0;
+  reset();
+
+  startThread(juce::Thread::Priority::low);
+}
+
+void ChaosverbBakedIR::release() {
+  stopThread(2000);
+  reset();
+}
+
+void ChaosverbBakedIR::reset() {
+  if (convolver != nullptr)
+    convolver->reset();
+  state = State::Live;
+  staticSamples = 0;
+  fdnRingOutSamples = 0;
+  convRingOutSamples = 0;
+}
+
+void ChaosverbBakedIR::clearHistory() {
+  if (convolver != nullptr)
+    convolver->reset();
+  fdnRingOutSamples = 0;
+  convRingOutSamples = 0;
+}
+
+std::unique_ptr<juce::dsp::Convolution> ChaosverbBakedIR::makeConvolver() {
+  return std::make_unique<juce::dsp::Convolution>(
+      juce::dsp::Convolution::NonUniform{512});
+}
+
+void ChaosverbBakedIR::collectBakedConvolvers() {
+  // Room to retire both the arriving convolver and the one it replaces
+  while (retired.capacity() - retired.getNumReady() >= 2) {
+    BakedConvolver item;
+    if (!baked.pop(item))
+      return;
+
+    // Only the bake still being waited for is installed; one that was
+    // superseded (or whose settings changed meanwhile) goes straight back.
+    // The convolver being replaced is idle: a bake starts only after the
+    // last one has rung out.
+    if (state != State::Baking || item.generation != requestedGeneration) {
+      retired.push(item.convolver);
+      continue;
+    }
+
+    if (convolver != nullptr)
+      retired.push(convolver.release());
+    convolver.reset(item.convolver);
+    installedIRSize = item.irSize;
+
+    fdnRingOutSamples = installedIRSize;
+    state = State::Baked;
+  }
+}
+
+void ChaosverbBakedIR::freeRetiredConvolvers() {
+  juce::dsp::Convolution *old = nullptr;
+  while (retired.pop(old))
+    delete old;
+}
+
+void ChaosverbBakedIR::update(const IRBakeSettings &settings, bool canBake,
+                              int numSamples) {
+  fdnRingOutSamples = juce::jmax(0, fdnRingOutSamples - numSamples);
+  convRingOutSamples = juce::jmax(0, convRingOutSamples - numSamples);
+
+  const bool changed = settings != lastSettings;
+  lastSettings = settings;
+  staticSamples =
+      changed ? 0
+              : juce::jmin(staticSamples + numSamples,
+                           std::numeric_limits<int>::max() / 2);
+
+  if (changed || !canBake) {
+    // Back to the live FDN; a baked convolver rings out what it already heard
+    if (state == State::Baked)
+      convRingOutSamples = installedIRSize;
+    state = State::Live;
+    collectBakedConvolvers();
+    return;
+  }
+
+  const int settleSamples =
+      static_cast<int>(kSettleSeconds * static_cast<float>(sampleRate));
+  const float irSeconds = settings.decaySeconds * kIRDecayMultiple;
+
+  if (state == State::Live && staticSamples >= settleSamples &&
+      convRingOutSamples == 0 && irSeconds <= kMaxIRSeconds) {
+    BakeRequest request;
+    request.settings = settings;
+    request.generation = requestedGeneration + 1;
+    request.numSamples = static_cast<int>(std::ceil(irSeconds * sampleRate));
+
+    if (requests.push(request)) {
+      requestedGeneration = request.generation;
+      state = State::Baking;
+    }
+  }
+
+  // Baking ends when the worker hands over the requested convolver
+  collectBakedConvolvers();
+}
+
+void ChaosverbBakedIR::process(int numSamples, const float *inL,
+                               const float *inR, float *outL, float *outR) {
+  jassert(numSamples <= kMaxBlockSize);
+
+  float *convL = convScratch[0].data();
+  float *convR = convScratch[1].data();
+
+  if (inL != nullptr)
+    std::copy_n(inL, numSamples, convL);
+  else
+    std::fill_n(convL, numSamples, 0.0f);
+
+  if (inR != nullptr)
+    std::copy_n(inR, numSamples, convR);
+  else
+    std::fill_n(convR, numSamples, 0.0f);
+
+  jassert(convolver != nullptr);
+  float *channels[] = {convL, convR};
+  juce::dsp::AudioBlock<float> block(channels, 2,
+                                     static_cast<size_t>(numSamples));
+  convolver->process(juce::dsp::ProcessContextReplacing<float>(block));
+
+  if (outL != nullptr)
+    juce::FloatVectorOperations::add(outL, convL, numSamples);
+  if (outR != nullptr)
+    juce::FloatVectorOperations::add(outR, convR, numSamples);
+}
+
+void ChaosverbBakedIR::run() {
+  while (!threadShouldExit()) {
+    freeRetiredConvolvers();
+
+    // Only the newest request matters; older ones were superseded
+    BakeRequest request;
+    bool hasRequest = false;
+    while (requests.pop(request))
+      hasRequest = true;
+
+    if (hasRequest)
+      render(request);
+    else
+      wait(50);
+  }
+}
+
+void ChaosverbBakedIR::render(const BakeRequest &request) {
+  const auto &settings = request.settings;
+  const int numSamples = request.numSamples;
+
+  ChaosverbFDN &fdn = renderFDN;
+  fdn.prepare({sampleRate, static_cast<juce::uint32>(kMaxBlockSize), 2},
+              settings.quality);
+  fdn.updateDensity(settings.densityNorm);
+  fdn.updateShelfCoefficients(settings.spectralTilt);
+  fdn.updateResonanceCoefficients(settings.resonance);
+
+  // The live resonance gain has long since settled; start the render there
+  FDNParamSnapshot snapshot = settings.snapshot;
+  snapshot.resoSmoothCoeff = 1.0f;
+
+  juce::AudioBuffer<float> ir(2, numSamples);
+  std::array<float, kMaxBlockSize> impulse{};
+
+  for (int start = 0; start < numSamples; start += kMaxBlockSize) {
+    if (threadShouldExit() || requests.getNumReady() > 0)
+      return;
+
+    const int n = juce::jmin(kMaxBlockSize, numSamples - start);
+    impulse[0] = start == 0 ? 1.0f : 0.0f;
+
+    const float *in[] = {impulse.data(), impulse.data()};
+    float *out[] = {ir.getWritePointer(0, start), ir.getWritePointer(1, start)};
+    fdn.prepareLFO(settings.modRateHz, settings.modDepthPercent);
+    fdn.processBlock(in, out, n, snapshot);
+  }
+
+  // Raised-cosine fade over the last 10% (already below -100 dB) so the
+  // truncated tail ends silent
+  const int fadeLength = juce::jmax(1, numSamples / 10);
+  const int fadeStart = numSamples - fadeLength;
+  for (int i = 0; i < fadeLength; ++i) {
+    const float gain =
+        0.5f * (1.0f + std::cos(juce::MathConstants<float>::pi *
+                                static_cast<float>(i + 1) /
+                                static_cast<float>(fadeLength)));
+    for (int ch = 0; ch < 2; ++ch)
+      ir.getWritePointer(ch)[fadeStart + i] *= gain;
+  }
+
+  {
+    const juce::ScopedLock lock(irLock);
+    lastIR.makeCopyOf(ir);
+    lastIRSampleRate = sampleRate;
+  }
+
+  // Install the IR here rather than on the audio thread. A new convolver
+  // starts on a placeholder IR of another size, swaps the loaded one in
+  // inside process() and then crossfades from the placeholder; run it on
+  // silence until the new IR is in and the fade is over, then clear it.
+  auto bakedConvolver = makeConvolver();
+  bakedConvolver->prepare(
+      {sampleRate, static_cast<juce::uint32>(kMaxBlockSize), 2});
+  bakedConvolver->loadImpulseResponse(std::move(ir), sampleRate,
+                                      juce::dsp::Convolution::Stereo::yes,
+                                      juce::dsp::Convolution::Trim::no,
+                                      juce::dsp::Convolution::Normalise::no);
+
+  juce::AudioBuffer<float> silence(2, kMaxBlockSize);
+  int fadeSamples =
+      static_cast<int>(std::ceil(kInstallSeconds * sampleRate));
+
+  while (fadeSamples > 0) {
+    if (threadShouldExit() || requests.getNumReady() > 0)
+      return;
+
+    silence.clear();
+    juce::dsp::AudioBlock<float> block(silence);
+    bakedConvolver->process(juce::dsp::ProcessContextReplacing<float>(block));
+
+    if (static_cast<int>(bakedConvolver->getCurrentIRSize()) == numSamples)
+      fadeSamples -= kMaxBlockSize;
+    else
+      wait(1);
+  }
+
+  bakedConvolver->reset();
+
+  BakedConvolver item;
+  item.convolver = bakedConvolver.get();
+  item.generation = request.generation;
+  item.irSize = numSamples;
+  if (baked.push(item))
+    bakedConvolver.release(); // owned by the audio thread now
+}
+
+bool ChaosverbBakedIR::exportImpulseResponse(const juce::File &file) const {
+  juce::AudioBuffer<float> ir;
+  double irSampleRate = 0.0;
+  {
+    const juce::ScopedLock lock(irLock);
+    ir.makeCopyOf(lastIR);
+    irSampleRate = lastIRSampleRate;
+  }
+
+  if (ir.getNumSamples() == 0)
+    return false;
+
+  file.getParentDirectory().createDirectory();
+  file.deleteFile();
+
+  auto stream = file.createOutputStream();
+  if (stream == nullptr)
+    return false;
+
+  juce::WavAudioFormat format;
+  std::unique_ptr<juce::AudioFormatWriter> writer(format.createWriterFor(
+      stream.get(), irSampleRate,
+      static_cast<unsigned int>(ir.getNumChannels()), 32, {}, 0));
+  if (writer == nullptr)
+    return false;
+
+  stream.release(); // owned by the writer now
+  return writer->writeFromAudioSampleBuffer(ir, 0, ir.getNumSamples());
+}
+
+size_t ChaosverbBakedIR::getMemoryFootprintBytes() const {
+  const juce::ScopedLock lock(irLock);
+  return sizeof(*this) +
+         static_cast<size_t>(lastIR.getNumChannels() * lastIR.getNumSamples()) *
+             sizeof(float) +
+         (convScratch[0].capacity() + convScratch[1].capacity()) *
+             sizeof(float);
+}
+
+} // namespace nbs
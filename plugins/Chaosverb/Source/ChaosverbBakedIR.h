@@ -0,0 +1,171 @@
+#pragma once
+
+#include "ChaosverbFDN.h"
+#include <pfs/SpscRing.h>
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_dsp/juce_dsp.h>
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace nbs {
+
+// Everything the FDN response depends on apart from the LFO phase. Two equal
+// settings render the same impulse response.
+struct IRBakeSettings {
+  FDNQuality quality = FDNQuality::Normal;
+  FDNParamSnapshot snapshot;
+  float densityNorm = 0.0f;
+  float spectralTilt = 0.0f;
+  float resonance = 0.0f;
+  float modRateHz = 0.0f;
+  float modDepthPercent = 0.0f;
+  float decaySeconds = 0.0f;
+
+  bool operator==(const IRBakeSettings &other) const;
+  bool operator!=(const IRBakeSettings &other) const {
+    return !(*this == other);
+  }
+};
+
+// Baked impulse-response mode: once the FDN parameters have been static for
+// a while, a worker thread renders the FDN's stereo impulse response and the
+// wet path swaps the FDN for a partitioned convolution of it.
+//
+// Each bake gets its own convolver, which the worker installs the IR in and
+// hands over tagged with the bake's generation, so the audio thread knows
+// exactly which IR it is running. Convolvers it is done with go back to the
+// worker to be freed.
+//
+// The FDN's two halves never mix, so the response is two mono IRs (L->L,
+// R->R). Switching is done by superposition rather than a crossfade: from the
+// switch point the new engine takes the input and the old one keeps ringing
+// out on silence until its tail has gone (one IR length), so both outputs are
+// summed and nothing is cut off. Any change of the settings, or a mutation,
+// hands the input straight back to the FDN the same way.
+class ChaosverbBakedIR : private juce::Thread {
+public:
+  ChaosverbBakedIR();
+  ~ChaosverbBakedIR() override;
+
+  // Message thread. Drops any baked convolver and starts the bake worker.
+  void prepare(const juce::dsp::ProcessSpec &spec);
+
+  // Stops the worker and returns to the live FDN
+  void release();
+
+  // Audio thread: clears the convolver history and returns to the live FDN
+  void reset();
+
+  // Audio thread: clears the convolver history but keeps the baked IR and
+  // mode, for when the whole tail has gone silent
+  void clearHistory();
+
+  // Audio thread, once per wet chunk before it runs. canBake is false while
+  // the mode is off or a mutation is pending/crossfading.
+  void update(const IRBakeSettings &settings, bool canBake, int numSamples);
+
+  // Audio thread, per chunk: who gets the diffused input, and which engines
+  // still need to run
+  bool convolverOwnsInput() const { return state == State::Baked; }
+  bool isFDNRunning() const {
+    return state != State::Baked || fdnRingOutSamples > 0;
+  }
+  bool isConvolverRunning() const {
+    return state == State::Baked || convRingOutSamples > 0;
+  }
+
+  // Adds the convolver output to outL/outR. inL/inR of nullptr convolve
+  // silence (ring-out, priming).
+  void process(int numSamples, const float *inL, const float *inR,
+               float *outL, float *outR);
+
+  // Message thread: writes the last baked IR as a 32-bit stereo WAV
+  bool exportImpulseResponse(const juce::File &file) const;
+
+  // Bytes of the last baked IR kept for export (the convolver's own
+  // partitions are not counted)
+  size_t getMemoryFootprintBytes() const;
+
+  // The IR runs to kIRDecayMultiple x the decay (T60): twice over reaches
+  // -120 dB, the silence threshold the live FDN and the reported tail use,
+  // so switching to the baked IR does not shorten the tail
+  static constexpr float kIRDecayMultiple = 2.0f;
+
+  // Longest IR that is baked; longer tails stay on the live FDN
+  static constexpr float kMaxIRSeconds = 12.0f;
+
+private:
+  enum class State {
+    Live,   // FDN owns the input
+    Baking, // request queued, worker rendering and installing
+    Baked   // convolver owns the input
+  };
+
+  struct BakeRequest {
+    IRBakeSettings settings;
+    int generation = 0;
+    int numSamples = 0;
+  };
+
+  // A convolver with its IR installed, and the bake it came from
+  struct BakedConvolver {
+    juce::dsp::Convolution *convolver = nullptr;
+    int generation = 0;
+    int irSize = 0;
+  };
+
+  void run() override;
+  void render(const BakeRequest &request);
+
+  // Audio thread: takes finished convolvers, installing the requested one
+  void collectBakedConvolvers();
+
+  // Worker (or with it stopped): frees every convolver handed back
+  void freeRetiredConvolvers();
+
+  static std::unique_ptr<juce::dsp::Convolution> makeConvolver();
+
+  static constexpr float kSettleSeconds = 0.5f;   // static time before a bake
+  static constexpr float kInstallSeconds = 0.1f;  // convolver's own crossfade
+  static constexpr int kMaxBlockSize = 256;
+
+  double sampleRate = 48000.0;
+
+  // Audio thread: the installed convolver (none before the first bake)
+  std::unique_ptr<juce::dsp::Convolution> convolver;
+  std::array<std::vector<float>, 2> convScratch;
+
+  // Audio thread state
+  State state = State::Live;
+  IRBakeSettings lastSettings;
+  int staticSamples = 0;
+  int requestedGeneration = 0;
+  int installedIRSize = 0;
+  int fdnRingOutSamples = 0;
+  int convRingOutSamples = 0;
+
+  // Worker: the FDN each bake renders. A member rather than a local, as the
+  // wider layouts make it too big for a thread stack.
+  ChaosverbFDN renderFDN;
+
+  // Audio thread -> worker: bake requests and convolvers to free. The audio
+  // thread only takes a baked convolver while two retire slots are free, so
+  // a retire push never fails.
+  pfs::SpscRing<BakeRequest, 4> requests;
+  pfs::SpscRing<juce::dsp::Convolution *, 8> retired;
+
+  // Worker -> audio thread: convolvers with their IR installed
+  pfs::SpscRing<BakedConvolver, 4> baked;
+
+  // Worker output kept for export, guarded by irLock
+  juce::CriticalSection irLock;
+  juce::AudioBuffer<float> lastIR;
+  double lastIRSampleRate = 48000.0;
+
+  JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChaosverbBakedIR)
+};
+
+} // namespace nbs
@@ -6,37 +6,37 @@ ChaosverbDiffuser::ChaosverbDiffuser() = default;
 
 void ChaosverbDiffuser::prepare(const juce::dsp::ProcessSpec &spec) {
   const double srRatio = spec.sampleRate / 48000.0;
+  numChannels =
+      juce::jlimit(1, kMaxChannels, static_cast<int>(spec.numChannels));
+
+  int arenaSize = 0;
+  int largestRing = 1;
+  for (int stage = 0; stage < kNumDiffuserStages; ++stage) {
+    allpassDelayLengths[stage] =
+        static_cast<int>(std::ceil(kAllpassLengths48k[stage] * srRatio));
+
+    const int ringSize = juce::nextPowerOfTwo(allpassDelayLengths[stage] + 1);
+    ringMask[stage] = ringSize - 1;
+    largestRing = juce::jmax(largestRing, ringSize);
+
+    for (int ch = 0; ch < numChannels; ++ch) {
+      ringOffset[stage][ch] = arenaSize;
+      arenaSize += ringSize;
+    }
+  }
 
-  for (int i = 0; i < kNumDiffuserStages; ++i)
-    allpassDelayLengths[i] =
-        static_cast<int>(std::ceil(kAllpassLengths48k[i] * srRatio));
-
-  diffLine0.prepare(spec);
-  diffLine0.setMaximumDelayInSamples(allpassDelayLengths[0] + 1);
-  diffLine0.setDelay(static_cast<float>(allpassDelayLengths[0]));
-  diffLine0.reset();
-
-  diffLine1.prepare(spec);
-  diffLine1.setMaximumDelayInSamples(allpassDelayLengths[1] + 1);
-  diffLine1.setDelay(static_cast<float>(allpassDelayLengths[1]));
-  diffLine1.reset();
-
-  diffLine2.prepare(spec);
-  diffLine2.setMaximumDelayInSamples(allpassDelayLengths[2] + 1);
-  diffLine2.setDelay(static_cast<float>(allpassDelayLengths[2]));
-  diffLine2.reset();
-
-  diffLine3.prepare(spec);
-  diffLine3.setMaximumDelayInSamples(allpassDelayLengths[3] + 1);
-  diffLine3.setDelay(static_cast<float>(allpassDelayLengths[3]));
-  diffLine3.reset();
+  ringArena.assign(static_cast<size_t>(arenaSize), 0.0f);
+  writeWrapMask = largestRing - 1;
+  writePos = 0;
+  windowPeak = previousWindowPeak = 0.0f;
+  windowSamples = 0;
 }
 
 void ChaosverbDiffuser::reset() {
-  diffLine0.reset();
-  diffLine1.reset();
-  diffLine2.reset();
-  diffLine3.reset();
+  std::fill(ringArena.begin(), ringArena.end(), 0.0f);
+  writePos = 0;
+  windowPeak = previousWindowPeak = 0.0f;
+  windowSamples = 0;
 }
 
 void ChaosverbDiffuser::updateDensity(float densityPercent) {
@@ -52,39 +52,47 @@ void ChaosverbDiffuser::updateDensity(float densityPercent) {
     numActiveStages = 4;
 }
 
-juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None> &
-ChaosverbDiffuser::getDiffLine(int i) {
-  switch (i) {
-  case 0:
-    return diffLine0;
-  case 1:
-    return diffLine1;
-  case 2:
-    return diffLine2;
-  default:
-    return diffLine3;
+void ChaosverbDiffuser::process(int numSamples, float *const *data) {
+  // Inactive stages are not written; their rings hold whatever they last saw,
+  // as with the per-sample diffuser this replaces.
+  for (int stage = 0; stage < numActiveStages; ++stage)
+    for (int ch = 0; ch < numChannels; ++ch)
+      windowPeak = std::max(windowPeak,
+                            processStage(stage, ch, numSamples, data[ch]));
+
+  writePos = (writePos + numSamples) & writeWrapMask;
+
+  windowSamples += numSamples;
+  if (windowSamples > writeWrapMask) {
+    previousWindowPeak = windowPeak;
+    windowPeak = 0.0f;
+    windowSamples = 0;
   }
 }
 
-void ChaosverbDiffuser::processSample(float &valL, float &valR) {
-  if (numActiveStages <= 0)
-    return;
-
-  for (int stage = 0; stage < numActiveStages; ++stage) {
-    auto &dl = getDiffLine(stage);
-
-    // Left Channel
-    const float delayedL = dl.popSample(0);
-    const float vL = valL - kAllpassCoeff * delayedL;
-    dl.pushSample(0, vL);
-    valL = delayedL + kAllpassCoeff * vL;
+float ChaosverbDiffuser::getStatePeak() const {
+  // Not run at all without active stages
+  if (numActiveStages == 0)
+    return 0.0f;
+  return std::max(windowPeak, previousWindowPeak);
+}
 
-    // Right Channel
-    const float delayedR = dl.popSample(1);
-    const float vR = valR - kAllpassCoeff * delayedR;
-    dl.pushSample(1, vR);
-    valR = delayedR + kAllpassCoeff * vR;
+float ChaosverbDiffuser::processStage(int stage, int channel, int numSamples,
+                                      float *data) {
+  float *ring = ringArena.data() + ringOffset[stage][channel];
+  const int mask = ringMask[stage];
+  const int delay = allpassDelayLengths[stage];
+
+  float peak = 0.0f;
+  for (int n = 0; n < numSamples; ++n) {
+    const int w = writePos + n;
+    const float delayed = ring[(w - delay) & mask];
+    const float v = data[n] - kAllpassCoeff * delayed;
+    ring[w & mask] = v;
+    data[n] = delayed + kAllpassCoeff * v;
+    peak = std::max(peak, std::abs(v));
   }
+  return peak;
 }
 
 } // namespace nbs
@@ -5,6 +5,10 @@
 
 namespace nbs {
 
+// 4-stage Schroeder allpass diffuser on the pre-delayed wet input, for up to
+// kMaxChannels channels (spec.numChannels). Each stage/channel is a
+// power-of-two ring in one arena sized in prepare(); process() runs a whole
+// block one stage at a time.
 class ChaosverbDiffuser {
 public:
   ChaosverbDiffuser();
@@ -16,10 +20,22 @@ public:
   // Updates the number of active stages based on the density parameter (0.0 to
   // 100.0)
   void updateDensity(float densityPercent);
+  int getNumActiveStages() const { return numActiveStages; }
 
-  // Processes an individual stereo sample (returns the processed Left and
-  // Right)
-  void processSample(float &valL, float &valR);
+  // Processes numChannels channels in place through the active stages
+  void process(int numSamples, float *const *data);
+
+  // Upper bound on the magnitudes in the active stages' rings (silent-tail
+  // detector): the running peak of what process() wrote over the last one to
+  // two ring lengths. Inactive stages keep stale samples but are not heard.
+  float getStatePeak() const;
+
+  size_t getMemoryFootprintBytes() const {
+    return sizeof(*this) + ringArena.capacity() * sizeof(float);
+  }
+
+  // Widest layout (7.1.4)
+  static constexpr int kMaxChannels = 12;
 
 private:
   static constexpr int kNumDiffuserStages = 4;
@@ -27,20 +43,27 @@ private:
                                                                  1013};
   static constexpr float kAllpassCoeff = 0.7f;
 
+  // Returns the largest magnitude written into the ring
+  float processStage(int stage, int channel, int numSamples, float *data);
+
   int allpassDelayLengths[kNumDiffuserStages] = {};
   int numActiveStages = 0;
+  int numChannels = 2;
+
+  // Ring [stage][channel] starts at ringOffset and is ringMask[stage] + 1 long.
+  // All rings advance by one shared write position, wrapped to the largest
+  // ring so every smaller power-of-two mask stays consistent.
+  std::vector<float> ringArena;
+  int ringOffset[kNumDiffuserStages][kMaxChannels] = {};
+  int ringMask[kNumDiffuserStages] = {};
+  int writePos = 0;
+  int writeWrapMask = 0;
 
-  juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None>
-      diffLine0;
-  juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None>
-      diffLine1;
-  juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None>
-      diffLine2;
-  juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None>
-      diffLine3;
-
-  juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None> &
-  getDiffLine(int i);
+  // Running peak of the ring writes: this window, and the whole previous
+  // one. A window spans the largest ring.
+  float windowPeak = 0.0f;
+  float previousWindowPeak = 0.0f;
+  int windowSamples = 0;
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChaosverbDiffuser)
 };
@@ -6,26 +6,14 @@ ChaosverbEQ::ChaosverbEQ() = default;
 
 void ChaosverbEQ::prepare(const juce::dsp::ProcessSpec &spec) {
   currentSampleRate = spec.sampleRate;
+  numChannels =
+      juce::jlimit(1, kMaxChannels, static_cast<int>(spec.numChannels));
 
-  juce::dsp::ProcessSpec monoSpec{spec.sampleRate, spec.maximumBlockSize, 1};
-
-  lowCutL.prepare(monoSpec);
-  lowCutL.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-  lowCutR.prepare(monoSpec);
-  lowCutR.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-
-  highCutL.prepare(monoSpec);
-  highCutL.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
-  highCutR.prepare(monoSpec);
-  highCutR.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
-
-  tiltLowL.prepare(monoSpec);
-  tiltLowR.prepare(monoSpec);
-  tiltHighL.prepare(monoSpec);
-  tiltHighR.prepare(monoSpec);
+  reset();
 
   lowCutSmoother.reset(currentSampleRate, 0.05);  // 50ms smoothing
   highCutSmoother.reset(currentSampleRate, 0.15); // 150ms — longer ramp for zipper-free sweeps
+  tiltSmoother.reset(currentSampleRate, 0.05);    // 50ms, stepped per block
 
   cachedLowCut = -1.0f;
   cachedHighCut = -1.0f;
@@ -33,14 +21,14 @@ void ChaosverbEQ::prepare(const juce::dsp::ProcessSpec &spec) {
 }
 
 void ChaosverbEQ::reset() {
-  lowCutL.reset();
-  lowCutR.reset();
-  highCutL.reset();
-  highCutR.reset();
-  tiltLowL.reset();
-  tiltLowR.reset();
-  tiltHighL.reset();
-  tiltHighR.reset();
+  std::fill(std::begin(lowS1), std::end(lowS1), 0.0f);
+  std::fill(std::begin(lowS2), std::end(lowS2), 0.0f);
+  std::fill(std::begin(highS1), std::end(highS1), 0.0f);
+  std::fill(std::begin(highS2), std::end(highS2), 0.0f);
+  std::fill(std::begin(tiltLowS1), std::end(tiltLowS1), 0.0f);
+  std::fill(std::begin(tiltLowS2), std::end(tiltLowS2), 0.0f);
+  std::fill(std::begin(tiltHighS1), std::end(tiltHighS1), 0.0f);
+  std::fill(std::begin(tiltHighS2), std::end(tiltHighS2), 0.0f);
 }
 
 void ChaosverbEQ::update(float lowCutHz, float highCutHz, float tiltVal) {
@@ -55,49 +43,67 @@ void ChaosverbEQ::update(float lowCutHz, float highCutHz, float tiltVal) {
   }
 
   if (std::abs(tiltVal - cachedTilt) > 0.1f) {
+    // The first tilt after prepare() is applied straight away
+    if (cachedTilt < -100.0f) {
+      tiltSmoother.setCurrentAndTargetValue(tiltVal);
+      setTilt(tiltVal);
+    } else {
+      tiltSmoother.setTargetValue(tiltVal);
+    }
     cachedTilt = tiltVal;
-    const float t = tiltVal / 100.0f;
-    const float tiltGainDb = t * 6.0f;
-
-    auto lowShelf = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-        currentSampleRate, 600.0f, 0.707f,
-        juce::Decibels::decibelsToGain(-tiltGainDb));
-    auto highShelf = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-        currentSampleRate, 3000.0f, 0.707f,
-        juce::Decibels::decibelsToGain(tiltGainDb));
-
-    *tiltLowL.coefficients = *lowShelf;
-    *tiltLowR.coefficients = *lowShelf;
-    *tiltHighL.coefficients = *highShelf;
-    *tiltHighR.coefficients = *highShelf;
   }
 }
 
-void ChaosverbEQ::process(int numSamples, float *dataL, float *dataR) {
-  if (dataL == nullptr || dataR == nullptr)
+void ChaosverbEQ::beginBlock(int numSamples) {
+  jassert(numSamples <= kMaxRampSize);
+  if (numSamples <= 0)
     return;
 
-  for (int n = 0; n < numSamples; ++n) {
-    const float currentLowCut = lowCutSmoother.getNextValue();
-    lowCutL.setCutoffFrequency(currentLowCut);
-    lowCutR.setCutoffFrequency(currentLowCut);
+  // The shelves are shared by every sample of the block, so a moving tilt
+  // steps once per block, to where its smoother ends the block
+  if (tiltSmoother.isSmoothing()) {
+    tiltSmoother.skip(numSamples);
+    setTilt(tiltSmoother.getCurrentValue());
+  }
 
-    const float currentHighCut = highCutSmoother.getNextValue();
-    highCutL.setCutoffFrequency(currentHighCut);
-    highCutR.setCutoffFrequency(currentHighCut);
+  // The tan() per sample is only paid while a cutoff is moving
+  if (!lowCutSmoother.isSmoothing() && !highCutSmoother.isSmoothing()) {
+    setCutoffs(0, lowCutSmoother.getCurrentValue(),
+               highCutSmoother.getCurrentValue());
+    const size_t count = static_cast<size_t>(numSamples);
+    std::fill_n(lowCutG.begin() + 1, count - 1, lowCutG[0]);
+    std::fill_n(lowCutH.begin() + 1, count - 1, lowCutH[0]);
+    std::fill_n(highCutG.begin() + 1, count - 1, highCutG[0]);
+    std::fill_n(highCutH.begin() + 1, count - 1, highCutH[0]);
+    return;
+  }
 
-    dataL[n] = lowCutL.processSample(0, dataL[n]);
-    dataR[n] = lowCutR.processSample(0, dataR[n]);
+  for (int n = 0; n < numSamples; ++n)
+    setCutoffs(n, lowCutSmoother.getNextValue(),
+               highCutSmoother.getNextValue());
+}
 
-    dataL[n] = highCutL.processSample(0, dataL[n]);
-    dataR[n] = highCutR.processSample(0, dataR[n]);
+void ChaosverbEQ::setCutoffs(int n, float lowCutHz, float highCutHz) {
+  const double piOverFs = juce::MathConstants<double>::pi / currentSampleRate;
+  const size_t i = static_cast<size_t>(n);
 
-    dataL[n] = tiltLowL.processSample(dataL[n]);
-    dataL[n] = tiltHighL.processSample(dataL[n]);
+  const float lowG = static_cast<float>(std::tan(piOverFs * lowCutHz));
+  lowCutG[i] = lowG;
+  lowCutH[i] = static_cast<float>(1.0 / (1.0 + kR2 * lowG + lowG * lowG));
 
-    dataR[n] = tiltLowR.processSample(dataR[n]);
-    dataR[n] = tiltHighR.processSample(dataR[n]);
-  }
+  const float highG = static_cast<float>(std::tan(piOverFs * highCutHz));
+  highCutG[i] = highG;
+  highCutH[i] = static_cast<float>(1.0 / (1.0 + kR2 * highG + highG * highG));
+}
+
+void ChaosverbEQ::setTilt(float tiltVal) {
+  const float t = tiltVal / 100.0f;
+  const float tiltGainDb = t * 6.0f;
+
+  tiltLow.makeLowShelf(currentSampleRate, 600.0, 0.707,
+                       juce::Decibels::decibelsToGain(-tiltGainDb));
+  tiltHigh.makeHighShelf(currentSampleRate, 3000.0, 0.707,
+                         juce::Decibels::decibelsToGain(tiltGainDb));
 }
 
 } // namespace nbs
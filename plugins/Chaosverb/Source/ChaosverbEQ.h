@@ -1,9 +1,16 @@
 #pragma once
 
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
+
+#include <array>
 
 namespace nbs {
 
+// Output EQ: SVF low/high cuts and a 600 Hz / 3 kHz tilt shelf pair. Runs a
+// frame (one sample of every channel) at a time so it can sit inside the
+// fused post-FDN loop; the per-channel state is laid out across channels so
+// each filter step is one vector loop.
 class ChaosverbEQ {
 public:
   ChaosverbEQ();
@@ -15,19 +22,88 @@ public:
   // Updates coefficients based on parameters if they changed.
   void update(float lowCutHz, float highCutHz, float tiltVal);
 
-  // Processes an interleaved stereo block (in-place)
-  void process(int numSamples, float *dataL, float *dataR);
+  // Advances the cutoff smoothers over the next numSamples (at most
+  // kMaxRampSize) into per-sample coefficient ramps for processFrame(), and
+  // the tilt smoother by one step
+  void beginBlock(int numSamples);
+
+  // Filters sample n of the block in place; frame holds numChannels samples
+  void processFrame(int n, float *frame) {
+    const float lowG = lowCutG[static_cast<size_t>(n)];
+    const float lowH = lowCutH[static_cast<size_t>(n)];
+    const float highG = highCutG[static_cast<size_t>(n)];
+    const float highH = highCutH[static_cast<size_t>(n)];
+
+    for (int ch = 0; ch < numChannels; ++ch) {
+      // TPT state-variable high-pass (low cut)
+      const float hp =
+          lowH * (frame[ch] - lowS1[ch] * (lowG + kR2) - lowS2[ch]);
+      const float lowBp = hp * lowG + lowS1[ch];
+      lowS1[ch] = hp * lowG + lowBp;
+      const float lowLp = lowBp * lowG + lowS2[ch];
+      lowS2[ch] = lowBp * lowG + lowLp;
+
+      // TPT state-variable low-pass (high cut)
+      const float highHp = highH * (hp - highS1[ch] * (highG + kR2) -
+                                    highS2[ch]);
+      const float highBp = highHp * highG + highS1[ch];
+      highS1[ch] = highHp * highG + highBp;
+      const float lp = highBp * highG + highS2[ch];
+      highS2[ch] = highBp * highG + lp;
+
+      // Tilt shelves, transposed direct form II
+      const float shelved = tiltLow.b0 * lp + tiltLowS1[ch];
+      tiltLowS1[ch] = tiltLow.b1 * lp - tiltLow.a1 * shelved + tiltLowS2[ch];
+      tiltLowS2[ch] = tiltLow.b2 * lp - tiltLow.a2 * shelved;
+
+      const float out = tiltHigh.b0 * shelved + tiltHighS1[ch];
+      tiltHighS1[ch] =
+          tiltHigh.b1 * shelved - tiltHigh.a1 * out + tiltHighS2[ch];
+      tiltHighS2[ch] = tiltHigh.b2 * shelved - tiltHigh.a2 * out;
+
+      frame[ch] = out;
+    }
+  }
+
+  // Widest layout (7.1.4)
+  static constexpr int kMaxChannels = 12;
+  static constexpr int kMaxRampSize = 256;
 
 private:
+  // Butterworth cuts: R2 = 1 / Q with Q = 1 / sqrt(2)
+  static constexpr float kR2 = 1.41421356f;
+
+  void setCutoffs(int n, float lowCutHz, float highCutHz);
+  void setTilt(float tiltVal);
+
   double currentSampleRate = 48000.0;
+  int numChannels = 2;
+
+  // Cut coefficients per sample of the block: g = tan(pi fc / fs) and
+  // h = 1 / (1 + R2 g + g^2)
+  std::array<float, kMaxRampSize> lowCutG{};
+  std::array<float, kMaxRampSize> lowCutH{};
+  std::array<float, kMaxRampSize> highCutG{};
+  std::array<float, kMaxRampSize> highCutH{};
+
+  // Shelf coefficients, shared by every channel; computed in place (tilt
+  // steps every block while it glides, so nothing may allocate)
+  pfs::BiquadCoefficients tiltLow;
+  pfs::BiquadCoefficients tiltHigh;
 
-  juce::dsp::StateVariableTPTFilter<float> lowCutL, lowCutR;
-  juce::dsp::StateVariableTPTFilter<float> highCutL, highCutR;
-  juce::dsp::IIR::Filter<float> tiltLowL, tiltLowR;
-  juce::dsp::IIR::Filter<float> tiltHighL, tiltHighR;
+  // Per-channel filter state
+  float lowS1[kMaxChannels] = {};
+  float lowS2[kMaxChannels] = {};
+  float highS1[kMaxChannels] = {};
+  float highS2[kMaxChannels] = {};
+  float tiltLowS1[kMaxChannels] = {};
+  float tiltLowS2[kMaxChannels] = {};
+  float tiltHighS1[kMaxChannels] = {};
+  float tiltHighS2[kMaxChannels] = {};
 
   juce::SmoothedValue<float> lowCutSmoother;
   juce::SmoothedValue<float> highCutSmoother;
+  juce::SmoothedValue<float> tiltSmoother;
 
   float cachedLowCut = -1.0f;
   float cachedHighCut = -1.0f;
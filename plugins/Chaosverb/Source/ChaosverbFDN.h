@@ -2,95 +2,196 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
+#include <pfs/FastMath.h>
 
-#include <array>
+#include <algorithm>
 #include <cmath>
 #include <cstring>
+#include <type_traits>
+#include <variant>
+#include <vector>
 
 //==============================================================================
 /**
- * ShortAllpass — Lightweight allpass for in-loop diffusion.
+ * Per-block FDN parameters, computed once per processBlock() by the caller.
+ * The processor keeps one per FDN so the outgoing network holds its old
+ * character during a crossfade while the incoming one uses the new values.
+ */
+struct FDNParamSnapshot {
+  float feedbackGain = 0.0f;    // per-loop gain from the T60 formula
+  float topologyBlend = 0.65f;  // 0=diagonal, 1=full Hadamard, 2=exaggerated
+  float modDepthSamples = 0.0f; // LFO depth in samples
+  float resoSmoothCoeff = 0.0f; // one-pole coefficient for resonance gain
+};
+
+//==============================================================================
+/**
+ * Quality tiers: network size per FDN. Eco and Normal are the live tiers,
+ * High and Offline trade CPU for a denser tail (see ChaosverbFDN below).
+ */
+enum class FDNQuality { Eco, Normal, High, Offline };
+
+//==============================================================================
+/**
+ * Prime tables per network size, at 48kHz.
  *
- * Uses a circular buffer (no heap allocation). Placed inside the FDN
- * feedback path to break up comb resonances on every recirculation.
- * Four of these in series per delay line (with subtle modulation)
- * eliminates metallic ringing and creates dense, lush tails.
+ * L and R use different primes so the two tails are decorrelated across the
+ * whole band, not just filtered copies of each other. The 8-line tables are
+ * the original Chaosverb network; the 4-line one takes every other line of
+ * it, and the 16/32-line ones spread over a similar range (mean loop length
+ * within ~5%) so the T60 mapping and tail density stay comparable.
  *
- * Supports both fixed-delay and modulated-delay (linear interpolation)
- * modes. The modulated mode breaks up static resonance modes when
- * driven by slow LFO offsets.
+ * In-loop allpass delays are unique primes within each stage; kMaxAPStages
+ * columns are available per size.
  */
-struct ShortAllpass {
-  static constexpr int kMaxBuf = 2048; // supports 4-stage delays up to 192kHz
-  float buf[kMaxBuf] = {};
-  int writeIdx = 0;
-  int delayLen = 1;
-  float g = 0.65f;
+template <int NumLines> struct FDNPrimeTables;
+
+template <> struct FDNPrimeTables<4> {
+  static constexpr int kMaxAPStages = 4;
+  static constexpr int kDelayLengths48k_L[4] = {1447, 1873, 2311, 2963};
+  static constexpr int kDelayLengths48k_R[4] = {1453, 1889, 2339, 2999};
+  static constexpr int kAPDelays48k[4][kMaxAPStages] = {{113, 191, 271, 353},
+                                                        {137, 211, 281, 367},
+                                                        {157, 229, 293, 379},
+                                                        {167, 239, 311, 389}};
+};
 
-  void init(int delay, float coeff) {
-    delayLen = juce::jlimit(1, kMaxBuf - 2, delay);
-    g = coeff;
-  }
+template <> struct FDNPrimeTables<8> {
+  static constexpr int kMaxAPStages = 4;
+  static constexpr int kDelayLengths48k_L[8] = {1447, 1621, 1873, 2143,
+                                                2311, 2677, 2963, 3191};
+  static constexpr int kDelayLengths48k_R[8] = {1453, 1637, 1889, 2161,
+                                                2339, 2693, 2999, 3209};
+  static constexpr int kAPDelays48k[8][kMaxAPStages] = {
+      {113, 191, 271, 353}, {127, 197, 277, 359}, {137, 211, 281, 367},
+      {149, 223, 283, 373}, {157, 229, 293, 379}, {163, 233, 307, 383},
+      {167, 239, 311, 389}, {179, 251, 313, 397}};
+};
 
-  void reset() {
-    std::memset(buf, 0, sizeof(buf));
-    writeIdx = 0;
-  }
+template <> struct FDNPrimeTables<16> {
+  static constexpr int kMaxAPStages = 4;
+  static constexpr int kDelayLengths48k_L[16] = {
+      1201, 1291, 1381, 1493, 1609, 1733, 1861, 2003,
+      2153, 2311, 2503, 2683, 2887, 3109, 3343, 3593};
+  static constexpr int kDelayLengths48k_R[16] = {
+      1213, 1301, 1399, 1511, 1621, 1747, 1873, 2017,
+      2179, 2333, 2521, 2707, 2909, 3137, 3371, 3617};
+  static constexpr int kAPDelays48k[16][kMaxAPStages] = {
+      {101, 191, 263, 337}, {107, 197, 269, 347}, {113, 199, 271, 349},
+      {127, 211, 277, 353}, {131, 223, 281, 359}, {137, 227, 283, 367},
+      {139, 229, 293, 373}, {149, 233, 307, 379}, {151, 239, 311, 383},
+      {157, 241, 313, 389}, {167, 251, 317, 397}, {173, 257, 331, 401},
+      {179, 263, 337, 409}, {181, 269, 347, 419}, {191, 271, 349, 421},
+      {199, 277, 353, 431}};
+};
+
+template <> struct FDNPrimeTables<32> {
+  static constexpr int kMaxAPStages = 6;
+  static constexpr int kDelayLengths48k_L[32] = {
+      1009, 1051, 1103, 1153, 1201, 1259, 1319, 1373, 1439, 1499, 1571,
+      1637, 1721, 1801, 1877, 1951, 2053, 2143, 2239, 2341, 2447, 2557,
+      2677, 2797, 2927, 3061, 3191, 3343, 3491, 3643, 3821, 3989};
+  static constexpr int kDelayLengths48k_R[32] = {
+      1019, 1061, 1117, 1163, 1213, 1277, 1361, 1399, 1451, 1511, 1583,
+      1657, 1733, 1823, 1889, 1973, 2069, 2161, 2267, 2357, 2467, 2579,
+      2699, 2819, 2953, 3083, 3217, 3371, 3517, 3671, 3847, 4019};
+  static constexpr int kAPDelays48k[32][kMaxAPStages] = {
+      {97, 191, 263, 337, 401, 467},  {101, 197, 269, 347, 409, 479},
+      {107, 199, 277, 349, 419, 487}, {113, 211, 281, 353, 421, 491},
+      {109, 223, 283, 359, 431, 499}, {127, 227, 293, 367, 433, 503},
+      {131, 229, 307, 373, 439, 509}, {137, 233, 311, 379, 443, 521},
+      {139, 239, 313, 383, 449, 523}, {149, 241, 317, 389, 457, 541},
+      {151, 251, 331, 397, 467, 547}, {157, 257, 337, 401, 479, 557},
+      {163, 263, 347, 409, 487, 563}, {167, 269, 349, 419, 491, 569},
+      {173, 271, 353, 421, 499, 571}, {179, 277, 359, 431, 503, 577},
+      {181, 281, 367, 433, 509, 587}, {191, 283, 373, 439, 521, 593},
+      {193, 293, 379, 443, 523, 599}, {197, 307, 383, 449, 541, 601},
+      {199, 311, 389, 457, 547, 607}, {211, 313, 397, 461, 557, 613},
+      {223, 317, 401, 467, 563, 619}, {227, 331, 409, 479, 569, 631},
+      {229, 337, 419, 487, 571, 641}, {233, 347, 421, 491, 577, 643},
+      {239, 349, 431, 499, 587, 647}, {241, 353, 433, 503, 593, 653},
+      {251, 359, 439, 509, 599, 661}, {257, 367, 443, 521, 601, 673},
+      {263, 373, 449, 523, 607, 677}, {269, 379, 457, 541, 613, 683}};
+};
 
-  float process(float input) {
-    int readIdx = writeIdx - delayLen;
-    if (readIdx < 0)
-      readIdx += kMaxBuf;
-    const float delayed = buf[readIdx];
-    const float v = input - g * delayed;
-    buf[writeIdx] = v;
-    writeIdx = (writeIdx + 1) % kMaxBuf;
-    return delayed + g * v;
+//==============================================================================
+/**
+ * Delay lengths at 48kHz for every output channel of a NumChannels network.
+ *
+ * Channels 0 and 1 are the L and R tables. Further channels (surround and
+ * height outputs) stretch the L table alternately up and down in ~1.1%
+ * steps (+1.1%, -1.1%, +2.2%, ...) and take the nearest prime not used
+ * anywhere else in the network, so every line of every channel has its own
+ * prime and the mean loop length stays close to the stereo one.
+ *
+ * Uses trial division, so call it from prepare() only.
+ */
+template <int NumLines, int NumChannels>
+void makeChannelDelayLengths48k(int (&lengths)[NumChannels][NumLines]) {
+  using Tables = FDNPrimeTables<NumLines>;
+  static_assert(NumChannels >= 2, "The L and R tables are always used");
+
+  const auto isPrime = [](int n) {
+    if (n < 2)
+      return false;
+    for (int d = 2; d * d <= n; ++d)
+      if (n % d == 0)
+        return false;
+    return true;
+  };
+
+  for (int line = 0; line < NumLines; ++line) {
+    lengths[0][line] = Tables::kDelayLengths48k_L[line];
+    lengths[1][line] = Tables::kDelayLengths48k_R[line];
   }
 
-  /**
-   * Modulated allpass with linear interpolation.
-   * modOffset shifts the read position by fractional samples,
-   * breaking up static resonance modes when driven by slow LFO.
-   */
-  float processModulated(float input, float modOffset) {
-    float effDelay = static_cast<float>(delayLen) + modOffset;
-    effDelay = juce::jlimit(1.0f, static_cast<float>(kMaxBuf - 2), effDelay);
-
-    const int intDel = static_cast<int>(effDelay);
-    const float frac = effDelay - static_cast<float>(intDel);
-
-    int r0 = writeIdx - intDel;
-    if (r0 < 0)
-      r0 += kMaxBuf;
-    int r1 = r0 - 1;
-    if (r1 < 0)
-      r1 += kMaxBuf;
-
-    const float delayed = buf[r0] + frac * (buf[r1] - buf[r0]);
-    const float v = input - g * delayed;
-    buf[writeIdx] = v;
-    writeIdx = (writeIdx + 1) % kMaxBuf;
-    return delayed + g * v;
+  for (int ch = 2; ch < NumChannels; ++ch) {
+    const int step = ch / 2;
+    const float stretch =
+        1.0f + 0.011f * static_cast<float>(ch % 2 == 0 ? step : -step);
+
+    for (int line = 0; line < NumLines; ++line) {
+      const int target = static_cast<int>(
+          std::lround(Tables::kDelayLengths48k_L[line] * stretch));
+
+      const auto isFree = [&](int candidate) {
+        if (!isPrime(candidate))
+          return false;
+        for (int other = 0; other <= ch; ++other)
+          for (int l = 0; l < (other == ch ? line : NumLines); ++l)
+            if (lengths[other][l] == candidate)
+              return false;
+        return true;
+      };
+
+      // Nearest free prime, so the stretch is kept on average
+      int offset = 0;
+      while (!isFree(target + offset))
+        offset = offset > 0 ? -offset : 1 - offset;
+      lengths[ch][line] = target + offset;
+    }
   }
-};
+}
 
 //==============================================================================
 /**
- * ChaosverbFDN
+ * ChaosverbFDNCore<NumLines, NumAPStages, NumChannels>
  *
- * 8-line Feedback Delay Network with Hadamard feedback matrix,
- * true L/R decorrelation, and dense 4-stage allpass diffusion.
+ * NumLines-line Feedback Delay Network per output channel with Hadamard
+ * feedback matrix, true per-channel decorrelation, and dense
+ * NumAPStages-stage allpass diffusion.
  *
- * Key design: L and R channels use different prime-number delay lengths
- * in the FDN, producing naturally decorrelated broadband stereo.
- * Combined with 4-stage modulated allpass diffusion per line, this
+ * Key design: every channel uses its own prime-number delay lengths in the
+ * FDN (makeChannelDelayLengths48k()), producing naturally decorrelated
+ * broadband stereo, or surround/height beds.
+ * Combined with modulated allpass diffusion per line, this
  * creates lush, non-metallic reverb tails with massive stereo width.
  *
  * Signal flow per sample (per channel) inside this class:
  *   diffused input
  *     -> Hadamard topology matrix
- *     -> 4-stage modulated allpass diffusion (per-line)
+ *     -> NumAPStages modulated allpasses (per-line)
  *     -> HF Damping (one-pole LPF per line)
  *     -> Spectral Tilt filter bank  (per-line low+high shelf)
  *     -> Resonance Injector         (per-line 3-band bandpass)
@@ -99,41 +200,66 @@ struct ShortAllpass {
  *     -> write to delay lines (LFO-modulated, channel-specific lengths)
  *   -> FDN wet output (single float per channel)
  *
- * Caller (PluginProcessor) owns:
+ * Structure-of-arrays layout: the lines of all channels are
+ * NumChannels * NumLines lanes (lane = channel * kNumLines + line), so a
+ * 12-channel bed runs as one wide network rather than six stereo ones.
+ * Every stage above is one loop
+ * over the lanes of a contiguous float array with no cross-lane dependency,
+ * which the compiler turns into AVX2 / SSE2 or NEON vectors. Only the
+ * delay and allpass reads gather per lane, since each lane has its own
+ * length; their index and interpolation maths stays vectorised. Delay and
+ * allpass rings store frames of all lanes under one write position, so
+ * each write is one contiguous store, and the Hadamard runs in registers
+ * on each channel's lines. processBlock() works in sub-blocks bounded by the
+ * shortest delay, so the feedback writes and tanh run once per sub-block.
+ *
+ * Stereo keeps its two halves apart, as the original network did. With more
+ * channels the topology matrix is the Kronecker product of a Householder
+ * reflection across channels and the per-channel Hadamard: still
+ * orthogonal (6 and 12 are not powers of two, so a single Hadamard cannot
+ * span them), and every line feeds back into every channel.
+ *
+ * Input fan-in is scaled by 1/sqrt(8 * NumLines) and the output sum by 1/8,
+ * which keeps the injected energy, and so the wet level, of every size at
+ * that of the 8-line network (exactly 1/8 both ways there).
+ *
+ * Caller (PluginProcessor, through ChaosverbFDN) owns:
  *   - Pre-delay line
  *   - Allpass diffuser chain
  *   - DryWetMixer
- *   - Stereo width M/S matrix
+ *   - Stereo width M/S matrix (spread around the mean for surround)
  *   - Crossfade state machine (selects between two ChaosverbFDN instances)
  */
-struct ChaosverbFDN {
+template <int NumLines, int NumAPStages, int NumChannels = 2>
+struct ChaosverbFDNCore {
   //==========================================================================
-  static constexpr int kNumLines = 8;
-  static constexpr float kAllpassCoeff =
-      0.7f; // kept for PluginProcessor diffuser
-
-  // L channel FDN delay lengths at 48kHz — all verified prime.
-  static constexpr int kDelayLengths48k_L[kNumLines] = {1447, 1621, 1873, 2143,
-                                                        2311, 2677, 2963, 3191};
-
-  // R channel FDN delay lengths at 48kHz — different primes, similar range.
-  // Using distinct primes per channel creates broadband decorrelation:
-  // L and R reverb tails are physically different signals across all
-  // frequencies, not just filtered versions of each other.
-  static constexpr int kDelayLengths48k_R[kNumLines] = {1453, 1637, 1889, 2161,
-                                                        2339, 2693, 2999, 3209};
-
-  // In-loop allpass diffusers: 4 stages per line (doubled from original 2).
-  // More stages = denser smearing of transients = smoother, less metallic tail.
-  // Unique prime delays at 48kHz. Shared between L/R (FDN delays handle
+  using Tables = FDNPrimeTables<NumLines>;
+
+  static constexpr int kNumLines = NumLines;
+  static constexpr int kNumChannels = NumChannels;
+  static constexpr int kNumLanes = kNumChannels * kNumLines; // channel-major
+
+  static_assert(kNumChannels >= 2, "Mono runs through the stereo network");
+
+  // The Hadamard matrix needs a power-of-two order
+  static_assert(kNumLines >= 2 && (kNumLines & (kNumLines - 1)) == 0,
+                "FDN line count must be a power of two");
+
+  // Output and fan-in scaling reference (see class comment)
+  static constexpr int kReferenceLines = 8;
+
+  // In-loop allpass diffusers: more stages = denser smearing of transients =
+  // smoother, less metallic tail. Shared between channels (FDN delays handle
   // decorrelation).
-  static constexpr int kAPStages = 4;
-  static constexpr int kAPDelays48k[kNumLines][kAPStages] = {
-      {113, 191, 271, 353}, {127, 197, 277, 359}, {137, 211, 281, 367},
-      {149, 223, 283, 373}, {157, 229, 293, 379}, {163, 233, 307, 383},
-      {167, 239, 311, 389}, {179, 251, 313, 397}};
+  static constexpr int kAPStages = NumAPStages;
+  static_assert(kAPStages >= 1 && kAPStages <= Tables::kMaxAPStages,
+                "No allpass table column for this stage count");
   static constexpr float kAPCoeff = 0.65f;
 
+  // Upper bound for the SR-scaled allpass delays (the longest 32-line table
+  // entry reaches it above ~280kHz)
+  static constexpr int kAPMaxDelay = 4094;
+
   // Allpass modulation: fraction of main LFO depth applied to allpass delays.
   // Subtle modulation (~+-2 samples max) breaks up static resonance modes
   // that cause metallic ringing, without audible pitch wobble.
@@ -141,7 +267,8 @@ struct ChaosverbFDN {
 
   // Per-stage modulation multipliers: alternating signs prevent coherent
   // pitch shift, diminishing depth adds timbral variety across stages.
-  static constexpr float kAPModMult[kAPStages] = {1.0f, -0.7f, 0.5f, -0.3f};
+  static constexpr float kAPModMult[6] = {1.0f,  -0.7f, 0.5f,
+                                          -0.3f, 0.2f,  -0.1f};
 
   // Resonance injector frequencies (Hz)
   static constexpr float kResoFreqs[3] = {330.0f, 880.0f, 2200.0f};
@@ -156,26 +283,61 @@ struct ChaosverbFDN {
   // LFO update stride — update LFO phase every N samples (saves CPU)
   static constexpr int kLFOStride = 4;
 
+  // Longest processBlock() sub-block (also capped by the shortest delay)
+  static constexpr int kMaxSubBlock = 64;
+
   //==========================================================================
-  // FDN delay lines — Lagrange3rd for smooth LFO-modulated reads.
-  // Each line handles both L and R channels internally (with different delays).
-  juce::dsp::DelayLine<float,
-                       juce::dsp::DelayLineInterpolationTypes::Lagrange3rd>
-      fdnLines[kNumLines];
+  // FDN delay lines — one power-of-two ring of frames (allocated in
+  // prepare()), each frame holding one sample per lane, so a write is a single
+  // contiguous store and the lanes never alias in the cache.
+  // Reads are 4-point Lagrange (same taps and weights as
+  // juce::dsp::DelayLine<Lagrange3rd>) for smooth LFO-modulated reads.
+  std::vector<float> delayFrames;
+  int delayMask = 0;                 // ring length (frames) - 1
+  int delayWritePos = 0;             // frame written by the current sample
+  float maxDelay[kNumLanes] = {};    // read clamp (nominal length + LFO room)
+  float delayLength[kNumLanes] = {}; // nominal lengths as float, per lane
+  float minDelayLength = 1.0f;       // bounds the processBlock() sub-blocks
+  float meanDelaySamples = 0.0f;     // mean loop length (T60 mapping)
+  float inputScale = 1.0f / static_cast<float>(kReferenceLines);
+
+  // Feedback (gain applied, tanh pending) for the current sub-block's frames
+  alignas(32) float pendingWrites[kMaxSubBlock][kNumLanes] = {};
+
+  // Parameters the last processBlock() call ended on; the next call glides
+  // from them to its own. Cleared by prepare() and reset(), so the first call
+  // after either starts at its own values.
+  FDNParamSnapshot rampedParams;
+  bool rampPrimed = false;
+
+  // Silent-tail tracking: the largest magnitude written into the delay and
+  // allpass rings per lane since the current window started, and over the
+  // whole window before it. A window spans the longest ring, so the two
+  // together cover everything the rings still hold.
+  alignas(32) float windowPeak[kNumLanes] = {};
+  float previousWindowPeak = 0.0f;
+  int windowSamples = 0;
+  int peakWindowLength = 1; // longest ring in frames (prepare())
 
   //==========================================================================
   // Spectral Tilt Filter Bank
-  // Per-line independent biquad filters: [line][ch] for low and high shelf.
-  juce::dsp::IIR::Filter<float> shelfLow[kNumLines][2];
-  juce::dsp::IIR::Filter<float> shelfHigh[kNumLines][2];
+  // Per-lane TDF-II state for low and high shelf. All lanes share one
+  // coefficient set per shelf (computed in place, no allocation), so a tilt
+  // change costs two closed-form evaluations.
+  pfs::BiquadCoefficients shelfLowCoeffs;
+  pfs::BiquadCoefficients shelfHighCoeffs;
+  float shelfLowS1[kNumLanes] = {}, shelfLowS2[kNumLanes] = {};
+  float shelfHighS1[kNumLanes] = {}, shelfHighS2[kNumLanes] = {};
 
   // Cached shelf coefficients — recalculated only when spectralTilt changes
   float cachedSpectralTilt = -999.0f; // invalid sentinel to force first update
+  float shelfTilt = 0.0f; // tilt of the current coefficients (glides to it)
 
   //==========================================================================
   // Resonance Injector
-  // Per-line, per-band, per-channel bandpass filters: [line][band][ch].
-  juce::dsp::IIR::Filter<float> resoFilter[kNumLines][3][2]; // [line][band][ch]
+  // Per-band, per-lane bandpass state. Coefficients are shared per band.
+  pfs::BiquadCoefficients resoCoeffs[3];
+  float resoS1[3][kNumLanes] = {}, resoS2[3][kNumLanes] = {};
 
   // Cached resonance parameter — recalculated when value changes
   float cachedResonance = -1.0f; // invalid sentinel
@@ -185,39 +347,58 @@ struct ChaosverbFDN {
   float targetResoGain = 0.0f;   // target value from parameter
 
   //==========================================================================
-  // In-loop allpass diffuser instances: [line][stage][channel]
-  ShortAllpass lineAP[kNumLines][kAPStages][2];
+  // In-loop allpass diffusers: per stage, a power-of-two ring of kNumLanes
+  // frames (same layout as the delay lines), sized in prepare() from that
+  // stage's longest scaled delay plus modulation headroom. All stages live in
+  // one arena and share a write position that wraps at the largest ring.
+  std::vector<float> apFrames;
+  int apStageOffset[kAPStages] = {};   // first float of each stage's ring
+  int apStageMask[kAPStages] = {};     // ring length (frames) - 1
+  float apMaxReadDelay[kAPStages] = {}; // modulated read clamp
+  float apDelay[kAPStages][kNumLanes] = {}; // per-lane (channels share lines)
+  float apGain = kAPCoeff;                  // shared by every allpass (density)
+  float targetApGain = kAPCoeff;            // apGain glides to it per sub-block
+  int apWritePos = 0;
+  int apWrapMask = 0;
 
   //==========================================================================
   // LFO Modulation Engine
-  // 8 independent sine LFOs, one per FDN delay line.
-  float lfoPhase[kNumLines] = {}; // Current phase in radians [0, 2pi)
-  float lfoPhaseInc[kNumLines] =
-      {}; // Phase increment per sample (differs +-15%)
+  // One sine LFO per FDN delay line (shared by all channels).
+  // Each has a slightly different rate for organic, non-periodic modulation.
+  float lfoPhase[kNumLines] = {};    // Current phase in radians [0, 2pi)
+  float lfoPhaseInc[kNumLines] = {}; // Phase increment per sample
+  float lfoSinCache[kNumLines] = {}; // Cached sin value (updated at stride)
 
   float maxLFODepthSamples =
       kMaxLFODepth48k; // Scaled to actual SR in prepare()
 
   // LFO update stride tracking
   int lfoUpdateCounter = 0;
-  float lfoSinCache[kNumLines] =
-      {}; // Last computed sin values (stride-rate updates)
 
   //==========================================================================
-  // HF Damping — one-pole lowpass per delay line per channel in feedback path.
+  // Modulated read positions. The LFO offsets only move when the LFOs step
+  // (or the depth changes), so the clamp, integer/fraction split and
+  // Lagrange weights are computed then, not per sample.
+  float cachedModDepthSamples = -1.0f;
+  int delayTapAge[kNumLanes] = {};         // age of the first Lagrange tap
+  float delayFrac[kNumLanes] = {};
+  float lagrangeWeight[4][kNumLanes] = {}; // c1..c4 per lane
+  int apTapAge[kAPStages][kNumLanes] = {};
+  float apFrac[kAPStages][kNumLanes] = {};
+
+  //==========================================================================
+  // HF Damping — one-pole lowpass per lane in feedback path.
   // Removes metallic character by absorbing highs each recirculation (like real
   // spaces).
-  float dampState[2][kNumLines] = {};
+  float dampState[kNumLanes] = {};
   float dampCoeff = 0.0f; // one-pole coefficient, computed in prepare()
 
   //==========================================================================
   // Scaled delay lengths per channel (set in prepare())
-  int delayLengthsL[kNumLines] = {};
-  int delayLengthsR[kNumLines] = {};
+  int delayLengths[kNumChannels][kNumLines] = {};
 
-  // FDN feedback state: last output read from each delay line, per channel.
-  // [channel][line] — only channels 0 and 1 used (stereo).
-  float fdnState[2][kNumLines] = {};
+  // FDN feedback state: last output read from each delay line, per lane.
+  float fdnState[kNumLanes] = {};
 
   double currentSampleRate = 48000.0;
 
@@ -226,54 +407,86 @@ struct ChaosverbFDN {
     currentSampleRate = spec.sampleRate;
     const double srRatio = spec.sampleRate / 48000.0;
 
-    // Scale L and R delay lengths proportionally to actual sample rate
-    for (int i = 0; i < kNumLines; ++i) {
-      delayLengthsL[i] =
-          static_cast<int>(std::ceil(kDelayLengths48k_L[i] * srRatio));
-      delayLengthsR[i] =
-          static_cast<int>(std::ceil(kDelayLengths48k_R[i] * srRatio));
-    }
+    // Scale every channel's delay lengths proportionally to actual sample
+    // rate
+    int lengths48k[kNumChannels][kNumLines];
+    makeChannelDelayLengths48k(lengths48k);
+    for (int ch = 0; ch < kNumChannels; ++ch)
+      for (int i = 0; i < kNumLines; ++i) {
+        delayLengths[ch][i] =
+            static_cast<int>(std::ceil(lengths48k[ch][i] * srRatio));
+        delayLength[ch * kNumLines + i] =
+            static_cast<float>(delayLengths[ch][i]);
+      }
+    minDelayLength =
+        *std::min_element(std::begin(delayLength), std::end(delayLength));
+
+    int totalDelay = 0;
+    for (const auto &channelLengths : delayLengths)
+      for (const int length : channelLengths)
+        totalDelay += length;
+    meanDelaySamples =
+        static_cast<float>(totalDelay) / static_cast<float>(kNumLanes);
+
+    inputScale = 1.0f / std::sqrt(static_cast<float>(kReferenceLines) *
+                                  static_cast<float>(kNumLines));
 
     // Scale max LFO depth to current sample rate
     maxLFODepthSamples = kMaxLFODepth48k * static_cast<float>(srRatio);
 
-    // FDN delay lines — max delay accommodates both channels + LFO headroom
+    // FDN delay ring — max delay accommodates every channel of the line +
+    // LFO headroom; the Lagrange taps reach 3 frames past it
     const int lfoHeadroom = static_cast<int>(std::ceil(maxLFODepthSamples)) + 4;
-    for (int i = 0; i < kNumLines; ++i) {
-      auto &line = fdnLines[i];
-      const int maxDel = juce::jmax(delayLengthsL[i], delayLengthsR[i]);
-      line.prepare(spec);
-      line.setMaximumDelayInSamples(maxDel + lfoHeadroom);
-      line.setDelay(static_cast<float>(maxDel));
-      line.reset();
-    }
+    int longestLine[kNumLines] = {};
+    for (const auto &channelLengths : delayLengths)
+      for (int line = 0; line < kNumLines; ++line)
+        longestLine[line] = juce::jmax(longestLine[line], channelLengths[line]);
 
-    // Prepare per-line IIR shelf filters (mono spec — we call processSample
-    // manually)
-    juce::dsp::ProcessSpec monoSpec{spec.sampleRate, spec.maximumBlockSize, 1};
-    for (int line = 0; line < kNumLines; ++line) {
-      for (int ch = 0; ch < 2; ++ch) {
-        shelfLow[line][ch].prepare(monoSpec);
-        shelfHigh[line][ch].prepare(monoSpec);
-      }
+    int longestDelay = 0;
+    for (int lane = 0; lane < kNumLanes; ++lane) {
+      const int maxDel = longestLine[lane % kNumLines] + lfoHeadroom;
+      maxDelay[lane] = static_cast<float>(maxDel);
+      longestDelay = juce::jmax(longestDelay, maxDel);
     }
+    const int ringFrames = juce::nextPowerOfTwo(longestDelay + 4);
+    delayFrames.assign(static_cast<size_t>(ringFrames * kNumLanes), 0.0f);
+    delayMask = ringFrames - 1;
+    delayWritePos = 0;
+
+    // Clear per-lane shelf and resonance filter state
+    clearFilterState();
+
+    // Initialize in-loop allpass diffusers (scale delays to actual SR). Each
+    // stage's ring covers its longest delay, the allpass share of the LFO
+    // depth and the second interpolation tap.
+    const int apModHeadroom =
+        static_cast<int>(std::ceil(maxLFODepthSamples * kAPModScale)) + 1;
+    int apArenaSize = 0;
+    int apLargestRing = 1;
+    for (int stage = 0; stage < kAPStages; ++stage) {
+      int longestStageDelay = 1;
+      for (int lane = 0; lane < kNumLanes; ++lane) {
+        const int delay = static_cast<int>(
+            std::ceil(Tables::kAPDelays48k[lane % kNumLines][stage] * srRatio));
+        const int clamped = juce::jlimit(1, kAPMaxDelay, delay);
+        apDelay[stage][lane] = static_cast<float>(clamped);
+        longestStageDelay = juce::jmax(longestStageDelay, clamped);
+      }
 
-    // Prepare per-line resonance filters
-    for (int line = 0; line < kNumLines; ++line)
-      for (int band = 0; band < 3; ++band)
-        for (int ch = 0; ch < 2; ++ch)
-          resoFilter[line][band][ch].prepare(monoSpec);
-
-    // Initialize in-loop allpass diffusers (4 stages, scale delays to actual
-    // SR)
-    for (int line = 0; line < kNumLines; ++line)
-      for (int stage = 0; stage < kAPStages; ++stage)
-        for (int ch = 0; ch < 2; ++ch) {
-          const int delay =
-              static_cast<int>(std::ceil(kAPDelays48k[line][stage] * srRatio));
-          lineAP[line][stage][ch].init(delay, kAPCoeff);
-          lineAP[line][stage][ch].reset();
-        }
+      const int ringFrames =
+          juce::nextPowerOfTwo(longestStageDelay + apModHeadroom + 2);
+      apStageOffset[stage] = apArenaSize;
+      apStageMask[stage] = ringFrames - 1;
+      apMaxReadDelay[stage] = static_cast<float>(ringFrames - 2);
+      apArenaSize += ringFrames * kNumLanes;
+      apLargestRing = juce::jmax(apLargestRing, ringFrames);
+    }
+    apFrames.assign(static_cast<size_t>(apArenaSize), 0.0f);
+    apWrapMask = apLargestRing - 1;
+    peakWindowLength = juce::jmax(delayMask, apWrapMask) + 1;
+    apGain = kAPCoeff;
+    targetApGain = kAPCoeff;
+    apWritePos = 0;
 
     // Compute HF damping coefficient: one-pole LPF at ~8kHz
     // Absorbs highs each recirculation (like real acoustic spaces)
@@ -283,12 +496,11 @@ struct ChaosverbFDN {
                         static_cast<float>(spec.sampleRate));
 
     // Clear damping state
-    for (int ch = 0; ch < 2; ++ch)
-      for (int i = 0; i < kNumLines; ++i)
-        dampState[ch][i] = 0.0f;
+    std::fill(std::begin(dampState), std::end(dampState), 0.0f);
 
     // Initialize shelf coefficients to unity (spectralTilt = 0)
     updateShelfCoefficients(0.0f);
+    computeShelfCoefficients(0.0f);
 
     // Initialize resonance filter coefficients
     updateResonanceCoefficients(0.0f);
@@ -297,55 +509,84 @@ struct ChaosverbFDN {
     smoothedResoGain = 0.0f;
     targetResoGain = 0.0f;
 
-    // Initialize LFO phases with evenly-spaced offsets: i * pi/4
+    // Initialize LFO phases with evenly-spaced offsets: i * 2pi / kNumLines
     for (int i = 0; i < kNumLines; ++i) {
-      lfoPhase[i] = i * (juce::MathConstants<float>::pi / 4.0f);
+      lfoPhase[i] = i * (juce::MathConstants<float>::twoPi /
+                         static_cast<float>(kNumLines));
       lfoSinCache[i] = std::sin(lfoPhase[i]);
       lfoPhaseInc[i] = 0.0f; // updated each processBlock call
     }
     lfoUpdateCounter = 0;
+    cachedModDepthSamples = -1.0f;
 
     // Clear feedback state
-    for (int ch = 0; ch < 2; ++ch)
-      for (int i = 0; i < kNumLines; ++i)
-        fdnState[ch][i] = 0.0f;
+    std::fill(std::begin(fdnState), std::end(fdnState), 0.0f);
+    rampPrimed = false;
+    clearStatePeak();
   }
 
   //--------------------------------------------------------------------------
   void reset() {
-    for (int i = 0; i < kNumLines; ++i)
-      fdnLines[i].reset();
+    std::fill(delayFrames.begin(), delayFrames.end(), 0.0f);
+    delayWritePos = 0;
 
-    for (int line = 0; line < kNumLines; ++line)
-      for (int ch = 0; ch < 2; ++ch) {
-        shelfLow[line][ch].reset();
-        shelfHigh[line][ch].reset();
-      }
-
-    for (int line = 0; line < kNumLines; ++line)
-      for (int band = 0; band < 3; ++band)
-        for (int ch = 0; ch < 2; ++ch)
-          resoFilter[line][band][ch].reset();
+    clearFilterState();
 
     smoothedResoGain = 0.0f;
     targetResoGain = 0.0f;
 
-    for (int line = 0; line < kNumLines; ++line)
-      for (int stage = 0; stage < kAPStages; ++stage)
-        for (int ch = 0; ch < 2; ++ch)
-          lineAP[line][stage][ch].reset();
+    std::fill(apFrames.begin(), apFrames.end(), 0.0f);
+    apWritePos = 0;
 
-    for (int ch = 0; ch < 2; ++ch)
-      for (int i = 0; i < kNumLines; ++i)
-        dampState[ch][i] = 0.0f;
+    std::fill(std::begin(dampState), std::end(dampState), 0.0f);
 
-    for (int i = 0; i < kNumLines; ++i)
-      lfoSinCache[i] = std::sin(lfoPhase[i]);
+    // LFOs keep their phase
     lfoUpdateCounter = 0;
+    cachedModDepthSamples = -1.0f;
+
+    std::fill(std::begin(fdnState), std::end(fdnState), 0.0f);
+    rampPrimed = false;
+    clearStatePeak();
+  }
+
+  //==========================================================================
+  /**
+   * Become an exact copy of `other`: delay lines, allpass buffers, filter
+   * and damping state, LFO phases and coefficients.
+   *
+   * Used to wake the idle FDN at crossfade start so it continues the active
+   * tail instead of starting from silence. Both instances are prepared with
+   * the same spec, so the copy happens in place without allocating.
+   */
+  void copyStateFrom(const ChaosverbFDNCore &other) {
+    if (this != &other)
+      *this = other;
+  }
 
-    for (int ch = 0; ch < 2; ++ch)
-      for (int i = 0; i < kNumLines; ++i)
-        fdnState[ch][i] = 0.0f;
+  //==========================================================================
+  /**
+   * Bytes held by this FDN after prepare(): the object itself plus the delay
+   * and allpass arenas. About 355 KB at 48kHz for the 8-line stereo network
+   * (256 KB delay frames, 96 KB allpass frames); both arenas scale with the
+   * lane count, and the rings double at 96kHz and again at 192kHz.
+   */
+  size_t getMemoryFootprintBytes() const {
+    return sizeof(*this) +
+           (delayFrames.capacity() + apFrames.capacity()) * sizeof(float);
+  }
+
+  //==========================================================================
+  /**
+   * Upper bound on the magnitudes held in the delay and allpass rings, for
+   * the silent-tail detector: the running peak of everything written into
+   * them over the last one to two ring lengths. Tracked as the rings are
+   * written, so checking it costs a pass over the lanes, not the arenas.
+   */
+  float getStatePeak() const {
+    float peak = previousWindowPeak;
+    for (int lane = 0; lane < kNumLanes; ++lane)
+      peak = std::max(peak, windowPeak[lane]);
+    return peak;
   }
 
   //==========================================================================
@@ -353,16 +594,12 @@ struct ChaosverbFDN {
    * Update in-loop allpass diffusion coefficients based on density.
    * Low density (0.0) -> sparse, comb-like reflections (g = 0.15)
    * High density (1.0) -> dense, lush wash (g = 0.85)
-   * Called at block rate from processBlock.
+   * Sets the target; the next processBlock() glides the coefficient to it.
    */
   void updateDensity(float densityNorm) {
     const float minG = 0.15f;
     const float maxG = 0.85f;
-    const float g = minG + densityNorm * (maxG - minG);
-    for (int line = 0; line < kNumLines; ++line)
-      for (int stage = 0; stage < kAPStages; ++stage)
-        for (int ch = 0; ch < 2; ++ch)
-          lineAP[line][stage][ch].g = g;
+    targetApGain = minG + densityNorm * (maxG - minG);
   }
 
   //==========================================================================
@@ -374,28 +611,12 @@ struct ChaosverbFDN {
    * spectralTilt = -100 -> lowShelfGain = 1.3, highShelfGain = 0.7
    *
    * Hard stability limit: shelf gain clamped to 0.9999.
+   *
+   * Sets the target; the next processBlock() glides the coefficients to it,
+   * recomputing them once per sub-block while they move.
    */
   void updateShelfCoefficients(float spectralTiltValue) {
     cachedSpectralTilt = spectralTiltValue;
-
-    const float t = spectralTiltValue / 100.0f; // normalised -1..+1
-
-    float highGain = 1.0f + t * 0.3f;
-    float lowGain = 1.0f - t * 0.3f;
-
-    highGain = juce::jlimit(0.001f, 0.9999f, highGain);
-    lowGain = juce::jlimit(0.001f, 0.9999f, lowGain);
-
-    auto lowShelfCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-        currentSampleRate, kShelfFreq, 1.0f / std::sqrt(2.0f), lowGain);
-    auto highShelfCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-        currentSampleRate, kShelfFreq, 1.0f / std::sqrt(2.0f), highGain);
-
-    for (int line = 0; line < kNumLines; ++line)
-      for (int ch = 0; ch < 2; ++ch) {
-        *shelfLow[line][ch].coefficients = *lowShelfCoeffs;
-        *shelfHigh[line][ch].coefficients = *highShelfCoeffs;
-      }
   }
 
   //==========================================================================
@@ -412,37 +633,8 @@ struct ChaosverbFDN {
     const float maxSafeGain = 1.0f / kResoQ;
     targetResoGain = juce::jmin(rawGain, maxSafeGain);
 
-    for (int band = 0; band < 3; ++band) {
-      auto bpCoeffs = juce::dsp::IIR::Coefficients<float>::makeBandPass(
-          currentSampleRate, kResoFreqs[band], kResoQ);
-
-      for (int line = 0; line < kNumLines; ++line)
-        for (int ch = 0; ch < 2; ++ch)
-          *resoFilter[line][band][ch].coefficients = *bpCoeffs;
-    }
-  }
-
-  //==========================================================================
-  /**
-   * Fast Hadamard Transform (in-place, butterfly, O(N log N)).
-   * N must be a power of 2. Result is normalised by 1/sqrt(N).
-   */
-  static void hadamardInPlace(float *v, int N) {
-    int h = 1;
-    while (h < N) {
-      for (int i = 0; i < N; i += h * 2) {
-        for (int j = i; j < i + h; ++j) {
-          const float a = v[j];
-          const float b = v[j + h];
-          v[j] = a + b;
-          v[j + h] = a - b;
-        }
-      }
-      h *= 2;
-    }
-    const float scale = 1.0f / std::sqrt(static_cast<float>(N));
-    for (int i = 0; i < N; ++i)
-      v[i] *= scale;
+    for (int band = 0; band < 3; ++band)
+      resoCoeffs[band].makeBandPass(currentSampleRate, kResoFreqs[band], kResoQ);
   }
 
   //==========================================================================
@@ -461,171 +653,647 @@ struct ChaosverbFDN {
       lfoPhaseInc[i] = (modRateHz * stagger / sr) * twoPi;
     }
     juce::ignoreUnused(
-        modDepthPercent); // depth is passed per-sample via processSample
+        modDepthPercent); // depth is passed per block via FDNParamSnapshot
   }
 
   //==========================================================================
   /**
-   * Process one stereo sample pair through the FDN core.
+   * Process a block of kNumChannels channels through the FDN core.
    *
-   * Called per-sample from PluginProcessor::processBlock(). The caller provides
-   * the already-pre-delayed and diffused input for each channel.
+   * The caller provides the already-pre-delayed and diffused input for each
+   * channel; out receives the FDN wet output per channel (it may not alias
+   * the inputs). The parameters glide from the ones the last call ended on
+   * (and apGain and the shelves from theirs to their targets), stepping once
+   * per sub-block and landing on params at the end of the call.
    *
-   * @param inputL            Left channel diffused input sample
-   * @param inputR            Right channel diffused input sample
-   * @param feedbackGain      Per-loop gain from T60 formula (precomputed per
-   * block)
-   * @param topologyBlend     0=diagonal, 1=full Hadamard, 2=exaggerated
-   * (precomputed)
-   * @param modDepthSamples   LFO depth in samples (precomputed per block)
-   * @param resoSmoothCoeff   One-pole smoothing coefficient for resonance gain
-   * @param outL              [output] FDN wet sample for left channel
-   * @param outR              [output] FDN wet sample for right channel
+   * Per-block decisions (topology mode, resonance gate) are made once per
+   * sub-block. Sub-blocks never exceed the feedback-safe horizon: the
+   * shortest modulated delay. Nothing written inside a sub-block can be read
+   * back inside it, so the delay-line writes are deferred to its end, where
+   * the feedback gain, tanh and input fan-in run over the whole sub-block.
    */
-  void processSample(float inputL, float inputR, float feedbackGain,
-                     float topologyBlend, float modDepthSamples,
-                     float resoSmoothCoeff, float &outL, float &outR) {
-    // -- Smooth resonance gain toward target (one-pole IIR) --
-    smoothedResoGain += (targetResoGain - smoothedResoGain) * resoSmoothCoeff;
-
-    // -- Update LFO phases at stride rate --
-    const float twoPi = juce::MathConstants<float>::twoPi;
-    if (lfoUpdateCounter == 0) {
-      for (int i = 0; i < kNumLines; ++i) {
-        lfoPhase[i] += lfoPhaseInc[i] * static_cast<float>(kLFOStride);
-        if (lfoPhase[i] >= twoPi)
-          lfoPhase[i] -= twoPi;
-        lfoSinCache[i] = std::sin(lfoPhase[i]);
-      }
+  void processBlock(const float *const *in, float *const *out,
+                    int numSamples, const FDNParamSnapshot &params) {
+    if (!rampPrimed) {
+      rampedParams = params;
+      apGain = targetApGain;
+      computeShelfCoefficients(cachedSpectralTilt);
+      rampPrimed = true;
     }
-    lfoUpdateCounter = (lfoUpdateCounter + 1) % kLFOStride;
 
-    // -- Compute per-line LFO delay offsets --
-    float lfoOffsets[kNumLines];
-    for (int i = 0; i < kNumLines; ++i)
-      lfoOffsets[i] = lfoSinCache[i] * modDepthSamples;
+    const FDNParamSnapshot from = rampedParams;
+    const float fromApGain = apGain;
+    const float fromTilt = shelfTilt;
+    const bool tiltMoving = fromTilt != cachedSpectralTilt;
+
+    // Shortest tap age that any read in this call can have
+    const float maxModDepth = std::max(std::abs(from.modDepthSamples),
+                                       std::abs(params.modDepthSamples));
+    const int horizon = static_cast<int>(minDelayLength - maxModDepth) - 1;
+    const int subBlockSize = juce::jlimit(1, kMaxSubBlock, horizon);
+
+    for (int start = 0; start < numSamples; start += subBlockSize) {
+      const int n = juce::jmin(subBlockSize, numSamples - start);
+
+      // Each sub-block runs with the values of its last sample
+      const float t =
+          static_cast<float>(start + n) / static_cast<float>(numSamples);
+      const FDNParamSnapshot step = {
+          glide(from.feedbackGain, params.feedbackGain, t),
+          glide(from.topologyBlend, params.topologyBlend, t),
+          glide(from.modDepthSamples, params.modDepthSamples, t),
+          glide(from.resoSmoothCoeff, params.resoSmoothCoeff, t)};
+      apGain = glide(fromApGain, targetApGain, t);
+      if (tiltMoving)
+        computeShelfCoefficients(glide(fromTilt, cachedSpectralTilt, t));
+
+      if (step.topologyBlend <= 0.001f)
+        processSubBlock<Topology::Diagonal>(in, out, start, n, step);
+      else if (step.topologyBlend <= 1.0f)
+        processSubBlock<Topology::Blend>(in, out, start, n, step);
+      else
+        processSubBlock<Topology::Exaggerated>(in, out, start, n, step);
+    }
 
-    // -- Process each channel through FDN core --
-    outL =
-        processFDNChannel(inputL, 0, feedbackGain, topologyBlend, lfoOffsets);
-    outR =
-        processFDNChannel(inputR, 1, feedbackGain, topologyBlend, lfoOffsets);
+    rampedParams = params;
   }
 
 private:
+  //==========================================================================
+  // from + t (to - from), landing exactly on to at the end of a glide
+  static float glide(float from, float to, float t) {
+    return t >= 1.0f ? to : from + t * (to - from);
+  }
+
+  // Shelf pair for a tilt of -100..+100 (see updateShelfCoefficients())
+  void computeShelfCoefficients(float spectralTiltValue) {
+    shelfTilt = spectralTiltValue;
+
+    const float t = spectralTiltValue / 100.0f; // normalised -1..+1
+
+    float highGain = 1.0f + t * 0.3f;
+    float lowGain = 1.0f - t * 0.3f;
+
+    highGain = juce::jlimit(0.001f, 0.9999f, highGain);
+    lowGain = juce::jlimit(0.001f, 0.9999f, lowGain);
+
+    shelfLowCoeffs.makeLowShelf(currentSampleRate, kShelfFreq,
+                                1.0f / std::sqrt(2.0f), lowGain);
+    shelfHighCoeffs.makeHighShelf(currentSampleRate, kShelfFreq,
+                                  1.0f / std::sqrt(2.0f), highGain);
+  }
+
+  //==========================================================================
+  void clearStatePeak() {
+    std::fill(std::begin(windowPeak), std::end(windowPeak), 0.0f);
+    previousWindowPeak = 0.0f;
+    windowSamples = 0;
+  }
+
+  //==========================================================================
+  void clearFilterState() {
+    std::fill(std::begin(shelfLowS1), std::end(shelfLowS1), 0.0f);
+    std::fill(std::begin(shelfLowS2), std::end(shelfLowS2), 0.0f);
+    std::fill(std::begin(shelfHighS1), std::end(shelfHighS1), 0.0f);
+    std::fill(std::begin(shelfHighS2), std::end(shelfHighS2), 0.0f);
+    std::memset(resoS1, 0, sizeof(resoS1));
+    std::memset(resoS2, 0, sizeof(resoS2));
+  }
+
+  //==========================================================================
+  // All phases in one block sin call
+  void advanceLFOs() {
+    const float twoPi = juce::MathConstants<float>::twoPi;
+    for (int i = 0; i < kNumLines; ++i) {
+      lfoPhase[i] += lfoPhaseInc[i] * static_cast<float>(kLFOStride);
+      if (lfoPhase[i] >= twoPi)
+        lfoPhase[i] -= twoPi;
+    }
+    pfs::math::sin(lfoPhase, lfoSinCache, kNumLines);
+  }
+
   //==========================================================================
   /**
-   * Process one sample through the FDN core for a single channel.
-   *
-   * Contains the full feedback path: read -> topology -> 4-stage modulated
-   * allpass -> HF damping -> spectral tilt -> resonance -> feedback gain
-   * -> tanh -> write.
+   * Recompute every modulated read position from the cached LFO values.
    *
-   * L and R channels use different prime-number delay lengths for the main
-   * FDN delay lines, producing naturally decorrelated broadband stereo.
+   * FDN lines: 4-point Lagrange taps and weights, split exactly like
+   * juce::dsp::DelayLine<Lagrange3rd> (kernel centred on the integer delay).
+   * Allpasses: linear interpolation, each stage moved by a fraction of its
+   * line's offset with alternating signs and diminishing depth.
    */
-  float processFDNChannel(float input, int channel, float feedbackGain,
-                          float topologyBlend,
-                          const float lfoDelayOffsets[kNumLines]) {
-    float *state = fdnState[channel];
+  void updateReadPositions(float modDepthSamples) {
+    cachedModDepthSamples = modDepthSamples;
 
-    // Select channel-specific delay lengths for L/R decorrelation
-    const int *dl = (channel == 0) ? delayLengthsL : delayLengthsR;
+    // Every channel's lanes follow their line's LFO
+    alignas(32) float lfoOffsets[kNumLanes];
+    for (int i = 0; i < kNumLines; ++i) {
+      lfoOffsets[i] = lfoSinCache[i] * modDepthSamples;
+      for (int ch = 1; ch < kNumChannels; ++ch)
+        lfoOffsets[ch * kNumLines + i] = lfoOffsets[i];
+    }
 
-    // --- Read current outputs from each delay line (LFO-modulated,
-    // channel-specific lengths) ---
-    float outputs[kNumLines];
-    for (int i = 0; i < kNumLines; ++i)
-      outputs[i] = fdnLines[i].popSample(channel, static_cast<float>(dl[i]) +
-                                                      lfoDelayOffsets[i]);
+    for (int lane = 0; lane < kNumLanes; ++lane) {
+      const float delay = juce::jlimit(0.0f, maxDelay[lane],
+                                       delayLength[lane] + lfoOffsets[lane]);
+      int delayInt = static_cast<int>(delay); // delay >= 0: truncation = floor
+      float f = delay - static_cast<float>(delayInt);
 
-    // --- Compute feedback from previous state via topology matrix ---
-    float fb[kNumLines];
-    for (int i = 0; i < kNumLines; ++i)
-      fb[i] = state[i];
+      // Lagrange3rd centres the kernel: taps at delayInt-1 .. delayInt+2
+      if (delayInt >= 1) {
+        f += 1.0f;
+        delayInt -= 1;
+      }
+
+      const float d1 = f - 1.0f;
+      const float d2 = f - 2.0f;
+      const float d3 = f - 3.0f;
+      delayTapAge[lane] = delayInt;
+      delayFrac[lane] = f;
+      lagrangeWeight[0][lane] = -d1 * d2 * d3 / 6.0f;
+      lagrangeWeight[1][lane] = d2 * d3 * 0.5f;
+      lagrangeWeight[2][lane] = -d1 * d3 * 0.5f;
+      lagrangeWeight[3][lane] = d1 * d2 / 6.0f;
+    }
+
+    for (int stage = 0; stage < kAPStages; ++stage)
+      for (int lane = 0; lane < kNumLanes; ++lane) {
+        const float apMod = lfoOffsets[lane] * kAPModScale;
+        const float effDelay =
+            juce::jlimit(1.0f, apMaxReadDelay[stage],
+                         apDelay[stage][lane] + apMod * kAPModMult[stage]);
+        const int intDel = static_cast<int>(effDelay);
+        apTapAge[stage][lane] = intDel;
+        apFrac[stage][lane] = effDelay - static_cast<float>(intDel);
+      }
+  }
+
+  //==========================================================================
+  // 4-point Lagrange read of every lane at the cached positions
+  void readDelayLines(float *outputs) const {
+    alignas(32) float taps[4][kNumLanes];
+    const float *frames = delayFrames.data();
+    for (int tap = 0; tap < 4; ++tap)
+      for (int lane = 0; lane < kNumLanes; ++lane) {
+        const int frame = (delayWritePos - delayTapAge[lane] - tap) & delayMask;
+        taps[tap][lane] = frames[frame * kNumLanes + lane];
+      }
+
+    for (int lane = 0; lane < kNumLanes; ++lane)
+      outputs[lane] =
+          taps[0][lane] * lagrangeWeight[0][lane] +
+          delayFrac[lane] * (taps[1][lane] * lagrangeWeight[1][lane] +
+                             taps[2][lane] * lagrangeWeight[2][lane] +
+                             taps[3][lane] * lagrangeWeight[3][lane]);
+  }
+
+  //==========================================================================
+  // Topology matrix modes, resolved once per sub-block:
+  // diagonal (pass-through, blend <= 0.001), blend towards full Hadamard
+  // (<= 1), exaggerated Hadamard (> 1, capped at 2x)
+  enum class Topology { Diagonal, Blend, Exaggerated };
+
+  // Samples [start, start + numSamples) of the processBlock() buffers
+  template <Topology mode>
+  void processSubBlock(const float *const *in, float *const *out, int start,
+                       int numSamples, const FDNParamSnapshot &params) {
+    const float modDepthSamples = params.modDepthSamples;
+    const float resoSmoothCoeff = params.resoSmoothCoeff;
+    const float topologyAmount = mode == Topology::Exaggerated
+                                     ? juce::jmin(params.topologyBlend, 2.0f)
+                                     : params.topologyBlend;
+
+    // The resonance gain glides monotonically towards its target, so the
+    // gate only needs checking per sample while the glide crosses it
+    constexpr float kResoGate = 0.0001f;
+    const bool resoAlwaysOn =
+        smoothedResoGain > kResoGate && targetResoGain > kResoGate;
+    const bool resoAlwaysOff =
+        smoothedResoGain <= kResoGate && targetResoGain <= kResoGate;
+
+    const int firstWritePos = delayWritePos;
+
+    for (int i = 0; i < numSamples; ++i) {
+      // -- Smooth resonance gain toward target (one-pole IIR) --
+      smoothedResoGain += (targetResoGain - smoothedResoGain) * resoSmoothCoeff;
+
+      // -- Update LFO phases and read positions at stride rate --
+      const bool lfoStep = lfoUpdateCounter == 0;
+      if (lfoStep)
+        advanceLFOs();
+      lfoUpdateCounter = (lfoUpdateCounter + 1) % kLFOStride;
+
+      if (lfoStep || modDepthSamples != cachedModDepthSamples)
+        updateReadPositions(modDepthSamples);
+
+      // --- Read current outputs from each delay line (LFO-modulated,
+      // channel-specific lengths) ---
+      alignas(32) float outputs[kNumLanes];
+      readDelayLines(outputs);
+      delayWritePos = (delayWritePos + 1) & delayMask;
+
+      // --- Sum each channel's delay line outputs to produce FDN wet samples
+      for (int ch = 0; ch < kNumChannels; ++ch) {
+        const float *channelOutputs = outputs + ch * kNumLines;
+        float sum = 0.0f;
+        for (int line = 0; line < kNumLines; ++line)
+          sum += channelOutputs[line];
+        out[ch][start + i] = sum * (1.0f / static_cast<float>(kReferenceLines));
+      }
+
+      // --- Compute feedback from previous state via topology matrix ---
+      alignas(32) float mixed[kNumLanes];
+      applyTopology<mode>(topologyAmount, mixed);
+      std::memcpy(fdnState, outputs, sizeof(fdnState));
+
+      // --- Modulated allpass diffusion ---
+      // Each line's allpass stages receive a fraction of the main LFO offset,
+      // with alternating signs and diminishing depth per stage.
+      // This breaks up static resonance modes that cause metallic ringing
+      // while being subtle enough to avoid audible pitch wobble (~+-2 samples
+      // max).
+      processAllpasses(mixed);
+
+      // --- HF Damping: one-pole lowpass per lane (absorbs highs each loop)
+      for (int lane = 0; lane < kNumLanes; ++lane) {
+        dampState[lane] += dampCoeff * (mixed[lane] - dampState[lane]);
+        mixed[lane] = dampState[lane];
+      }
+
+      // --- Apply Spectral Tilt: per-lane low shelf + high shelf in series ---
+      applySpectralTilt(mixed);
+
+      // --- Resonance Injector: add narrow bandpass-filtered feedback ---
+      if (resoAlwaysOn || (!resoAlwaysOff && smoothedResoGain > kResoGate))
+        applyResonance(mixed);
+
+      // --- Apply global feedback gain (tanh follows per sub-block) ---
+      for (int lane = 0; lane < kNumLanes; ++lane)
+        pendingWrites[i][lane] = mixed[lane] * params.feedbackGain;
+    }
+
+    // --- tanh saturation: every lane of every sample in one block call ---
+    pfs::math::tanh(&pendingWrites[0][0], &pendingWrites[0][0],
+                    numSamples * kNumLanes);
+
+    // --- Write new inputs to each delay line: input fan-in + feedback ---
+    const float dcOffset = 1.0e-9f; // Prevent denormal accumulation
 
-    float mixed[kNumLines];
+    for (int i = 0; i < numSamples; ++i) {
+      float *frame =
+          delayFrames.data() + ((firstWritePos + i) & delayMask) * kNumLanes;
+
+      for (int ch = 0; ch < kNumChannels; ++ch) {
+        const float scaled = in[ch][start + i] * inputScale;
+        const float *pending = pendingWrites[i] + ch * kNumLines;
+        float *channelFrame = frame + ch * kNumLines;
+        float *channelPeak = windowPeak + ch * kNumLines;
+        for (int line = 0; line < kNumLines; ++line) {
+          channelFrame[line] = scaled + pending[line] + dcOffset;
+          channelPeak[line] =
+              std::max(channelPeak[line], std::abs(channelFrame[line]));
+        }
+      }
+    }
 
-    if (topologyBlend <= 0.001f) {
-      for (int i = 0; i < kNumLines; ++i)
-        mixed[i] = fb[i];
+    windowSamples += numSamples;
+    if (windowSamples >= peakWindowLength) {
+      previousWindowPeak = 0.0f;
+      for (int lane = 0; lane < kNumLanes; ++lane)
+        previousWindowPeak = std::max(previousWindowPeak, windowPeak[lane]);
+      std::fill(std::begin(windowPeak), std::end(windowPeak), 0.0f);
+      windowSamples = 0;
+    }
+  }
+
+  //==========================================================================
+  // Topology matrix over the previous outputs (fdnState): Hadamard over each
+  // channel's lines, then (beyond stereo) Householder across channels.
+  // amount is the blend t, or the exaggeration factor.
+  template <Topology mode>
+  void applyTopology(float amount, float *mixed) const {
+    if constexpr (mode == Topology::Diagonal) {
+      juce::ignoreUnused(amount);
+      std::memcpy(mixed, fdnState, sizeof(fdnState));
     } else {
-      float hadOut[kNumLines];
-      for (int i = 0; i < kNumLines; ++i)
-        hadOut[i] = fb[i];
-      hadamardInPlace(hadOut, kNumLines);
-
-      if (topologyBlend <= 1.0f) {
-        const float t = topologyBlend;
-        for (int i = 0; i < kNumLines; ++i)
-          mixed[i] = fb[i] * (1.0f - t) + hadOut[i] * t;
+      alignas(32) float hadOut[kNumLanes];
+      std::memcpy(hadOut, fdnState, sizeof(fdnState));
+      for (int ch = 0; ch < kNumChannels; ++ch)
+        hadamard(hadOut + ch * kNumLines);
+      if constexpr (kNumChannels > 2)
+        householderAcrossChannels(hadOut);
+
+      if constexpr (mode == Topology::Blend) {
+        for (int lane = 0; lane < kNumLanes; ++lane)
+          mixed[lane] = fdnState[lane] * (1.0f - amount) + hadOut[lane] * amount;
       } else {
-        const float exaggeration = juce::jmin(topologyBlend, 2.0f);
-        for (int i = 0; i < kNumLines; ++i)
-          mixed[i] = hadOut[i] * exaggeration;
+        for (int lane = 0; lane < kNumLanes; ++lane)
+          mixed[lane] = hadOut[lane] * amount;
       }
     }
+  }
 
-    // --- 4-stage modulated allpass diffusion ---
-    // Each line's allpass stages receive a fraction of the main LFO offset,
-    // with alternating signs and diminishing depth per stage.
-    // This breaks up static resonance modes that cause metallic ringing
-    // while being subtle enough to avoid audible pitch wobble (~+-2 samples
-    // max).
-    for (int i = 0; i < kNumLines; ++i) {
-      const float apMod = lfoDelayOffsets[i] * kAPModScale;
-      for (int s = 0; s < kAPStages; ++s)
-        mixed[i] = lineAP[i][s][channel].processModulated(
-            mixed[i], apMod * kAPModMult[s]);
+  // Per-lane low shelf then high shelf, clamped for loop stability
+  void applySpectralTilt(float *mixed) {
+    const auto &lo = shelfLowCoeffs;
+    const auto &hi = shelfHighCoeffs;
+    for (int lane = 0; lane < kNumLanes; ++lane) {
+      const float x = mixed[lane];
+      const float y = lo.b0 * x + shelfLowS1[lane];
+      shelfLowS1[lane] = lo.b1 * x - lo.a1 * y + shelfLowS2[lane];
+      shelfLowS2[lane] = lo.b2 * x - lo.a2 * y;
+
+      const float z = hi.b0 * y + shelfHighS1[lane];
+      shelfHighS1[lane] = hi.b1 * y - hi.a1 * z + shelfHighS2[lane];
+      shelfHighS2[lane] = hi.b2 * y - hi.a2 * z;
+
+      mixed[lane] = juce::jlimit(-0.9999f, 0.9999f, z);
     }
+  }
 
-    // --- HF Damping: one-pole lowpass per line (absorbs highs each loop) ---
-    for (int i = 0; i < kNumLines; ++i) {
-      dampState[channel][i] += dampCoeff * (mixed[i] - dampState[channel][i]);
-      mixed[i] = dampState[channel][i];
+  // Sum of the 3 bandpasses, scaled by the smoothed gain, added to each lane
+  void applyResonance(float *mixed) {
+    alignas(32) float resoSum[kNumLanes] = {};
+    for (int band = 0; band < 3; ++band) {
+      const auto &c = resoCoeffs[band];
+      float *s1 = resoS1[band];
+      float *s2 = resoS2[band];
+      for (int lane = 0; lane < kNumLanes; ++lane) {
+        const float x = mixed[lane];
+        const float y = c.b0 * x + s1[lane];
+        s1[lane] = c.b1 * x - c.a1 * y + s2[lane];
+        s2[lane] = c.b2 * x - c.a2 * y;
+        resoSum[lane] += y;
+      }
     }
 
-    // --- Apply Spectral Tilt: per-line low shelf + high shelf in series ---
-    for (int i = 0; i < kNumLines; ++i) {
-      float s = shelfLow[i][channel].processSample(mixed[i]);
-      s = shelfHigh[i][channel].processSample(s);
-      mixed[i] = juce::jlimit(-0.9999f, 0.9999f, s);
-    }
+    for (int lane = 0; lane < kNumLanes; ++lane)
+      mixed[lane] +=
+          juce::jlimit(-0.9999f, 0.9999f, resoSum[lane] * smoothedResoGain);
+  }
 
-    // --- Resonance Injector: add narrow bandpass-filtered feedback ---
-    if (smoothedResoGain > 0.0001f) {
-      for (int i = 0; i < kNumLines; ++i) {
-        float resoSum = 0.0f;
-        for (int band = 0; band < 3; ++band)
-          resoSum += resoFilter[i][band][channel].processSample(mixed[i]);
+  /**
+   * kNumLines-point Fast Hadamard Transform (in place, log2(kNumLines)
+   * butterfly stages), normalised by 1/sqrt(kNumLines). Fixed size, so it
+   * stays in registers.
+   */
+  static void hadamard(float *v) {
+    for (int h = 1; h < kNumLines; h *= 2)
+      for (int i = 0; i < kNumLines; i += h * 2)
+        for (int j = i; j < i + h; ++j) {
+          const float a = v[j];
+          const float b = v[j + h];
+          v[j] = a + b;
+          v[j + h] = a - b;
+        }
+
+    const float scale = 1.0f / std::sqrt(static_cast<float>(kNumLines));
+    for (int i = 0; i < kNumLines; ++i)
+      v[i] *= scale;
+  }
+
+  /**
+   * I - (2 / kNumChannels) * 1 1^T applied across channels, line by line:
+   * each lane loses twice the mean of its line over all channels. Orthogonal
+   * at any channel count, and O(lanes).
+   */
+  static void householderAcrossChannels(float *v) {
+    alignas(32) float lineSum[kNumLines] = {};
+    for (int ch = 0; ch < kNumChannels; ++ch)
+      for (int line = 0; line < kNumLines; ++line)
+        lineSum[line] += v[ch * kNumLines + line];
 
-        mixed[i] += juce::jlimit(-0.9999f, 0.9999f, resoSum * smoothedResoGain);
+    const float scale = 2.0f / static_cast<float>(kNumChannels);
+    for (int ch = 0; ch < kNumChannels; ++ch)
+      for (int line = 0; line < kNumLines; ++line)
+        v[ch * kNumLines + line] -= scale * lineSum[line];
+  }
+
+  //==========================================================================
+  // Modulated allpass with linear interpolation at the cached positions,
+  // one stage at a time across all lanes.
+  void processAllpasses(float *mixed) {
+    const float g = apGain;
+    const int writePos = apWritePos;
+
+    // Work on local copies: stores to them cannot alias the member arrays,
+    // so the lane loops vectorise without runtime overlap checks
+    alignas(32) float x[kNumLanes];
+    std::memcpy(x, mixed, sizeof(x));
+
+    for (int stage = 0; stage < kAPStages; ++stage) {
+      float *ring = apFrames.data() + apStageOffset[stage];
+      const int mask = apStageMask[stage];
+      const int *age = apTapAge[stage];
+      const float *frac = apFrac[stage];
+
+      alignas(32) float tap0[kNumLanes];
+      alignas(32) float tap1[kNumLanes];
+      for (int lane = 0; lane < kNumLanes; ++lane) {
+        const int r0 = writePos - age[lane];
+        tap0[lane] = ring[(r0 & mask) * kNumLanes + lane];
+        tap1[lane] = ring[((r0 - 1) & mask) * kNumLanes + lane];
       }
+
+      alignas(32) float v[kNumLanes];
+      for (int lane = 0; lane < kNumLanes; ++lane) {
+        const float delayed = tap0[lane] + frac[lane] * (tap1[lane] - tap0[lane]);
+        v[lane] = x[lane] - g * delayed;
+        x[lane] = delayed + g * v[lane];
+        windowPeak[lane] = std::max(windowPeak[lane], std::abs(v[lane]));
+      }
+      std::memcpy(ring + (writePos & mask) * kNumLanes, v, sizeof(v));
     }
 
-    // --- Apply global feedback gain and tanh saturation ---
-    for (int i = 0; i < kNumLines; ++i) {
-      mixed[i] *= feedbackGain;
-      mixed[i] = std::tanh(mixed[i]);
+    std::memcpy(mixed, x, sizeof(x));
+
+    apWritePos = (writePos + 1) & apWrapMask;
+  }
+};
+
+//==============================================================================
+/**
+ * ChaosverbFDN
+ *
+ * One FDN of the quality tier and channel layout chosen at prepare() time:
+ *
+ *   Eco      4 lines, 2 allpass stages  — lightest live engine
+ *   Normal   8 lines, 4 allpass stages  — the original Chaosverb network
+ *   High    16 lines, 4 allpass stages
+ *   Offline 32 lines, 6 allpass stages  — final renders
+ *
+ * per output channel, for 2 (mono and stereo), 6 (5.1) or 12 (7.1.4)
+ * channels. Every tier reads its delay lines with the same 4-point Lagrange
+ * kernel. Switching tier or layout reallocates, so prepare() must not run on
+ * the audio thread of a realtime stream. Each call below is resolved to the
+ * prepared core once, and the per-sample work happens inside it.
+ */
+class ChaosverbFDN {
+public:
+  template <int NumChannels> struct Cores {
+    using Eco = ChaosverbFDNCore<4, 2, NumChannels>;
+    using Normal = ChaosverbFDNCore<8, 4, NumChannels>;
+    using High = ChaosverbFDNCore<16, 4, NumChannels>;
+    using Offline = ChaosverbFDNCore<32, 6, NumChannels>;
+  };
+
+  // Widest layout (7.1.4)
+  static constexpr int kMaxChannels = 12;
+
+  // Network channel count for a bus of numChannels: 2, 6 or 12
+  static int getCoreChannels(int numChannels) {
+    if (numChannels > 6)
+      return 12;
+    return numChannels > 2 ? 6 : 2;
+  }
+
+private:
+  // std::get_if rather than std::visit: std::visit needs macOS 10.14
+  template <int NumChannels, typename Self, typename Fn>
+  static decltype(auto) visitTier(Self &self, Fn &&fn) {
+    using C = Cores<NumChannels>;
+    switch (self.quality) {
+    case FDNQuality::Eco:
+      return fn(*std::get_if<typename C::Eco>(&self.core));
+    case FDNQuality::High:
+      return fn(*std::get_if<typename C::High>(&self.core));
+    case FDNQuality::Offline:
+      return fn(*std::get_if<typename C::Offline>(&self.core));
+    case FDNQuality::Normal:
+      break;
     }
+    return fn(*std::get_if<typename C::Normal>(&self.core));
+  }
 
-    // --- Write new inputs to each delay line: input fan-in + feedback ---
-    const float inputScale = 1.0f / static_cast<float>(kNumLines);
-    const float dcOffset = 1.0e-9f; // Prevent denormal accumulation
+  template <typename Self, typename Fn>
+  static decltype(auto) visitCore(Self &self, Fn &&fn) {
+    switch (self.numChannels) {
+    case 6:
+      return visitTier<6>(self, fn);
+    case 12:
+      return visitTier<12>(self, fn);
+    default:
+      break;
+    }
+    return visitTier<2>(self, fn);
+  }
 
-    for (int i = 0; i < kNumLines; ++i)
-      fdnLines[i].pushSample(channel, input * inputScale + mixed[i] + dcOffset);
+  template <typename Fn> decltype(auto) visitCore(Fn &&fn) {
+    return visitCore(*this, std::forward<Fn>(fn));
+  }
 
-    // --- Update state with freshly read outputs ---
-    float fdnOut = 0.0f;
-    for (int i = 0; i < kNumLines; ++i) {
-      state[i] = outputs[i];
-      fdnOut += outputs[i];
+  template <typename Fn> decltype(auto) visitCore(Fn &&fn) const {
+    return visitCore(*this, std::forward<Fn>(fn));
+  }
+
+  template <int NumChannels> void emplaceCore() {
+    using C = Cores<NumChannels>;
+    switch (quality) {
+    case FDNQuality::Eco:
+      core.emplace<typename C::Eco>();
+      break;
+    case FDNQuality::Normal:
+      core.emplace<typename C::Normal>();
+      break;
+    case FDNQuality::High:
+      core.emplace<typename C::High>();
+      break;
+    case FDNQuality::Offline:
+      core.emplace<typename C::Offline>();
+      break;
+    }
+  }
+
+public:
+  // spec.numChannels picks the layout (see getCoreChannels())
+  void prepare(const juce::dsp::ProcessSpec &spec, FDNQuality newQuality) {
+    const int newChannels =
+        getCoreChannels(static_cast<int>(spec.numChannels));
+    if (newQuality != quality || newChannels != numChannels) {
+      quality = newQuality;
+      numChannels = newChannels;
+      if (numChannels == 12)
+        emplaceCore<12>();
+      else if (numChannels == 6)
+        emplaceCore<6>();
+      else
+        emplaceCore<2>();
     }
+    visitCore([&spec](auto &fdn) { fdn.prepare(spec); });
+  }
+
+  FDNQuality getQuality() const { return quality; }
+
+  // Channels processBlock() reads and writes: 2, 6 or 12
+  int getNumChannels() const { return numChannels; }
+
+  void reset() {
+    visitCore([](auto &fdn) { fdn.reset(); });
+  }
+
+  // Both instances must be prepared with the same spec and tier
+  void copyStateFrom(const ChaosverbFDN &other) {
+    jassert(other.quality == quality && other.numChannels == numChannels);
+    if (this != &other)
+      core = other.core;
+  }
+  size_t getMemoryFootprintBytes() const {
+    return visitCore([](const auto &fdn) {
+      return sizeof(ChaosverbFDN) - sizeof(fdn) + fdn.getMemoryFootprintBytes();
+    });
+  }
+
+  float getStatePeak() const {
+    return visitCore([](const auto &fdn) { return fdn.getStatePeak(); });
+  }
+
+  //==========================================================================
+  void updateDensity(float densityNorm) {
+    visitCore([=](auto &fdn) { fdn.updateDensity(densityNorm); });
+  }
+
+  void updateShelfCoefficients(float spectralTiltValue) {
+    visitCore([=](auto &fdn) { fdn.updateShelfCoefficients(spectralTiltValue); });
+  }
+
+  void updateResonanceCoefficients(float resonanceValue) {
+    visitCore(
+        [=](auto &fdn) { fdn.updateResonanceCoefficients(resonanceValue); });
+  }
 
-    // --- Sum all delay line outputs to produce FDN wet sample ---
-    fdnOut *= (1.0f / static_cast<float>(kNumLines));
+  void prepareLFO(float modRateHz, float modDepthPercent) {
+    visitCore([=](auto &fdn) { fdn.prepareLFO(modRateHz, modDepthPercent); });
+  }
+
+  float getCachedSpectralTilt() const {
+    return visitCore([](const auto &fdn) { return fdn.cachedSpectralTilt; });
+  }
 
-    return fdnOut;
+  float getCachedResonance() const {
+    return visitCore([](const auto &fdn) { return fdn.cachedResonance; });
   }
+
+  float getMaxLFODepthSamples() const {
+    return visitCore([](const auto &fdn) { return fdn.maxLFODepthSamples; });
+  }
+
+  // Mean of the SR-scaled delay lengths, for the decay (T60) mapping
+  float getMeanDelaySamples() const {
+    return visitCore([](const auto &fdn) { return fdn.meanDelaySamples; });
+  }
+
+  // in and out hold getNumChannels() channel pointers
+  void processBlock(const float *const *in, float *const *out,
+                    int numSamples, const FDNParamSnapshot &params) {
+    visitCore(
+        [&](auto &fdn) { fdn.processBlock(in, out, numSamples, params); });
+  }
+
+private:
+  std::variant<Cores<2>::Normal, Cores<2>::Eco, Cores<2>::High,
+               Cores<2>::Offline, Cores<6>::Normal, Cores<6>::Eco,
+               Cores<6>::High, Cores<6>::Offline, Cores<12>::Normal,
+               Cores<12>::Eco, Cores<12>::High, Cores<12>::Offline>
+      core;
+  FDNQuality quality = FDNQuality::Normal;
+  int numChannels = 2;
 };
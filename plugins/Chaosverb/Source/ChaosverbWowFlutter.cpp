@@ -6,41 +6,44 @@ ChaosverbWowFlutter::ChaosverbWowFlutter() = default;
 
 void ChaosverbWowFlutter::prepare(const juce::dsp::ProcessSpec &spec) {
   currentSampleRate = spec.sampleRate;
+  numChannels =
+      juce::jlimit(1, kMaxChannels, static_cast<int>(spec.numChannels));
 
-  juce::dsp::ProcessSpec monoSpec{spec.sampleRate, spec.maximumBlockSize, 1};
+  juce::dsp::ProcessSpec channelSpec{spec.sampleRate, spec.maximumBlockSize,
+                                     static_cast<juce::uint32>(numChannels)};
 
   // Max 6ms (3ms center + 3ms modulation) — reduced for subtlety
   const int maxWfDelaySamples =
       static_cast<int>(std::ceil(0.006 * spec.sampleRate)) + 1;
 
-  wfDelayLineL.prepare(monoSpec);
-  wfDelayLineL.setMaximumDelayInSamples(maxWfDelaySamples);
-  wfDelayLineL.setDelay(0.0f);
-  wfDelayLineL.reset();
-
-  wfDelayLineR.prepare(monoSpec);
-  wfDelayLineR.setMaximumDelayInSamples(maxWfDelaySamples);
-  wfDelayLineR.setDelay(0.0f);
-  wfDelayLineR.reset();
+  wfDelayLine.prepare(channelSpec);
+  wfDelayLine.setMaximumDelayInSamples(maxWfDelaySamples);
+  wfDelayLine.setDelay(0.0f);
+  wfDelayLine.reset();
 
   wfAmountSmoother.reset(currentSampleRate, 0.10); // 100ms smoothing for zipper-free sweeps
 
-  // Reset wow/flutter LFO phases (R channels offset by pi/2 for stereo)
-  wfWowPhaseL = 0.0f;
-  wfWowPhaseR = juce::MathConstants<float>::halfPi;
-  wfFlutterPhaseL = 0.0f;
-  wfFlutterPhaseR = juce::MathConstants<float>::halfPi;
+  // Reset wow/flutter LFO phases: channel c starts c * pi/2 in (R offset
+  // by pi/2 for stereo), nudged by pi/6 per group of four so no two of a
+  // 7.1.4 bed share a phase
+  const float halfPi = juce::MathConstants<float>::halfPi;
+  const float twoPi = juce::MathConstants<float>::twoPi;
+  for (int ch = 0; ch < kMaxChannels; ++ch) {
+    const float offset =
+        static_cast<float>(ch % 4) * halfPi +
+        static_cast<float>(ch / 4) * (juce::MathConstants<float>::pi / 6.0f);
+    wfWowPhase[static_cast<size_t>(ch)] = std::fmod(offset, twoPi);
+    wfFlutterPhase[static_cast<size_t>(ch)] = std::fmod(offset, twoPi);
+  }
 }
 
 void ChaosverbWowFlutter::reset() {
-  wfDelayLineL.reset();
-  wfDelayLineR.reset();
+  wfDelayLine.reset();
 }
 
-void ChaosverbWowFlutter::process(int numSamples, float *dataL, float *dataR,
-                                  float wfAmount, bool wfEnabled) {
-  if (dataL == nullptr || dataR == nullptr)
-    return;
+bool ChaosverbWowFlutter::beginBlock(int numSamples, float wfAmount,
+                                     bool wfEnabled) {
+  jassert(numSamples <= kMaxRampSize);
 
   // Always update smoother target — even when disabled/zero — so transitions
   // ramp smoothly instead of snapping when re-enabled.
@@ -49,8 +52,14 @@ void ChaosverbWowFlutter::process(int numSamples, float *dataL, float *dataR,
 
   // Skip processing only when smoother has fully settled at zero
   if (!wfAmountSmoother.isSmoothing() && targetAmount < 0.0001f)
-    return;
+    return false;
+
+  for (int n = 0; n < numSamples; ++n)
+    wfAmountRamp[static_cast<size_t>(n)] = wfAmountSmoother.getNextValue();
+  return true;
+}
 
+void ChaosverbWowFlutter::processFrame(int n, float *frame) {
   const float sr = static_cast<float>(currentSampleRate);
   const float maxDepthMs = 2.0f; // reduced from 5ms for subtlety
 
@@ -58,42 +67,32 @@ void ChaosverbWowFlutter::process(int numSamples, float *dataL, float *dataR,
   // Center delay: always at max depth so modulation stays within buffer
   const float centerDelay = maxDepthMs * 0.001f * sr;
 
-  for (int n = 0; n < numSamples; ++n) {
-    const float wfNorm = wfAmountSmoother.getNextValue();
-    const float depthSamples = wfNorm * maxDepthMs * 0.001f * sr;
-
-    // Wow: slow, deep pitch drift (tape transport instability)
-    // Flutter: fast, shallow pitch wobble (head vibration)
-    const float wowRate = 0.3f + wfNorm * 0.8f;     // 0.3–1.1 Hz
-    const float flutterRate = 5.0f + wfNorm * 6.0f; // 5–11 Hz
-
-    const float wowInc = twoPi * wowRate / sr;
-    const float flutterInc = twoPi * flutterRate / sr;
-
-    const float modL = depthSamples * (0.7f * std::sin(wfWowPhaseL) +
-                                       0.3f * std::sin(wfFlutterPhaseL));
-    const float modR = depthSamples * (0.7f * std::sin(wfWowPhaseR) +
-                                       0.3f * std::sin(wfFlutterPhaseR));
-
-    // Separate L/R delay lines — guarantees full stereo independence
-    wfDelayLineL.pushSample(0, dataL[n]);
-    wfDelayLineR.pushSample(0, dataR[n]);
-    dataL[n] = wfDelayLineL.popSample(0, juce::jmax(1.0f, centerDelay + modL));
-    dataR[n] = wfDelayLineR.popSample(0, juce::jmax(1.0f, centerDelay + modR));
-
-    wfWowPhaseL += wowInc;
-    wfWowPhaseR += wowInc;
-    wfFlutterPhaseL += flutterInc;
-    wfFlutterPhaseR += flutterInc;
-
-    if (wfWowPhaseL >= twoPi)
-      wfWowPhaseL -= twoPi;
-    if (wfWowPhaseR >= twoPi)
-      wfWowPhaseR -= twoPi;
-    if (wfFlutterPhaseL >= twoPi)
-      wfFlutterPhaseL -= twoPi;
-    if (wfFlutterPhaseR >= twoPi)
-      wfFlutterPhaseR -= twoPi;
+  const float wfNorm = wfAmountRamp[static_cast<size_t>(n)];
+  const float depthSamples = wfNorm * maxDepthMs * 0.001f * sr;
+
+  // Wow: slow, deep pitch drift (tape transport instability)
+  // Flutter: fast, shallow pitch wobble (head vibration)
+  const float wowRate = 0.3f + wfNorm * 0.8f;     // 0.3–1.1 Hz
+  const float flutterRate = 5.0f + wfNorm * 6.0f; // 5–11 Hz
+
+  const float wowInc = twoPi * wowRate / sr;
+  const float flutterInc = twoPi * flutterRate / sr;
+
+  for (int ch = 0; ch < numChannels; ++ch) {
+    float &wowPhase = wfWowPhase[static_cast<size_t>(ch)];
+    float &flutterPhase = wfFlutterPhase[static_cast<size_t>(ch)];
+
+    const float mod = depthSamples * (0.7f * std::sin(wowPhase) +
+                                      0.3f * std::sin(flutterPhase));
+    wfDelayLine.pushSample(ch, frame[ch]);
+    frame[ch] = wfDelayLine.popSample(ch, juce::jmax(1.0f, centerDelay + mod));
+
+    wowPhase += wowInc;
+    flutterPhase += flutterInc;
+    if (wowPhase >= twoPi)
+      wowPhase -= twoPi;
+    if (flutterPhase >= twoPi)
+      flutterPhase -= twoPi;
   }
 }
 
@@ -2,6 +2,8 @@
 
 #include <juce_dsp/juce_dsp.h>
 
+#include <array>
+
 namespace nbs {
 
 class ChaosverbWowFlutter {
@@ -12,26 +14,35 @@ public:
   void prepare(const juce::dsp::ProcessSpec &spec);
   void reset();
 
-  // Processes an interleaved stereo block (in-place)
-  void process(int numSamples, float *dataL, float *dataR, float wfAmount,
-               bool wfEnabled);
+  // Advances the amount smoother over the next numSamples (at most
+  // kMaxRampSize). False once it has settled at zero: processFrame() is then
+  // skipped for the block and the LFOs hold still.
+  bool beginBlock(int numSamples, float wfAmount, bool wfEnabled);
+
+  // Processes sample n of the block in place; frame holds one sample of each
+  // of the spec's channels
+  void processFrame(int n, float *frame);
+
+  // Widest layout (7.1.4)
+  static constexpr int kMaxChannels = 12;
+  static constexpr int kMaxRampSize = 256;
 
 private:
   double currentSampleRate = 48000.0;
+  int numChannels = 2;
 
+  // One delay line per channel — guarantees full channel independence
   juce::dsp::DelayLine<float,
                        juce::dsp::DelayLineInterpolationTypes::Lagrange3rd>
-      wfDelayLineL;
-  juce::dsp::DelayLine<float,
-                       juce::dsp::DelayLineInterpolationTypes::Lagrange3rd>
-      wfDelayLineR;
+      wfDelayLine;
 
   juce::SmoothedValue<float> wfAmountSmoother;
+  std::array<float, kMaxRampSize> wfAmountRamp{};
 
-  float wfWowPhaseL = 0.0f;
-  float wfWowPhaseR = 1.5707963f; // pi/2 offset for stereo decorrelation
-  float wfFlutterPhaseL = 0.0f;
-  float wfFlutterPhaseR = 1.5707963f;
+  // LFO phases per channel: R is pi/2 ahead of L for stereo decorrelation,
+  // and further channels keep stepping by pi/2 (see prepare())
+  std::array<float, kMaxChannels> wfWowPhase{};
+  std::array<float, kMaxChannels> wfFlutterPhase{};
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ChaosverbWowFlutter)
 };
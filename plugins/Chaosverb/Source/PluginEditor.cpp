@@ -2,6 +2,45 @@
 #include "PluginProcessor.h"
 #include "BinaryData.h"
 
+//==============================================================================
+namespace
+{
+    // "cpu_profile" payload: mean load per stage as % of the buffer deadline,
+    // plus whatever processBlock spent outside the instrumented stages.
+    juce::var makeProfileEvent (const pfs::StageProfiler& profiler,
+                                const pfs::ProfileSummary& summary)
+    {
+        juce::Array<juce::var> stages;
+        double stagedNs = 0.0;
+
+        for (int stage = 0; stage < profiler.getNumStages(); ++stage)
+        {
+            const double stageNs = summary.meanStageNs[static_cast<size_t> (stage)];
+            stagedNs += stageNs;
+
+            auto entry = std::make_unique<juce::DynamicObject>();
+            entry->setProperty ("name", profiler.getStageName (stage));
+            entry->setProperty ("load", summary.getStageLoad (stage) * 100.0);
+            entry->setProperty ("us", stageNs * 1.0e-3);
+            stages.add (juce::var (entry.release()));
+        }
+
+        const double otherNs = juce::jmax (0.0, summary.meanBlockNs - stagedNs);
+
+        auto data = std::make_unique<juce::DynamicObject>();
+        data->setProperty ("blocks", summary.numBlocks);
+        data->setProperty ("dropped", summary.numDropped);
+        data->setProperty ("deadlineUs", summary.meanDeadlineNs * 1.0e-3);
+        data->setProperty ("load", summary.getLoad() * 100.0);
+        data->setProperty ("peakLoad", summary.peakBlockLoad * 100.0);
+        data->setProperty ("otherLoad", summary.meanDeadlineNs > 0.0
+                                            ? otherNs / summary.meanDeadlineNs * 100.0
+                                            : 0.0);
+        data->setProperty ("stages", stages);
+        return juce::var (data.release());
+    }
+}
+
 //==============================================================================
 ChaosverbAudioProcessorEditor::ChaosverbAudioProcessorEditor (ChaosverbAudioProcessor& p)
     : AudioProcessorEditor (&p), processorRef (p)
@@ -119,6 +158,11 @@ ChaosverbAudioProcessorEditor::ChaosverbAudioProcessorEditor (ChaosverbAudioProc
                 obj->setProperty ("running",     processorRef.isMutationTimerRunning());
                 complete (juce::var (obj));
             })
+            .withNativeFunction ("exportIR", [this] (const juce::Array<juce::var>&,
+                                                      std::function<void (juce::var)> complete)
+            {
+                exportImpulseResponse (std::move (complete));
+            })
     );
 
     // =========================================================================
@@ -216,10 +260,18 @@ ChaosverbAudioProcessorEditor::ChaosverbAudioProcessorEditor (ChaosverbAudioProc
     setResizable (true, true);
     setResizeLimits (630, 266, 1800, 760);
     getConstrainer()->setFixedAspectRatio (900.0 / 380.0);
+
+    // =========================================================================
+    // STEP 6: CPU meter (profiling builds only — nothing to drain otherwise)
+    // =========================================================================
+    if constexpr (pfs::StageProfiler::isEnabled())
+        startTimerHz (10);
 }
 
 ChaosverbAudioProcessorEditor::~ChaosverbAudioProcessorEditor()
 {
+    stopTimer();
+
     // Destruction order is automatic — reverse of declaration order in .h file:
     // 1. Attachments destroyed first (call evaluateJavascript — webView still alive)
     // 2. WebView destroyed second (attachments already gone)
@@ -228,6 +280,33 @@ ChaosverbAudioProcessorEditor::~ChaosverbAudioProcessorEditor()
     // No explicit cleanup needed. std::unique_ptr handles everything correctly.
 }
 
+//==============================================================================
+void ChaosverbAudioProcessorEditor::timerCallback()
+{
+    const auto summary = processorRef.profiler.drain();
+    if (summary.numBlocks > 0)
+        webView->emitEventIfBrowserIsVisible ("cpu_profile",
+                                              makeProfileEvent (processorRef.profiler, summary));
+}
+
+//==============================================================================
+void ChaosverbAudioProcessorEditor::exportImpulseResponse (std::function<void (juce::var)> complete)
+{
+    const auto defaultFile = juce::File::getSpecialLocation (juce::File::userDocumentsDirectory)
+                                 .getChildFile ("Chaosverb IR.wav");
+    irFileChooser = std::make_unique<juce::FileChooser> ("Export Impulse Response", defaultFile, "*.wav");
+
+    const auto flags = juce::FileBrowserComponent::saveMode
+                     | juce::FileBrowserComponent::canSelectFiles
+                     | juce::FileBrowserComponent::warnAboutOverwriting;
+
+    irFileChooser->launchAsync (flags, [this, complete] (const juce::FileChooser& chooser)
+    {
+        const auto file = chooser.getResult();
+        complete (juce::var (file != juce::File() && processorRef.exportBakedIR (file)));
+    });
+}
+
 //==============================================================================
 void ChaosverbAudioProcessorEditor::paint (juce::Graphics& g)
 {
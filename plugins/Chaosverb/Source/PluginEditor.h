@@ -15,8 +15,16 @@ class ChaosverbAudioProcessor;
  * - 15 WebToggleButtonRelay / WebToggleButtonParameterAttachment (bool params)
  *
  * Window size: 960 x 400 (resizable with fixed aspect ratio)
+ *
+ * CPU meter: with -DPFS_PROFILING=ON a 10 Hz timer drains the processor's
+ * stage profiler and emits "cpu_profile" to the WebView. Without it the
+ * timer is never started.
+ *
+ * exportIR: native function that saves the last baked impulse response to a
+ * WAV picked in a save dialog; completes with true once written.
  */
-class ChaosverbAudioProcessorEditor : public juce::AudioProcessorEditor
+class ChaosverbAudioProcessorEditor : public juce::AudioProcessorEditor,
+                                      private juce::Timer
 {
 public:
     explicit ChaosverbAudioProcessorEditor (ChaosverbAudioProcessor&);
@@ -27,10 +35,18 @@ public:
     void resized() override;
 
 private:
+    // juce::Timer — per-stage CPU breakdown to the WebView (profiling builds)
+    void timerCallback() override;
+
+    // Save dialog for the exportIR native function
+    void exportImpulseResponse (std::function<void (juce::var)> complete);
+
     //==========================================================================
     // Reference to processor
     ChaosverbAudioProcessor& processorRef;
 
+    std::unique_ptr<juce::FileChooser> irFileChooser;
+
     //==========================================================================
     // CRITICAL MEMBER DECLARATION ORDER
     // Members are destroyed in REVERSE order of declaration.
@@ -2,7 +2,7 @@
 #include "PluginEditor.h"
 
 //==============================================================================
-// Parameter layout — 22 parameters: 12 Float + 10 Bool
+// Parameter layout — 39 parameters: 18 Float + 19 Bool + 2 Choice
 // JUCE 8 requires juce::ParameterID { "id", 1 } format (not bare strings)
 //==============================================================================
 juce::AudioProcessorValueTreeState::ParameterLayout
@@ -226,6 +226,27 @@ ChaosverbAudioProcessor::createParameterLayout() {
   layout.add(std::make_unique<juce::AudioParameterBool>(
       juce::ParameterID{"bypass", 1}, "Bypass", false));
 
+  // -------------------------------------------------------------------------
+  // Choice parameters (2) — FDN quality tiers (see FDNQuality)
+  // -------------------------------------------------------------------------
+
+  // quality — network size while playing live (default Normal: 8 lines)
+  layout.add(std::make_unique<juce::AudioParameterChoice>(
+      juce::ParameterID{"quality", 1}, "Quality",
+      juce::StringArray{"Eco", "Normal", "High", "Offline"}, 1));
+
+  // renderQuality — network size for non-realtime renders (default Offline)
+  layout.add(std::make_unique<juce::AudioParameterChoice>(
+      juce::ParameterID{"renderQuality", 1}, "Render Quality",
+      juce::StringArray{"High", "Offline"}, 1));
+
+  // -------------------------------------------------------------------------
+  // Baked IR mode (1) — convolve a rendered FDN response while static
+  // -------------------------------------------------------------------------
+
+  layout.add(std::make_unique<juce::AudioParameterBool>(
+      juce::ParameterID{"bakedIR", 1}, "Baked IR", false));
+
   return layout;
 }
 
@@ -256,13 +277,38 @@ ChaosverbAudioProcessor::ChaosverbAudioProcessor()
   outputLevelParam = parameters.getRawParameterValue("outputLevel");
   duckingAmountParam = parameters.getRawParameterValue("duckingAmount");
   bypassParam = parameters.getRawParameterValue("bypass");
+  qualityParam = parameters.getRawParameterValue("quality");
+  renderQualityParam = parameters.getRawParameterValue("renderQuality");
+  bakedIRParam = parameters.getRawParameterValue("bakedIR");
+
+  mutationIntervalParam = parameters.getRawParameterValue("mutationInterval");
+
+  for (size_t i = 0; i < kMorphParamIDs.size(); ++i) {
+    morphParams[i] = parameters.getParameter(kMorphParamIDs[i].param);
+    morphLockParams[i] =
+        parameters.getRawParameterValue(kMorphParamIDs[i].lock);
+  }
+
+  mutationSeed.store(static_cast<std::uint64_t>(pfs::nextRandomSeed()));
+
+  // Commits mutations fired on the audio thread to the host (50ms poll)
+  mutationTimerObj.startTimer(50);
+
+  parameters.addParameterListener("quality", &fdnRebuilder);
+  parameters.addParameterListener("renderQuality", &fdnRebuilder);
+
+  // Applies quality changes flagged by the listener (50ms poll)
+  fdnRebuilder.startTimer(50);
 }
 
 ChaosverbAudioProcessor::~ChaosverbAudioProcessor() {
   // Stop timers before destruction to prevent callbacks into a partially
   // destroyed object. Must happen before any member destruction.
-  glideTimerObj.stopTimer();
+  morphCommitTimer.stopTimer();
   mutationTimerObj.stopTimer();
+  fdnRebuilder.stopTimer();
+  parameters.removeParameterListener("quality", &fdnRebuilder);
+  parameters.removeParameterListener("renderQuality", &fdnRebuilder);
 }
 
 //==============================================================================
@@ -275,26 +321,25 @@ void ChaosverbAudioProcessor::prepareToPlay(double sampleRate,
   spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
   spec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
 
-  const double srRatio = sampleRate / 48000.0;
+  // --- Wet path: the FDN core's channel count (mono runs the stereo core),
+  // minus the LFE ---
+  juce::dsp::ProcessSpec wetSpec = spec;
+  wetSpec.numChannels = static_cast<juce::uint32>(
+      ChaosverbFDN::getCoreChannels(getTotalNumOutputChannels()));
+  lfeChannel = getChannelLayoutOfBus(false, 0).getChannelIndexForType(
+      juce::AudioChannelSet::LFE);
 
   // --- Pre-delay: max 250ms + 1 sample headroom ---
   // Max: 4000ms (accommodates 1/1 note at 60 BPM + free time 500ms)
   const int maxPreDelaySamples =
       static_cast<int>(std::ceil(4.0 * sampleRate)) + 1;
-  preDelayLine.prepare(spec);
+  preDelayLine.prepare(wetSpec);
   preDelayLine.setMaximumDelayInSamples(maxPreDelaySamples);
   preDelayLine.setDelay(0.0f);
   preDelayLine.reset();
 
-  // --- Allpass diffuser: scale delays to actual sample rate ---
-  for (int i = 0; i < kNumDiffuserStages; ++i) {
-    int allpassDelayLength =
-        static_cast<int>(std::ceil(kAllpassLengths48k[i] * srRatio));
-    diffLines[i].prepare(spec);
-    diffLines[i].setMaximumDelayInSamples(allpassDelayLength + 1);
-    diffLines[i].setDelay(static_cast<float>(allpassDelayLength));
-    diffLines[i].reset();
-  }
+  // --- Allpass diffuser: scales delays to actual sample rate ---
+  diffuser.prepare(wetSpec);
 
   // --- Dry/wet mixer ---
   dryWetMixer.prepare(spec);
@@ -304,7 +349,7 @@ void ChaosverbAudioProcessor::prepareToPlay(double sampleRate,
   // --- Output EQ filters ---
   juce::dsp::ProcessSpec monoSpec{
       sampleRate, static_cast<juce::uint32>(samplesPerBlock), 1};
-  outputEQ.prepare(spec);
+  outputEQ.prepare(wetSpec);
 
   // --- Haas delay: max 25ms on R channel for broadband stereo width ---
   const int maxHaasSamples =
@@ -315,7 +360,7 @@ void ChaosverbAudioProcessor::prepareToPlay(double sampleRate,
   haasDelayLine.reset();
 
   // --- Wow & Flutter ---
-  wowFlutter.prepare(spec);
+  wowFlutter.prepare(wetSpec);
 
   // --- Ducking envelope follower ---
   // Attack ~10ms: catches transients without tracking individual waveform
@@ -327,47 +372,71 @@ void ChaosverbAudioProcessor::prepareToPlay(double sampleRate,
   duckReleaseCoeff =
       1.0f - std::exp(-1.0f / (0.250f * static_cast<float>(sampleRate)));
 
-  // --- Both FDN instances: prepare together ---
-  fdnA.prepare(spec);
-  fdnB.prepare(spec);
+  // --- Both FDN instances: prepare together at the current quality tier ---
+  fdnSpec = wetSpec;
+  prepareFDNs(selectFDNQuality());
 
+  // --- Baked IR: convolver + bake worker, fixed stereo chunks ---
+  bakedIR.prepare({sampleRate, static_cast<juce::uint32>(kWetChunkSize), 2});
+
+  preDelaySmoother.reset(sampleRate, 0.05);  // 50ms glide of the read tap
   widthSmoother.reset(sampleRate, 0.05);     // 50ms smoothing
   haasDelaySmoother.reset(sampleRate, 0.05); // 50ms smoothing for Haas delay
-
-  // --- Crossfade state machine: reset to Idle, A is active ---
-  xfadeState = CrossfadeState::Idle;
-  crossfadePhase = 0.0f;
-  crossfadePhaseInc = 0.0f;
-  fdnAIsActive = true;
+  duckingSmoother.reset(sampleRate, 0.05);   // 50ms smoothing of the depth
 
   // Clear any pending mutation signal from previous session
   mutationPending.store(false, std::memory_order_relaxed);
 
-  // --- Mutation timer: start (or restart) with current interval ---
-  // Record when the timer starts so getRemainingTimeMs() has a valid baseline.
-  // juce::Timer::startTimer() is thread-safe — it uses the internal TimerThread
-  // lock (not the message thread) to register the timer. The *callback* fires
-  // on the message thread. This pattern is standard in JUCE plugins where
-  // prepareToPlay() may be called from the audio thread.
-  lastMutationTimeMs = juce::Time::getMillisecondCounterHiRes();
-
-  // Only start the mutation timer if it was enabled (default: stopped)
-  if (mutationTimerRunning_.load()) {
-    // 50ms poll — fast enough for ms-scale bipolar interval values
-    mutationTimerObj.startTimer(50);
-  }
+  // --- Mutation clock: restarts from the host position (or zero) ---
+  mutationClockSource = MutationClockSource::Stopped;
 }
 
 void ChaosverbAudioProcessor::releaseResources() {
   preDelayLine.reset();
-  for (int i = 0; i < kNumDiffuserStages; ++i)
-    diffLines[i].reset();
+  diffuser.reset();
   outputEQ.reset();
   haasDelayLine.reset();
   wowFlutter.reset();
   dryWetMixer.reset();
   fdnA.reset();
   fdnB.reset();
+  bakedIR.release();
+}
+
+bool ChaosverbAudioProcessor::isBusesLayoutSupported(
+    const BusesLayout &layouts) const {
+  const juce::AudioChannelSet output = layouts.getMainOutputChannelSet();
+  const juce::AudioChannelSet input = layouts.getMainInputChannelSet();
+
+  if (output != juce::AudioChannelSet::mono() &&
+      output != juce::AudioChannelSet::stereo() &&
+      output != juce::AudioChannelSet::create5point1() &&
+      output != juce::AudioChannelSet::create7point1point4())
+    return false;
+
+  return input == output || (input == juce::AudioChannelSet::mono() &&
+                             output == juce::AudioChannelSet::stereo());
+}
+
+void ChaosverbAudioProcessor::getMemoryFootprint(
+    pfs::MemoryFootprint &footprint) const {
+  // juce::dsp::DelayLine holds maximumDelay + 2 samples per channel
+  const auto delayLineBytes = [](int maxDelaySamples, int numChannels) {
+    return static_cast<size_t>(maxDelaySamples + 2) *
+           static_cast<size_t>(numChannels) * sizeof(float);
+  };
+  const int numChannels = static_cast<int>(fdnSpec.numChannels);
+
+  footprint.add("FDN A", fdnA.getMemoryFootprintBytes());
+  footprint.add("FDN B", fdnB.getMemoryFootprintBytes());
+  footprint.add("Pre-delay",
+                delayLineBytes(preDelayLine.getMaximumDelayInSamples(),
+                               numChannels));
+  footprint.add("Diffuser", diffuser.getMemoryFootprintBytes());
+  footprint.add("Baked IR", bakedIR.getMemoryFootprintBytes());
+
+  footprint.add("Haas delay",
+                delayLineBytes(haasDelayLine.getMaximumDelayInSamples(), 1));
 }
 
 //==============================================================================
@@ -381,184 +450,184 @@ void ChaosverbAudioProcessor::triggerMutation() {
   if (mutationPending.load(std::memory_order_acquire))
     return;
 
-  // Record mutation timestamp for the countdown timer BEFORE setting params.
-  lastMutationTimeMs = juce::Time::getMillisecondCounterHiRes();
-
-  // Read all lock states (message thread — APVTS reads are always safe here)
-  const bool topologyLocked =
-      parameters.getRawParameterValue("topologyLock")->load() > 0.5f;
-  const bool decayLocked =
-      parameters.getRawParameterValue("decayLock")->load() > 0.5f;
-  const bool preDelayLocked =
-      parameters.getRawParameterValue("preDelayLock")->load() > 0.5f;
-  const bool densityLocked =
-      parameters.getRawParameterValue("densityLock")->load() > 0.5f;
-  const bool spectralTiltLocked =
-      parameters.getRawParameterValue("spectralTiltLock")->load() > 0.5f;
-  const bool resonanceLocked =
-      parameters.getRawParameterValue("resonanceLock")->load() > 0.5f;
-  const bool modRateLocked =
-      parameters.getRawParameterValue("modRateLock")->load() > 0.5f;
-  const bool modDepthLocked =
-      parameters.getRawParameterValue("modDepthLock")->load() > 0.5f;
-  const bool widthLocked =
-      parameters.getRawParameterValue("widthLock")->load() > 0.5f;
-  const bool mixLocked =
-      parameters.getRawParameterValue("mixLock")->load() > 0.5f;
-  const bool lowCutLocked =
-      parameters.getRawParameterValue("lowCutLock")->load() > 0.5f;
-  const bool highCutLocked =
-      parameters.getRawParameterValue("highCutLock")->load() > 0.5f;
-  const bool tiltLocked =
-      parameters.getRawParameterValue("tiltLock")->load() > 0.5f;
-  const bool wfAmountLocked =
-      parameters.getRawParameterValue("wowFlutterAmountLock")->load() > 0.5f;
-  const bool outputLevelLocked =
-      parameters.getRawParameterValue("outputLevelLock")->load() > 0.5f;
-  const bool duckingLocked =
-      parameters.getRawParameterValue("duckingAmountLock")->load() > 0.5f;
-
   // Use JUCE system random — uniform distribution, no musical weighting.
   juce::Random &rng = juce::Random::getSystemRandom();
 
-  // Stop any existing glide before starting a new one
-  glideTimerObj.stopTimer();
-  numActiveGlides = 0;
-
-  // Build glide targets: for each unlocked param, record current + random
-  // target. setValueNotifyingHost uses normalized 0..1, respecting skew
-  // automatically.
-  auto addGlide = [&](const char *paramID, bool locked) {
-    if (locked)
-      return;
-    if (auto *param = parameters.getParameter(paramID)) {
-      glideTargets[static_cast<size_t>(numActiveGlides++)] = {
-          param, param->getValue(), rng.nextFloat()};
-    }
-  };
-
-  addGlide("topology", topologyLocked);
-  addGlide("decay", decayLocked);
-  addGlide("preDelay", preDelayLocked);
-  addGlide("density", densityLocked);
-  addGlide("spectralTilt", spectralTiltLocked);
-  addGlide("resonance", resonanceLocked);
-  addGlide("modRate", modRateLocked);
-  addGlide("modDepth", modDepthLocked);
-  addGlide("width", widthLocked);
-  addGlide("mix", mixLocked);
-  addGlide("lowCut", lowCutLocked);
-  addGlide("highCut", highCutLocked);
-  addGlide("tilt", tiltLocked);
-  addGlide("wowFlutterAmount", wfAmountLocked);
-  addGlide("outputLevel", outputLevelLocked);
-  addGlide("duckingAmount", duckingLocked);
-
-  // Glide duration matches crossfade speed for synchronized visual + audio
-  // transition
-  const float crossfadeMs = crossfadeSpeedParam->load();
-  constexpr float kGlideTickMs = 16.0f; // ~60Hz update rate
-
-  if (numActiveGlides > 0 && crossfadeMs > kGlideTickMs) {
-    // Start smooth glide: knobs animate toward targets over crossfade duration
-    glidePhase = 0.0f;
-    glidePhaseInc = kGlideTickMs / crossfadeMs;
-    glideTimerObj.startTimer(static_cast<int>(kGlideTickMs));
-  } else {
-    // Instant (crossfade <= 16ms): write targets immediately
-    for (size_t i = 0; i < static_cast<size_t>(numActiveGlides); ++i)
-      glideTargets[i].param->setValueNotifyingHost(glideTargets[i].targetNorm);
+  // Snapshot of normalized targets for every unlocked parameter (lock states
+  // read on the message thread — APVTS reads are always safe here). Normalized
+  // values respect each parameter's skew, as setValueNotifyingHost() does.
+  MutationSnapshot snapshot;
+  for (size_t i = 0; i < kMorphParamIDs.size(); ++i) {
+    if (morphLockParams[i]->load() > 0.5f)
+      continue;
+    snapshot.mask |= 1u << i;
+    snapshot.targetNorm[i] = rng.nextFloat();
   }
 
+  // The audio thread morphs over the crossfade and reports it back; the host
+  // hears about the new values once, after it (drainFiredMutations())
+  if (snapshot.mask != 0)
+    mutationSnapshots.push(snapshot);
+
   // Crossfade to the new parameter state (even if all params were locked —
   // the crossfade still fires, FDN-B gets the same values, no audible change).
   triggerCrossfade();
 }
 
-//==============================================================================
-// Glide timer callback — smoothly interpolates parameters toward mutation
-// targets
-void ChaosverbAudioProcessor::GlideTimer::timerCallback() {
-  processor.glidePhase += processor.glidePhaseInc;
-
-  if (processor.glidePhase >= 1.0f) {
-    // Glide complete: snap to final targets
-    for (size_t i = 0; i < static_cast<size_t>(processor.numActiveGlides); ++i)
-      processor.glideTargets[i].param->setValueNotifyingHost(
-          processor.glideTargets[i].targetNorm);
-    stopTimer();
+void ChaosverbAudioProcessor::commitPendingMorph() {
+  morphCommitTimer.stopTimer();
+  if (pendingCommit.mask == 0)
     return;
+
+  for (size_t i = 0; i < morphParams.size(); ++i)
+    if ((pendingCommit.mask & (1u << i)) != 0)
+      morphParams[i]->setValueNotifyingHost(pendingCommit.targetNorm[i]);
+
+  committedMorphGeneration.store(pendingCommit.generation,
+                                 std::memory_order_release);
+  pendingCommit.mask = 0;
+}
+
+void ChaosverbAudioProcessor::drainFiredMutations() {
+  MutationSnapshot fired;
+  while (firedMutations.pop(fired)) {
+    // A mutation before the last morph ended: the host gets those targets now
+    commitPendingMorph();
+
+    pendingCommit = fired;
+    const float crossfadeMs = crossfadeSpeedParam->load();
+    morphCommitTimer.startTimer(juce::jmax(1, juce::roundToInt(crossfadeMs)));
   }
+}
 
-  // Smoothstep for natural-feeling motion (ease in/out)
-  const float t = processor.glidePhase;
+//==============================================================================
+// Audio thread — values arrive holding the APVTS values; mutation morphs
+// override the parameters they cover. Each glides from wherever the
+// parameter was when its mutation arrived, in normalized space with
+// smoothstep easing, then holds the target until the host has it (APVTS then
+// reads the same snapped value).
+static float morphedNorm(float fromNorm, float toNorm, float phase) {
+  const float t = juce::jlimit(0.0f, 1.0f, phase);
   const float smooth = t * t * (3.0f - 2.0f * t);
+  return fromNorm + smooth * (toNorm - fromNorm);
+}
 
-  for (size_t i = 0; i < static_cast<size_t>(processor.numActiveGlides); ++i) {
-    const auto &g = processor.glideTargets[i];
-    const float val = g.startNorm + smooth * (g.targetNorm - g.startNorm);
-    g.param->setValueNotifyingHost(val);
+void ChaosverbAudioProcessor::startMorph(
+    MutationSnapshot snapshot, float phaseInc,
+    const std::array<float, kNumMorphParams> &values) {
+  snapshot.generation = ++morphGeneration;
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    if ((snapshot.mask & (1u << i)) == 0)
+      continue;
+
+    ParamMorph &m = paramMorphs[i];
+    const float fromNorm = m.active
+                               ? morphedNorm(m.fromNorm, m.toNorm, m.phase)
+                               : morphParams[i]->convertTo0to1(values[i]);
+
+    m = {fromNorm, snapshot.targetNorm[i], 0.0f, phaseInc, snapshot.generation,
+         true};
+  }
+
+  // A full ring (message thread stalled) only delays the host commit: a
+  // later commit releases every older generation too
+  firedMutations.push(snapshot);
+}
+
+void ChaosverbAudioProcessor::readMorphedParameters(
+    std::array<float, kNumMorphParams> &values, int numSamples,
+    float crossfadeSpeedMs, const MutationSnapshot *scheduled) {
+  const float phaseInc =
+      crossfadeSpeedMs <= 0.0f
+          ? 1.0f
+          : 1.0f / (crossfadeSpeedMs * 0.001f *
+                    static_cast<float>(currentSampleRate));
+
+  // Mutate Now snapshots start at the first chunk; only the newest matters
+  MutationSnapshot snapshot;
+  bool hasSnapshot = false;
+  while (mutationSnapshots.pop(snapshot))
+    hasSnapshot = true;
+  if (hasSnapshot)
+    startMorph(snapshot, phaseInc, values);
+
+  if (scheduled != nullptr && scheduled->mask != 0)
+    startMorph(*scheduled, phaseInc, values);
+
+  const int committed =
+      committedMorphGeneration.load(std::memory_order_acquire);
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    ParamMorph &m = paramMorphs[i];
+
+    if (m.active && m.phase >= 1.0f && committed >= m.generation)
+      m.active = false; // the host has the target
+
+    if (!m.active)
+      continue; // values[i] keeps the APVTS value
+
+    // The value at the end of the chunk: its stages ramp there from the last
+    m.phase = juce::jmin(1.0f,
+                         m.phase + m.phaseInc * static_cast<float>(numSamples));
+    values[i] = morphParams[i]->convertFrom0to1(
+        morphedNorm(m.fromNorm, m.toNorm, m.phase));
   }
 }
 
 double ChaosverbAudioProcessor::getRemainingTimeMs() const {
-  if (lastMutationTimeMs == 0.0 || !mutationTimerRunning_.load())
+  if (!mutationTimerRunning_.load())
     return -1.0; // -1 signals "timer stopped" to the UI
 
-  const double intervalMs = computeMutationIntervalMs();
-
-  const double now = juce::Time::getMillisecondCounterHiRes();
-  const double elapsed = now - lastMutationTimeMs;
-  const double remaining = intervalMs - elapsed;
-
-  return juce::jlimit(0.0, intervalMs, remaining);
+  return static_cast<double>(
+      remainingMutationMs.load(std::memory_order_relaxed));
 }
 
 //==============================================================================
-double ChaosverbAudioProcessor::computeMutationIntervalMs() const {
-  const float val = parameters.getRawParameterValue("mutationInterval")->load();
+double ChaosverbAudioProcessor::mutationDivisionBeats(float intervalVal) {
+  const float t = -intervalVal / 1000.0f; // 0..1 (0=center, 1=far left)
+
+  // Map snapped value to musical note division.
+  // Snap points ensure t is exactly 0.1, 0.2, ..., 1.0 — use >= for exact
+  // match.
+  if (t >= 0.975f)
+    return 16.0; // 4 bars
+  if (t >= 0.95f)
+    return 12.0; // 3 bars
+  if (t >= 0.925f)
+    return 8.0; // 2 bars
+  if (t >= 0.9f)
+    return 4.0; // 1/1 whole note
+  if (t >= 0.8f)
+    return 2.0; // 1/2 half note
+  if (t >= 0.7f)
+    return 1.5; // dotted 1/4
+  if (t >= 0.6f)
+    return 1.0; // 1/4 quarter
+  if (t >= 0.5f)
+    return 0.75; // dotted 1/8
+  if (t >= 0.4f)
+    return 0.5; // 1/8 eighth
+  if (t >= 0.3f)
+    return 0.375; // dotted 1/16
+  if (t >= 0.2f)
+    return 0.25; // 1/16 sixteenth
+  if (t >= 0.1f)
+    return 0.125; // 1/32
+  return 0.0;
+}
 
+double ChaosverbAudioProcessor::computeMutationIntervalMs(float intervalVal,
+                                                          float bpm) {
   double intervalMs;
 
-  if (val >= 0.0f) {
+  if (intervalVal >= 0.0f) {
     // Right side: absolute time in milliseconds (0–1000ms)
-    intervalMs = static_cast<double>(val);
+    intervalMs = static_cast<double>(intervalVal);
   } else {
     // Left side: BPM-synced note divisions
-    const float bpm = hostBPM.load(std::memory_order_relaxed);
-    const float quarterNoteMs = 60000.0f / bpm;
-    const float t = -val / 1000.0f; // 0..1 (0=center, 1=far left)
-
-    // Map snapped value to musical note division.
-    // Snap points ensure t is exactly 0.1, 0.2, ..., 1.0 — use >= for exact
-    // match.
-    float beatFraction = 0.0f;
-    if (t >= 0.975f)
-      beatFraction = 16.0f; // 4 bars
-    else if (t >= 0.95f)
-      beatFraction = 12.0f; // 3 bars
-    else if (t >= 0.925f)
-      beatFraction = 8.0f; // 2 bars
-    else if (t >= 0.9f)
-      beatFraction = 4.0f; // 1/1 whole note
-    else if (t >= 0.8f)
-      beatFraction = 2.0f; // 1/2 half note
-    else if (t >= 0.7f)
-      beatFraction = 1.5f; // dotted 1/4
-    else if (t >= 0.6f)
-      beatFraction = 1.0f; // 1/4 quarter
-    else if (t >= 0.5f)
-      beatFraction = 0.75f; // dotted 1/8
-    else if (t >= 0.4f)
-      beatFraction = 0.5f; // 1/8 eighth
-    else if (t >= 0.3f)
-      beatFraction = 0.375f; // dotted 1/16
-    else if (t >= 0.2f)
-      beatFraction = 0.25f; // 1/16 sixteenth
-    else if (t >= 0.1f)
-      beatFraction = 0.125f; // 1/32
-
-    intervalMs = static_cast<double>(quarterNoteMs * beatFraction);
+    const double quarterNoteMs = 60000.0 / static_cast<double>(bpm);
+    intervalMs = quarterNoteMs * mutationDivisionBeats(intervalVal);
   }
 
   // Minimum 50ms to prevent runaway mutations
@@ -566,174 +635,347 @@ double ChaosverbAudioProcessor::computeMutationIntervalMs() const {
 }
 
 void ChaosverbAudioProcessor::setMutationTimerRunning(bool running) {
+  // The audio thread picks this up on its next block and restarts the clock
   mutationTimerRunning_.store(running);
-
-  if (running) {
-    // Reset baseline so countdown starts fresh from current interval
-    lastMutationTimeMs = juce::Time::getMillisecondCounterHiRes();
-    // 50ms poll — fast enough for ms-scale bipolar interval values
-    mutationTimerObj.startTimer(50);
-  } else {
-    mutationTimerObj.stopTimer();
-  }
 }
 
 bool ChaosverbAudioProcessor::isMutationTimerRunning() const {
   return mutationTimerRunning_.load();
 }
 
+//==============================================================================
+int ChaosverbAudioProcessor::advanceMutationClock(
+    int numSamples,
+    const juce::Optional<juce::AudioPlayHead::PositionInfo> &position,
+    float bpm, std::int64_t &slot) {
+  if (!mutationTimerRunning_.load()) {
+    mutationClockSource = MutationClockSource::Stopped;
+    remainingMutationMs.store(-1.0f, std::memory_order_relaxed);
+    return -1;
+  }
+
+  const float intervalVal = mutationIntervalParam->load();
+  const double sr = currentSampleRate;
+  const bool playing = position.hasValue() && position->getIsPlaying();
+
+  // Position on the clock's own axis, its length per sample, and the slot
+  // interval on that axis
+  MutationClockSource source = MutationClockSource::Internal;
+  double pos = 0.0;
+  double unitsPerSample = 1.0;
+  double interval = computeMutationIntervalMs(intervalVal, bpm) * 0.001 * sr;
+
+  const double divisionBeats =
+      intervalVal < 0.0f ? mutationDivisionBeats(intervalVal) : 0.0;
+  if (playing && divisionBeats > 0.0 && position->getPpqPosition()) {
+    // Note divisions land on the host's bar/beat grid. The 50ms floor is
+    // kept by skipping whole divisions so the slots stay on the grid.
+    source = MutationClockSource::HostPPQ;
+    pos = *position->getPpqPosition();
+    unitsPerSample = static_cast<double>(bpm) / (60.0 * sr);
+    const double minBeats = 0.05 * static_cast<double>(bpm) / 60.0;
+    interval = divisionBeats * std::ceil(minBeats / divisionBeats - 1e-9);
+  } else if (playing && position->getTimeInSamples()) {
+    source = MutationClockSource::HostSamples;
+    pos = static_cast<double>(*position->getTimeInSamples());
+  }
+
+  // A new source (transport start/stop, timer switched on) restarts the
+  // count. The internal clock starts a full interval out, like a timer.
+  if (source != mutationClockSource) {
+    mutationClockSource = source;
+    internalClockSamples = 0.0;
+    lastMutationSlot = source == MutationClockSource::Internal
+                           ? 0
+                           : std::numeric_limits<std::int64_t>::min();
+    lastMutationPos = -std::numeric_limits<double>::infinity();
+  }
+  if (source == MutationClockSource::Internal)
+    pos = internalClockSamples;
+
+  // The host looped or jumped back: every slot from here on may fire again,
+  // including the one that fired last (a loop holding a single slot)
+  if (pos < lastMutationPos)
+    lastMutationSlot = std::numeric_limits<std::int64_t>::min();
+  lastMutationPos = pos;
+
+  // First slot at or after the block start. While the position moves
+  // forward, the slot that fired last can only come round again by
+  // rounding, so it is skipped.
+  slot = static_cast<std::int64_t>(std::ceil(pos / interval - 1e-9));
+  if (slot == lastMutationSlot)
+    ++slot;
+
+  const double offset =
+      (static_cast<double>(slot) * interval - pos) / unitsPerSample;
+  remainingMutationMs.store(static_cast<float>(offset * 1000.0 / sr),
+                            std::memory_order_relaxed);
+
+  if (source == MutationClockSource::Internal)
+    internalClockSamples += numSamples;
+
+  if (offset >= static_cast<double>(numSamples))
+    return -1;
+
+  lastMutationSlot = slot;
+  return juce::jlimit(0, numSamples - 1, static_cast<int>(offset));
+}
+
+float ChaosverbAudioProcessor::mutationTargetNorm(std::uint64_t seed,
+                                                  std::int64_t slot,
+                                                  int param) {
+  const std::uint64_t key =
+      pfs::detail::mixSeed(seed ^ pfs::detail::mixSeed(
+                                      static_cast<std::uint64_t>(slot))) +
+      static_cast<std::uint64_t>(param);
+
+  // Top 24 bits as a float in [0, 1)
+  return static_cast<float>(pfs::detail::mixSeed(key) >> 40) /
+         static_cast<float>(1u << 24);
+}
+
+void ChaosverbAudioProcessor::beginCrossfade(float crossfadeSpeedMs) {
+  xfadeState = CrossfadeState::Ramping;
+  crossfadePhase = 0.0f;
+
+  // Freeze current params as the outgoing snapshot.
+  // activeSnapshot has the params the active FDN runs with right now
+  // (before the mutation morph moves them). The outgoing FDN keeps
+  // reverberating with these old params during crossfade.
+  outgoingSnapshot = activeSnapshot;
+
+  // Wake the idle FDN as a clone of the active one. It starts the crossfade
+  // with the same energized tail (as if it had run in parallel all along),
+  // so the crossfade genuinely blends old and new reverb characters and the
+  // crossfade speed parameter stays audible. Starting it from silence would
+  // produce a volume dip instead of a smooth morph.
+  ChaosverbFDN &activeFDN = fdnAIsActive ? fdnA : fdnB;
+  ChaosverbFDN &incomingFDN = fdnAIsActive ? fdnB : fdnA;
+  incomingFDN.copyStateFrom(activeFDN);
+
+  const float sr = static_cast<float>(currentSampleRate);
+  if (crossfadeSpeedMs <= 0.0f) {
+    crossfadePhaseInc = 1.0f;
+  } else {
+    crossfadePhaseInc = 1.0f / (crossfadeSpeedMs * 0.001f * sr);
+  }
+}
+
 //==============================================================================
 // Allpass diffuser helper (called from processBlock per-sample)
 //==============================================================================
 
 //==============================================================================
 
-void ChaosverbAudioProcessor::applyDucking(int numSamples, float *dataL,
-                                           float *dataR, float duckingNorm) {
-  if (dataL == nullptr && dataR == nullptr)
+void ChaosverbAudioProcessor::processPostChain(
+    int numSamples, float *const *data, int numChannels, float widthGain,
+    float haasDelaySamples, float wfAmount, bool wfEnabled,
+    float duckingNorm) {
+  if (numChannels <= 0)
     return;
 
-  for (int n = 0; n < numSamples; ++n) {
-    const float rawL = (dataL != nullptr) ? dataL[n] : 0.0f;
-    const float rawR = (dataR != nullptr) ? dataR[n] : 0.0f;
+  // Stereo gets the Haas delay and M/S width; wider layouts spread every
+  // channel but the LFE around their mean
+  const bool stereo = fdnA.getNumChannels() == 2 && numChannels > 1;
+  int numSpread = 0;
+  for (int ch = 0; ch < numChannels; ++ch)
+    if (ch != lfeChannel)
+      ++numSpread;
+  const bool surround = fdnA.getNumChannels() > 2 && numSpread > 1;
+  const float meanScale = 1.0f / static_cast<float>(juce::jmax(1, numSpread));
+
+  widthSmoother.setTargetValue(widthGain);
+  haasDelaySmoother.setTargetValue(haasDelaySamples);
+  duckingSmoother.setTargetValue(duckingNorm);
+
+  float frame[kMaxWetChannels] = {};
+
+  for (int start = 0; start < numSamples; start += kWetChunkSize) {
+    const int chunkSize = juce::jmin(kWetChunkSize, numSamples - start);
+
+    if (stereo || surround)
+      for (int n = 0; n < chunkSize; ++n)
+        widthRamp[static_cast<size_t>(n)] = widthSmoother.getNextValue();
+    if (stereo)
+      for (int n = 0; n < chunkSize; ++n)
+        haasDelayRamp[static_cast<size_t>(n)] =
+            haasDelaySmoother.getNextValue();
+    for (int n = 0; n < chunkSize; ++n)
+      duckingRamp[static_cast<size_t>(n)] = duckingSmoother.getNextValue();
+    outputEQ.beginBlock(chunkSize);
+    const bool wfActive = wowFlutter.beginBlock(chunkSize, wfAmount, wfEnabled);
+
+    for (int n = 0; n < chunkSize; ++n) {
+      const size_t i = static_cast<size_t>(n);
+
+      // The LFE lane still rings through the FDN's cross-channel mixing; it
+      // is not heard
+      for (int ch = 0; ch < numChannels; ++ch)
+        frame[ch] = ch != lfeChannel ? data[ch][start + n] : 0.0f;
+
+      // Haas delay on R (temporal decorrelation for broadband width), then
+      // M/S width
+      if (stereo) {
+        haasDelayLine.pushSample(0, frame[1]);
+        frame[1] =
+            haasDelayLine.popSample(0, juce::jmax(0.0f, haasDelayRamp[i]));
+
+        const float mid = (frame[0] + frame[1]) * 0.5f;
+        const float side = (frame[0] - frame[1]) * 0.5f;
+        frame[0] = mid + side * widthRamp[i];
+        frame[1] = mid - side * widthRamp[i];
+      } else if (surround) {
+        float mean = 0.0f;
+        for (int ch = 0; ch < numChannels; ++ch)
+          if (ch != lfeChannel)
+            mean += frame[ch];
+        mean *= meanScale;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+          if (ch != lfeChannel)
+            frame[ch] = mean + (frame[ch] - mean) * widthRamp[i];
+      }
+
+      outputEQ.processFrame(n, frame);
+      if (wfActive)
+        wowFlutter.processFrame(n, frame);
 
-    // Envelope follower for ducking
-    const float inputPeak = std::max(std::abs(rawL), std::abs(rawR));
-    if (inputPeak > duckEnvelope)
-      duckEnvelope += duckAttackCoeff * (inputPeak - duckEnvelope);
-    else
-      duckEnvelope += duckReleaseCoeff * (inputPeak - duckEnvelope);
+      // Ducking: envelope follower on the wet peak
+      float inputPeak = 0.0f;
+      for (int ch = 0; ch < numChannels; ++ch)
+        inputPeak = std::max(inputPeak, std::abs(frame[ch]));
+      if (inputPeak > duckEnvelope)
+        duckEnvelope += duckAttackCoeff * (inputPeak - duckEnvelope);
+      else
+        duckEnvelope += duckReleaseCoeff * (inputPeak - duckEnvelope);
 
-    if (duckingNorm >= 0.001f) {
+      const float duckDepth = duckingRamp[i];
       const float duckGain =
-          juce::jlimit(0.0f, 1.0f, 1.0f - duckingNorm * duckEnvelope * 2.0f);
-      if (dataL != nullptr)
-        dataL[n] *= duckGain;
-      if (dataR != nullptr)
-        dataR[n] *= duckGain;
+          duckDepth >= 0.001f
+              ? juce::jlimit(0.0f, 1.0f, 1.0f - duckDepth * duckEnvelope * 2.0f)
+              : 1.0f;
+
+      for (int ch = 0; ch < numChannels; ++ch)
+        data[ch][start + n] = frame[ch] * duckGain;
     }
   }
 }
 
-void ChaosverbAudioProcessor::applyStereoWidth(int numSamples, float *dataL,
-                                               float *dataR, float widthGain) {
-  if (dataL != nullptr && dataR != nullptr) {
-    widthSmoother.setTargetValue(widthGain);
-    for (int n = 0; n < numSamples; ++n) {
-      const float currentWidth = widthSmoother.getNextValue();
-      const float mid = (dataL[n] + dataR[n]) * 0.5f;
-      const float side = (dataL[n] - dataR[n]) * 0.5f;
-      dataL[n] = mid + side * currentWidth;
-      dataR[n] = mid - side * currentWidth;
-    }
-  }
+//==============================================================================
+void ChaosverbAudioProcessor::setNonRealtime(bool nonRealtime) noexcept {
+  AudioProcessor::setNonRealtime(nonRealtime);
+
+  // Back to live playback: return to the live tier even if the host does
+  // not call prepareToPlay() again
+  fdnRebuilder.requestRebuild();
 }
 
-float ChaosverbAudioProcessor::processDiffuserSample(float input, int channel,
-                                                     int numActiveStages) {
-  float x = input;
-  for (int stage = 0; stage < numActiveStages; ++stage) {
-    auto &dl = diffLines[stage];
-    const float delayed = dl.popSample(channel);
-    const float v = x - kAllpassCoeff * delayed;
-    dl.pushSample(channel, v);
-    x = delayed + kAllpassCoeff * v;
-  }
-  return x;
+FDNQuality ChaosverbAudioProcessor::selectFDNQuality() const {
+  if (isNonRealtime())
+    return renderQualityParam->load() >= 0.5f ? FDNQuality::Offline
+                                              : FDNQuality::High;
+
+  return static_cast<FDNQuality>(
+      juce::jlimit(0, 3, juce::roundToInt(qualityParam->load())));
 }
 
-//==============================================================================
-void ChaosverbAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
-                                           juce::MidiBuffer &midiMessages) {
-  juce::ScopedNoDenormals noDenormals;
-  juce::ignoreUnused(midiMessages);
+void ChaosverbAudioProcessor::prepareFDNs(FDNQuality quality) {
+  fdnA.prepare(fdnSpec, quality);
+  fdnB.prepare(fdnSpec, quality);
 
-  const int totalNumInputChannels = getTotalNumInputChannels();
-  const int totalNumOutputChannels = getTotalNumOutputChannels();
+  // --- Crossfade state machine: reset to Idle, A is active ---
+  xfadeState = CrossfadeState::Idle;
+  crossfadePhase = 0.0f;
+  crossfadePhaseInc = 0.0f;
+  fdnAIsActive = true;
 
-  for (int i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-    buffer.clear(i, 0, buffer.getNumSamples());
+  // --- Silent tail: fresh FDNs are silent, but start out running ---
+  tailSilent = false;
+  silentSamples = 0;
+  meanLoopSeconds.store(fdnA.getMeanDelaySamples() /
+                            static_cast<float>(fdnSpec.sampleRate),
+                        std::memory_order_relaxed);
+}
 
-  // -------------------------------------------------------------------------
-  // Bypass — pass audio through unprocessed
-  // -------------------------------------------------------------------------
-  const bool bypassed = bypassParam->load() >= 0.5f;
-  if (bypassed)
-    return;
+double ChaosverbAudioProcessor::getTailLengthSeconds() const {
+  // Same T60 -> feedback gain mapping as processBlock(); the gain clamp is
+  // what bounds the tail for very long decays
+  const float meanLoopTime = meanLoopSeconds.load(std::memory_order_relaxed);
+  const float safeDecay = juce::jmax(0.01f, decayParam->load());
+  const float feedbackGain =
+      juce::jmin(std::exp(-6.91f * meanLoopTime / safeDecay), 0.9999f);
+
+  // Each loop pass loses -20 * log10(g) dB; count passes down to -120 dBFS
+  // (gainToDecibels() would clamp at its default -100 dB floor)
+  const double thresholdDb =
+      20.0 * std::log10(static_cast<double>(kSilenceThreshold));
+  const double dbPerLoop =
+      -20.0 * std::log10(static_cast<double>(feedbackGain));
+  const double fdnTail = meanLoopTime * (-thresholdDb / dbPerLoop);
+
+  return preDelaySeconds.load(std::memory_order_relaxed) + fdnTail;
+}
 
-  const int numSamples = buffer.getNumSamples();
-  const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+bool ChaosverbAudioProcessor::isWetStateSilent() const {
+  if (diffuser.getStatePeak() >= kSilenceThreshold)
+    return false;
 
-  // -------------------------------------------------------------------------
-  // Read all parameters — atomic loads, fully real-time safe
-  // -------------------------------------------------------------------------
-  const float topologyPercent = topologyParam->load();
-  const float decaySeconds = decayParam->load();
-  const float preDelayVal = preDelayParam->load();
-  const float densityPercent = densityParam->load();
-  const float spectralTiltVal = spectralTiltParam->load();
-  const float resonanceVal = resonanceParam->load();
-  const float modRateHz = modRateParam->load();
-  const float modDepthPercent = modDepthParam->load();
-  const float widthPercent = widthParam->load();
-  const float mixPercent = mixParam->load();
-  const float crossfadeSpeedMs = crossfadeSpeedParam->load();
-  const float lowCutHz = lowCutParam->load();
-  const float highCutHz = highCutParam->load();
-  const float tiltVal = tiltParam->load();
-  const float wfAmount = wfAmountParam->load();
-  const bool wfEnabled = wfEnabledParam->load() > 0.5f;
-  const float outputLevelDb = outputLevelParam->load();
-  const float duckingAmount = duckingAmountParam->load();
+  // A baked FDN that has rung out is frozen and not heard
+  const ChaosverbFDN &activeFDN = fdnAIsActive ? fdnA : fdnB;
+  return !bakedIR.isFDNRunning() ||
+         activeFDN.getStatePeak() < kSilenceThreshold;
+}
 
-  // -------------------------------------------------------------------------
-  // Check mutation pending flag (set by message thread, cleared here)
-  // Guard: ignore if crossfade already in progress
-  // -------------------------------------------------------------------------
-  if (mutationPending.load(std::memory_order_acquire) &&
-      xfadeState == CrossfadeState::Idle) {
-    mutationPending.store(false, std::memory_order_release);
-    xfadeState = CrossfadeState::Ramping;
-    crossfadePhase = 0.0f;
-
-    // Freeze current params as the outgoing snapshot.
-    // activeSnapshot has last block's params (before mutation wrote new APVTS
-    // values). The outgoing FDN keeps reverberating with these old params
-    // during crossfade.
-    outgoingSnapshot = activeSnapshot;
-
-    // Do NOT reset the incoming FDN — it already has reverb energy from running
-    // in parallel with the outgoing FDN. Keeping its state allows the crossfade
-    // to genuinely blend between old and new reverb characters, making the
-    // crossfade speed parameter audible. Resetting would cause the incoming FDN
-    // to start from silence, producing a volume dip instead of a smooth morph.
-
-    const float sr = static_cast<float>(currentSampleRate);
-    if (crossfadeSpeedMs <= 0.0f) {
-      crossfadePhaseInc = 1.0f;
-    } else {
-      crossfadePhaseInc = 1.0f / (crossfadeSpeedMs * 0.001f * sr);
-    }
-  }
+void ChaosverbAudioProcessor::enterSilentTail() {
+  preDelayLine.reset();
+  diffuser.reset();
+  fdnA.reset();
+  fdnB.reset();
+  bakedIR.clearHistory();
+  haasDelayLine.reset();
+  outputEQ.reset();
+  wowFlutter.reset();
+  duckEnvelope = 0.0f;
 
-  // -------------------------------------------------------------------------
-  // Precompute per-block DSP parameters (avoids recomputing per-sample)
-  // -------------------------------------------------------------------------
+  tailSilent = true;
+}
 
-  const float sr = static_cast<float>(currentSampleRate);
+void ChaosverbAudioProcessor::rebuildFDNs() {
+  // Offline renders switch inside processBlock(); suspending here would drop
+  // blocks from the render. Before the first prepareToPlay() there is
+  // nothing to rebuild.
+  if (isNonRealtime() || fdnSpec.sampleRate <= 0.0)
+    return;
 
-  // Read host BPM unconditionally — used by pre-delay AND mutation interval.
-  // Stored in atomic so the message-thread timer callback can also read it.
-  {
-    float bpm = 120.0f; // fallback when host doesn't report tempo
-    if (auto *playhead = getPlayHead()) {
-      if (auto pos = playhead->getPosition()) {
-        if (auto hostBpm = pos->getBpm())
-          bpm = juce::jmax(20.0f, static_cast<float>(*hostBpm));
-      }
-    }
-    hostBPM.store(bpm, std::memory_order_relaxed);
-  }
+  // suspendProcessing() takes the callback lock, so processBlock() is not
+  // running while the FDNs reallocate. The tail restarts at the new size.
+  suspendProcessing(true);
+  const FDNQuality quality = selectFDNQuality();
+  if (quality != fdnA.getQuality())
+    prepareFDNs(quality);
+  suspendProcessing(false);
+}
+
+//==============================================================================
+ChaosverbAudioProcessor::WetTargets ChaosverbAudioProcessor::applyWetParameters(
+    const std::array<float, kNumMorphParams> &values, float bpm) {
+  const float topologyPercent = values[kMorphTopology];
+  const float decaySeconds = values[kMorphDecay];
+  const float preDelayVal = values[kMorphPreDelay];
+  const float densityPercent = values[kMorphDensity];
+  const float spectralTiltVal = values[kMorphSpectralTilt];
+  const float resonanceVal = values[kMorphResonance];
+  const float modRateHz = values[kMorphModRate];
+  const float modDepthPercent = values[kMorphModDepth];
+  const float widthPercent = values[kMorphWidth];
+  const float mixPercent = values[kMorphMix];
+  const float lowCutHz = values[kMorphLowCut];
+  const float highCutHz = values[kMorphHighCut];
+  const float tiltVal = values[kMorphTilt];
+  const float outputLevelDb = values[kMorphOutputLevel];
+
+  const float sr = static_cast<float>(currentSampleRate);
+  WetTargets targets;
 
   // Pre-delay: bipolar — right of center=free time (ms), left=BPM-synced
   // divisions
@@ -743,7 +985,6 @@ void ChaosverbAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
     preDelaySamples = preDelayVal / 1000.0f * sr;
   } else {
     // Left of center: BPM-synced note divisions
-    const float bpm = hostBPM.load(std::memory_order_relaxed);
     const float quarterNoteMs = 60000.0f / bpm;
     const float t = -preDelayVal / 500.0f; // 0..1 (0=off, 1=whole note)
 
@@ -770,20 +1011,13 @@ void ChaosverbAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
 
     preDelaySamples = (quarterNoteMs * beatFraction) / 1000.0f * sr;
   }
-
-  preDelaySamples = juce::jmax(0.0f, preDelaySamples);
-  preDelayLine.setDelay(preDelaySamples);
+  preDelaySeconds.store(preDelaySamples / sr, std::memory_order_relaxed);
+  targets.preDelaySamples = juce::jmax(0.0f, preDelaySamples);
 
   // Feedback gain from T60 (decay) formula
-  float meanDelaySamples = 0.0f;
-  for (int i = 0; i < ChaosverbFDN::kNumLines; ++i) {
-    // Average L and R delay lengths (different primes per channel for
-    // decorrelation)
-    meanDelaySamples +=
-        static_cast<float>(fdnA.delayLengthsL[i] + fdnA.delayLengthsR[i]) *
-        0.5f;
-  }
-  meanDelaySamples /= static_cast<float>(ChaosverbFDN::kNumLines);
+  // Average L and R delay lengths (different primes per channel for
+  // decorrelation); both FDNs always run the same tier
+  const float meanDelaySamples = fdnA.getMeanDelaySamples();
 
   const float meanLoopTime = meanDelaySamples / sr;
   const float safeDecay = juce::jmax(0.01f, decaySeconds);
@@ -792,17 +1026,7 @@ void ChaosverbAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
 
   // Density -> diffuser stages + FDN in-loop allpass coefficient scaling
   // Wider thresholds = more dramatic jumps when sweeping the knob
-  int numActiveDiffuserStages;
-  if (densityPercent < 20.0f)
-    numActiveDiffuserStages = 0;
-  else if (densityPercent < 40.0f)
-    numActiveDiffuserStages = 1;
-  else if (densityPercent < 55.0f)
-    numActiveDiffuserStages = 2;
-  else if (densityPercent < 75.0f)
-    numActiveDiffuserStages = 3;
-  else
-    numActiveDiffuserStages = 4;
+  diffuser.updateDensity(densityPercent);
 
   // Scale FDN in-loop allpass coefficients: sparse (0%) → dense wash (100%)
   // Quadratic curve for more extreme contrast between low and high density
@@ -816,44 +1040,43 @@ void ChaosverbAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
 
   // LFO depth in samples
   const float modDepthSamples =
-      (modDepthPercent / 100.0f) * fdnA.maxLFODepthSamples;
+      (modDepthPercent / 100.0f) * fdnA.getMaxLFODepthSamples();
 
   // Resonance smoothing coefficient (~50ms one-pole IIR)
   const float resoSmoothCoeff = 1.0f - std::exp(-1.0f / (0.050f * sr));
 
+  targets.fdnParams = {feedbackGain, topologyBlend, modDepthSamples,
+                       resoSmoothCoeff};
+
   // Stereo width gain: 0%=0.0, 100%=1.0, 400%=4.0
-  const float widthGain = widthPercent / 100.0f;
+  targets.widthGain = widthPercent / 100.0f;
 
   // Haas delay: scales from 0ms at width=0% to 25ms at width=400%
   // Adds temporal decorrelation to the R channel for broadband stereo width
   const float maxHaasMs = 25.0f;
   const float haasMs = (widthPercent / 400.0f) * maxHaasMs;
-  const float haasDelaySamples = juce::jmax(0.0f, (haasMs / 1000.0f) * sr);
+  targets.haasDelaySamples = juce::jmax(0.0f, (haasMs / 1000.0f) * sr);
 
   // -------------------------------------------------------------------------
-  // Update FDN coefficients: when idle both FDNs track live params;
+  // Update FDN coefficients: when idle only the active FDN runs and tracks
+  // live params (the idle one is overwritten by a clone at crossfade start);
   // during crossfade only the incoming FDN gets new coefficients so the
-  // outgoing FDN keeps reverberating with its old character.
+  // outgoing FDN keeps reverberating with its old character. Both glide to
+  // the new values over their next chunk.
   // -------------------------------------------------------------------------
   if (xfadeState == CrossfadeState::Idle) {
-    fdnA.updateDensity(densityCurved);
-    fdnB.updateDensity(densityCurved);
+    ChaosverbFDN &activeFDN = fdnAIsActive ? fdnA : fdnB;
+    activeFDN.updateDensity(densityCurved);
 
-    if (std::abs(spectralTiltVal - fdnA.cachedSpectralTilt) > 0.01f) {
-      fdnA.updateShelfCoefficients(spectralTiltVal);
-      fdnB.updateShelfCoefficients(spectralTiltVal);
-    }
-    if (std::abs(resonanceVal - fdnA.cachedResonance) > 0.01f) {
-      fdnA.updateResonanceCoefficients(resonanceVal);
-      fdnB.updateResonanceCoefficients(resonanceVal);
-    }
+    if (std::abs(spectralTiltVal - activeFDN.getCachedSpectralTilt()) > 0.01f)
+      activeFDN.updateShelfCoefficients(spectralTiltVal);
+    if (std::abs(resonanceVal - activeFDN.getCachedResonance()) > 0.01f)
+      activeFDN.updateResonanceCoefficients(resonanceVal);
 
-    fdnA.prepareLFO(modRateHz, modDepthPercent);
-    fdnB.prepareLFO(modRateHz, modDepthPercent);
+    activeFDN.prepareLFO(modRateHz, modDepthPercent);
 
     // Track live per-sample params for future crossfade snapshot
-    activeSnapshot = {feedbackGain, topologyBlend, modDepthSamples,
-                      resoSmoothCoeff};
+    activeSnapshot = targets.fdnParams;
   } else {
     // Crossfading: only update incoming FDN with new (mutated) params.
     // Outgoing FDN keeps its frozen coefficients from before the mutation.
@@ -867,12 +1090,146 @@ void ChaosverbAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
   // Update output EQ coefficients when parameters change
   outputEQ.update(lowCutHz, highCutHz, tiltVal);
 
-  // Set DryWetMixer mix ratio
+  // Set DryWetMixer mix ratio (its smoother ramps to it)
   dryWetMixer.setWetMixProportion(
       juce::jlimit(0.0f, 1.0f, mixPercent / 100.0f));
 
+  targets.wfAmount = values[kMorphWowFlutterAmount];
+
   // Ducking amount: 0.0 = off, 1.0 = full ducking
-  const float duckingNorm = duckingAmount / 100.0f;
+  targets.duckingNorm = values[kMorphDuckingAmount] / 100.0f;
+
+  targets.outputGain = std::abs(outputLevelDb) > 0.01f
+                           ? juce::Decibels::decibelsToGain(outputLevelDb)
+                           : 1.0f;
+
+  targets.bakeSettings = {fdnA.getQuality(), targets.fdnParams, densityCurved,
+                          spectralTiltVal,   resonanceVal,      modRateHz,
+                          modDepthPercent,   decaySeconds};
+  return targets;
+}
+
+//==============================================================================
+void ChaosverbAudioProcessor::processFDNPass(
+    ChaosverbFDN &fdn, const float *const *in, float *const *out,
+    int numSamples, int numFrozenSamples, const FDNParamSnapshot &frozen,
+    const FDNParamSnapshot &live) {
+  if (numFrozenSamples > 0)
+    fdn.processBlock(in, out, numFrozenSamples, frozen);
+  if (numSamples > numFrozenSamples) {
+    const float *liveIn[kMaxWetChannels] = {};
+    float *liveOut[kMaxWetChannels] = {};
+    for (int ch = 0; ch < fdn.getNumChannels(); ++ch) {
+      liveIn[ch] = in[ch] + numFrozenSamples;
+      liveOut[ch] = out[ch] + numFrozenSamples;
+    }
+    fdn.processBlock(liveIn, liveOut, numSamples - numFrozenSamples, live);
+  }
+}
+
+//==============================================================================
+void ChaosverbAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
+                                           juce::MidiBuffer &midiMessages) {
+  juce::ScopedNoDenormals noDenormals;
+  juce::ignoreUnused(midiMessages);
+  PFS_PROFILE_BLOCK(profiler, buffer.getNumSamples(), currentSampleRate);
+
+  const int totalNumInputChannels = getTotalNumInputChannels();
+  const int totalNumOutputChannels = getTotalNumOutputChannels();
+
+  for (int i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
+    buffer.clear(i, 0, buffer.getNumSamples());
+
+  // -------------------------------------------------------------------------
+  // Bypass — pass audio through unprocessed
+  // -------------------------------------------------------------------------
+  const bool bypassed = bypassParam->load() >= 0.5f;
+  if (bypassed)
+    return;
+
+  // -------------------------------------------------------------------------
+  // Quality tier change during a non-realtime render: no deadline, so the
+  // FDNs are rebuilt in place (live changes go through rebuildFDNs())
+  // -------------------------------------------------------------------------
+  if (isNonRealtime()) {
+    const FDNQuality renderQuality = selectFDNQuality();
+    if (renderQuality != fdnA.getQuality())
+      prepareFDNs(renderQuality);
+  }
+
+  const int numSamples = buffer.getNumSamples();
+  const int numWetChannels = fdnA.getNumChannels();
+  const int numChannels = juce::jmin(buffer.getNumChannels(), numWetChannels);
+
+  // -------------------------------------------------------------------------
+  // Read all parameters — atomic loads, fully real-time safe. Each is read
+  // once per block; running mutation morphs override what they cover, one
+  // wet chunk at a time.
+  // -------------------------------------------------------------------------
+  const float crossfadeSpeedMs = crossfadeSpeedParam->load();
+  const bool wfEnabled = wfEnabledParam->load() > 0.5f;
+
+  // Host BPM and transport — used by pre-delay AND the mutation clock.
+  // Fallback: 120 BPM when the host doesn't report tempo.
+  juce::Optional<juce::AudioPlayHead::PositionInfo> position;
+  if (auto *playhead = getPlayHead())
+    position = playhead->getPosition();
+
+  float bpm = 120.0f;
+  if (position.hasValue())
+    if (auto hostBpm = position->getBpm())
+      bpm = juce::jmax(20.0f, static_cast<float>(*hostBpm));
+  hostBPM.store(bpm, std::memory_order_relaxed);
+
+  // Scheduled mutation: the grid slot falling inside this block, if any.
+  // Its targets are a pure function of the seed and slot.
+  std::int64_t mutationSlot = 0;
+  const int mutationOffset =
+      advanceMutationClock(numSamples, position, bpm, mutationSlot);
+
+  MutationSnapshot scheduledMutation;
+  if (mutationOffset >= 0) {
+    const std::uint64_t seed = mutationSeed.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < kMorphParamIDs.size(); ++i) {
+      if (morphLockParams[i]->load() > 0.5f)
+        continue;
+      scheduledMutation.mask |= 1u << i;
+      scheduledMutation.targetNorm[i] =
+          mutationTargetNorm(seed, mutationSlot, static_cast<int>(i));
+    }
+  }
+
+  // The APVTS values; each wet chunk applies the running morphs on top
+  const std::array<float, kNumMorphParams> hostValues{
+      topologyParam->load(),     decayParam->load(),
+      preDelayParam->load(),     densityParam->load(),
+      spectralTiltParam->load(), resonanceParam->load(),
+      modRateParam->load(),      modDepthParam->load(),
+      widthParam->load(),        mixParam->load(),
+      lowCutParam->load(),       highCutParam->load(),
+      tiltParam->load(),         wfAmountParam->load(),
+      outputLevelParam->load(),  duckingAmountParam->load()};
+  std::array<float, kNumMorphParams> morphed = hostValues;
+
+  // -------------------------------------------------------------------------
+  // Check mutation pending flag (set by message thread, cleared here)
+  // Guard: ignore if crossfade already in progress
+  // -------------------------------------------------------------------------
+  if (mutationPending.load(std::memory_order_acquire) &&
+      xfadeState == CrossfadeState::Idle) {
+    mutationPending.store(false, std::memory_order_release);
+    beginCrossfade(crossfadeSpeedMs);
+  }
+
+  // Baked IR mode: bakes once the FDN settings hold still, and hands the
+  // input back to the FDN on any change or mutation
+  const bool bakeEnabled = bakedIRParam->load() >= 0.5f &&
+                           !mutationTimerRunning_.load() &&
+                           mutationOffset < 0 && numWetChannels == 2;
+
+  // Input level for the silent-tail detector, before the buffer turns wet
+  const bool inputSilent =
+      buffer.getMagnitude(0, numSamples) < kSilenceThreshold;
 
   // -------------------------------------------------------------------------
   // Push dry signal into DryWetMixer before in-place wet processing
@@ -882,152 +1239,282 @@ void ChaosverbAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer,
     dryWetMixer.pushDrySamples(block);
   }
 
-  // Get write pointers
-  float *dataL = (numChannels > 0) ? buffer.getWritePointer(0) : nullptr;
-  float *dataR = (numChannels > 1) ? buffer.getWritePointer(1) : nullptr;
+  // Get write pointers (nullptr for wet channels the buffer does not have)
+  float *data[kMaxWetChannels] = {};
+  for (int ch = 0; ch < numChannels; ++ch)
+    data[ch] = buffer.getWritePointer(ch);
+
+  // -------------------------------------------------------------------------
+  // Silent tail: the wet state was zeroed, so the wet output stays exactly
+  // zero until input returns. The block that brings it runs the whole wet
+  // path from its first sample, as if it had never stopped.
+  // -------------------------------------------------------------------------
+  if (tailSilent && !inputSilent)
+    tailSilent = false;
+
+  if (tailSilent) {
+    // Morphs keep running over the silence, one step for the whole block
+    readMorphedParameters(morphed, numSamples, crossfadeSpeedMs,
+                          mutationOffset >= 0 ? &scheduledMutation : nullptr);
+    const WetTargets targets = applyWetParameters(morphed, bpm);
+    bakedIR.update(targets.bakeSettings,
+                   bakeEnabled && xfadeState == CrossfadeState::Idle &&
+                       !mutationPending.load(std::memory_order_acquire),
+                   numSamples);
+
+    // A mutation has nothing to blend against silence; swap straight away
+    if (mutationOffset >= 0 && xfadeState == CrossfadeState::Idle)
+      beginCrossfade(crossfadeSpeedMs);
+    if (xfadeState == CrossfadeState::Ramping) {
+      crossfadePhase = 0.0f;
+      fdnAIsActive = !fdnAIsActive;
+      xfadeState = CrossfadeState::Idle;
+    }
+
+    PFS_PROFILE_STAGE(profiler, kStageOutput);
+    buffer.clear();
+    juce::dsp::AudioBlock<float> block(buffer);
+    dryWetMixer.mixWetSamples(block);
+    return;
+  }
 
   // -------------------------------------------------------------------------
-  // Sample-by-sample processing loop
+  // Wet path, one stage at a time over chunks of kWetChunkSize samples
   //
-  // Flow per sample:
-  //   1. Pre-delay (shared, stereo)
-  //   2. Allpass diffuser (shared, stereo)
-  //   3. Both FDNs process diffused input with per-FDN params:
+  // Flow per chunk:
+  //   0. Parameters: running morphs advance to the chunk's end, and the
+  //      stages below ramp or glide there across the chunk
+  //   1. Pre-delay (shared, every wet channel; the LFE feeds it silence)
+  //   2. Allpass diffuser (shared, every wet channel)
+  //   3. FDN-A, then FDN-B, over the diffused chunk with per-FDN params:
   //      - During crossfade: outgoing FDN uses frozen snapshot (old params),
   //        incoming FDN uses live params (new mutated values)
-  //      - When idle: both FDNs use identical live params
-  //   4. Equal-power crossfade blend:
-  //      wetL = gainOut * outgoingL + gainIn * incomingL
-  //      wetR = gainOut * outgoingR + gainIn * incomingR
+  //      - When idle: only the active FDN runs, with live params
+  //   4. Equal-power crossfade blend, per channel:
+  //      wet = gainOut * outgoing + gainIn * incoming
   //   5. Advance crossfade phase; handle state transitions
+  //   5a. Baked IR convolver summed on top (see ChaosverbBakedIR)
+  //   6. Fused post chain (width, EQ, wow/flutter, ducking; LFE cleared)
+  //   7. Output level trim
+  //   8. DryWetMixer blend
   //
-  // After all samples:
-  //   6. Stereo width M/S matrix on wet buffer
-  //   7. DryWetMixer blend
+  // Every stage only touches its own state, so running them as passes gives
+  // the same output as interleaving them per sample, and lets each stage be
+  // timed separately.
   // -------------------------------------------------------------------------
-  for (int n = 0; n < numSamples; ++n) {
-    // --- 1. Pre-delay (shared stereo) ---
-    const float rawL = (dataL != nullptr) ? dataL[n] : 0.0f;
-    const float rawR = (dataR != nullptr) ? dataR[n] : 0.0f;
-
-    preDelayLine.pushSample(0, rawL);
-    preDelayLine.pushSample(1, rawR);
-    float sigL = preDelayLine.popSample(0);
-    float sigR = preDelayLine.popSample(1);
-
-    // --- 2. Allpass diffuser (shared stereo) ---
-    if (numActiveDiffuserStages > 0) {
-      sigL = processDiffuserSample(sigL, 0, numActiveDiffuserStages);
-      sigR = processDiffuserSample(sigR, 1, numActiveDiffuserStages);
-    }
+  float *diffused[kMaxWetChannels] = {};
+  float *wetA[kMaxWetChannels] = {};
+  float *wetB[kMaxWetChannels] = {};
+  const float *silence[kMaxWetChannels] = {};
+  for (int ch = 0; ch < numWetChannels; ++ch) {
+    diffused[ch] = diffusedScratch[static_cast<size_t>(ch)].data();
+    wetA[ch] = wetAScratch[static_cast<size_t>(ch)].data();
+    wetB[ch] = wetBScratch[static_cast<size_t>(ch)].data();
+    silence[ch] = silenceScratch.data();
+  }
 
-    // --- 3. Both FDNs process with per-FDN params ---
-    float wetAL = 0.0f, wetAR = 0.0f;
-    float wetBL = 0.0f, wetBR = 0.0f;
+  WetTargets targets;
+  float wetPeak = 0.0f; // wet output, after the trim (silent-tail detector)
+
+  for (int chunkStart = 0, chunkSize = 0; chunkStart < numSamples;
+       chunkStart += chunkSize) {
+    // A scheduled mutation starts its crossfade on its exact sample: the
+    // chunk before it ends there. One landing mid-crossfade waits for it.
+    chunkSize = juce::jmin(kWetChunkSize, numSamples - chunkStart);
+    if (chunkStart == mutationOffset) {
+      if (xfadeState == CrossfadeState::Idle)
+        beginCrossfade(crossfadeSpeedMs);
+      else
+        mutationPending.store(true, std::memory_order_release);
+    } else if (mutationOffset > chunkStart &&
+               mutationOffset < chunkStart + chunkSize) {
+      chunkSize = mutationOffset - chunkStart;
+    }
 
-    if (xfadeState == CrossfadeState::Ramping) {
-      // During crossfade: outgoing uses frozen snapshot, incoming uses live
-      const auto &outSnap = outgoingSnapshot;
-      if (fdnAIsActive) {
-        // A=outgoing (old params), B=incoming (new params)
-        fdnA.processSample(sigL, sigR, outSnap.feedbackGain,
-                           outSnap.topologyBlend, outSnap.modDepthSamples,
-                           outSnap.resoSmoothCoeff, wetAL, wetAR);
-        fdnB.processSample(sigL, sigR, feedbackGain, topologyBlend,
-                           modDepthSamples, resoSmoothCoeff, wetBL, wetBR);
-      } else {
-        // A=incoming (new params), B=outgoing (old params)
-        fdnA.processSample(sigL, sigR, feedbackGain, topologyBlend,
-                           modDepthSamples, resoSmoothCoeff, wetAL, wetAR);
-        fdnB.processSample(sigL, sigR, outSnap.feedbackGain,
-                           outSnap.topologyBlend, outSnap.modDepthSamples,
-                           outSnap.resoSmoothCoeff, wetBL, wetBR);
+    // --- 0. Parameters for this chunk ---
+    morphed = hostValues;
+    readMorphedParameters(
+        morphed, chunkSize, crossfadeSpeedMs,
+        chunkStart == mutationOffset ? &scheduledMutation : nullptr);
+    targets = applyWetParameters(morphed, bpm);
+    bakedIR.update(targets.bakeSettings,
+                   bakeEnabled && xfadeState == CrossfadeState::Idle &&
+                       !mutationPending.load(std::memory_order_acquire),
+                   chunkSize);
+
+    float *chunk[kMaxWetChannels] = {};
+    for (int ch = 0; ch < numChannels; ++ch)
+      chunk[ch] = data[ch] + chunkStart;
+
+    // --- 1. Pre-delay (shared; each channel has its own line) ---
+    {
+      PFS_PROFILE_STAGE(profiler, kStagePreDelay);
+      preDelaySmoother.setTargetValue(targets.preDelaySamples);
+      const bool preDelayMoving = preDelaySmoother.isSmoothing();
+      if (preDelayMoving)
+        for (int n = 0; n < chunkSize; ++n)
+          preDelayRamp[static_cast<size_t>(n)] =
+              preDelaySmoother.getNextValue();
+      else
+        preDelayLine.setDelay(preDelaySmoother.getCurrentValue());
+
+      for (int ch = 0; ch < numWetChannels; ++ch) {
+        const float *in = ch != lfeChannel ? chunk[ch] : nullptr;
+        for (int n = 0; n < chunkSize; ++n) {
+          preDelayLine.pushSample(ch, (in != nullptr) ? in[n] : 0.0f);
+          diffused[ch][n] =
+              preDelayMoving
+                  ? preDelayLine.popSample(
+                        ch, preDelayRamp[static_cast<size_t>(n)])
+                  : preDelayLine.popSample(ch);
+        }
       }
-    } else {
-      // Idle: both FDNs use identical live params
-      fdnA.processSample(sigL, sigR, feedbackGain, topologyBlend,
-                         modDepthSamples, resoSmoothCoeff, wetAL, wetAR);
-      fdnB.processSample(sigL, sigR, feedbackGain, topologyBlend,
-                         modDepthSamples, resoSmoothCoeff, wetBL, wetBR);
     }
 
-    // --- 4. Equal-power crossfade blend ---
-    float wetL, wetR;
-    if (xfadeState == CrossfadeState::Ramping) {
-      // Equal-power: outgoing cos-fades out, incoming sin-fades in
-      const float halfPi = juce::MathConstants<float>::halfPi;
-      const float gainOut = std::cos(crossfadePhase * halfPi);
-      const float gainIn = std::sin(crossfadePhase * halfPi);
-
-      if (fdnAIsActive) {
-        // A fading out, B fading in
-        wetL = gainOut * wetAL + gainIn * wetBL;
-        wetR = gainOut * wetAR + gainIn * wetBR;
-      } else {
-        // B fading out, A fading in
-        wetL = gainOut * wetBL + gainIn * wetAL;
-        wetR = gainOut * wetBR + gainIn * wetAR;
+    // --- 2. Allpass diffuser (shared) ---
+    if (diffuser.getNumActiveStages() > 0) {
+      PFS_PROFILE_STAGE(profiler, kStageDiffuser);
+      diffuser.process(chunkSize, diffused);
+    }
+
+    // --- 3. FDNs process with per-FDN params ---
+    // Samples still inside the crossfade at the start of this chunk; the
+    // phase is replayed exactly as step 5 advances it. A chunk that starts
+    // idle only needs the active FDN; one that starts ramping runs both to
+    // its end (the blend below reads both until the crossfade completes).
+    // Each FDN glides from the parameters of its last chunk to these.
+    const bool runBothFDNs = xfadeState == CrossfadeState::Ramping;
+    const bool runFDNs = bakedIR.isFDNRunning();
+    const float *const *fdnIn =
+        bakedIR.convolverOwnsInput() ? silence : diffused;
+    int numRampSamples = 0;
+    if (runBothFDNs) {
+      float phase = crossfadePhase;
+      while (numRampSamples < chunkSize) {
+        ++numRampSamples;
+        phase += crossfadePhaseInc;
+        if (phase >= 1.0f)
+          break;
       }
-    } else {
-      wetL = fdnAIsActive ? wetAL : wetBL;
-      wetR = fdnAIsActive ? wetAR : wetBR;
     }
 
-    if (dataL != nullptr)
-      dataL[n] = wetL;
-    if (dataR != nullptr)
-      dataR[n] = wetR;
+    if (runFDNs && (runBothFDNs || fdnAIsActive)) {
+      // A is outgoing (frozen) while it is the active FDN
+      PFS_PROFILE_STAGE(profiler, kStageFdnA);
+      processFDNPass(fdnA, fdnIn, wetA, chunkSize,
+                     fdnAIsActive ? numRampSamples : 0, outgoingSnapshot,
+                     targets.fdnParams);
+    }
+    if (runFDNs && (runBothFDNs || !fdnAIsActive)) {
+      PFS_PROFILE_STAGE(profiler, kStageFdnB);
+      processFDNPass(fdnB, fdnIn, wetB, chunkSize,
+                     fdnAIsActive ? 0 : numRampSamples, outgoingSnapshot,
+                     targets.fdnParams);
+    }
+    if (!runFDNs) {
+      // Baked and rung out: the FDN is skipped and contributes silence
+      for (int ch = 0; ch < numWetChannels; ++ch)
+        std::fill_n(fdnAIsActive ? wetA[ch] : wetB[ch], chunkSize, 0.0f);
+    }
+
+    {
+      PFS_PROFILE_STAGE(profiler, kStageCrossfade);
 
-    // --- 5. Advance crossfade phase and handle state transitions ---
-    if (xfadeState == CrossfadeState::Ramping) {
-      crossfadePhase += crossfadePhaseInc;
+      // --- 4. Equal-power crossfade blend over the ramping samples ---
+      // Outgoing cos-fades out, incoming sin-fades in
+      if (runBothFDNs) {
+        float *const *outgoing = fdnAIsActive ? wetA : wetB;
+        float *const *incoming = fdnAIsActive ? wetB : wetA;
+        const float halfPi = juce::MathConstants<float>::halfPi;
+
+        for (int n = 0; n < numRampSamples; ++n) {
+          const float gainOut = std::cos(crossfadePhase * halfPi);
+          const float gainIn = std::sin(crossfadePhase * halfPi);
 
-      if (crossfadePhase >= 1.0f) {
-        crossfadePhase = 0.0f;
+          for (int ch = 0; ch < numChannels; ++ch)
+            chunk[ch][n] = gainOut * outgoing[ch][n] + gainIn * incoming[ch][n];
 
-        // Swap roles: incoming FDN becomes active
-        fdnAIsActive = !fdnAIsActive;
-        xfadeState = CrossfadeState::Idle;
+          crossfadePhase += crossfadePhaseInc;
+        }
+
+        // --- 5. Crossfade complete: incoming FDN becomes active ---
+        if (crossfadePhase >= 1.0f) {
+          crossfadePhase = 0.0f;
+          fdnAIsActive = !fdnAIsActive;
+          xfadeState = CrossfadeState::Idle;
+        }
+      }
+
+      // Remainder of the chunk comes from the (possibly just swapped) active
+      // FDN
+      const int numActiveSamples = chunkSize - numRampSamples;
+      if (numActiveSamples > 0) {
+        float *const *active = fdnAIsActive ? wetA : wetB;
+        for (int ch = 0; ch < numChannels; ++ch)
+          std::copy_n(active[ch] + numRampSamples, numActiveSamples,
+                      chunk[ch] + numRampSamples);
       }
     }
-  }
 
-  // -------------------------------------------------------------------------
-  // 5b. Haas delay on R channel — temporal decorrelation for broadband width.
-  //     Applied AFTER crossfade, BEFORE M/S width processing.
-  //     At width=0% delay is 0 (pass-through), scaling to 12ms at 300%.
-  // -------------------------------------------------------------------------
-  if (dataR != nullptr) {
-    haasDelaySmoother.setTargetValue(haasDelaySamples);
-    for (int n = 0; n < numSamples; ++n) {
-      haasDelayLine.pushSample(0, dataR[n]);
-      const float smoothedHaas = haasDelaySmoother.getNextValue();
-      dataR[n] = haasDelayLine.popSample(0, juce::jmax(0.0f, smoothedHaas));
+    // --- 5a. Baked IR convolver, summed on top of the FDN ---
+    // It gets the diffused input once baked, silence while priming or
+    // ringing out after the FDN took over again. Stereo core only.
+    if (bakedIR.isConvolverRunning()) {
+      PFS_PROFILE_STAGE(profiler, kStageConvolver);
+      const bool ownsInput = bakedIR.convolverOwnsInput();
+      bakedIR.process(chunkSize, ownsInput ? diffused[0] : nullptr,
+                      ownsInput ? diffused[1] : nullptr, chunk[0], chunk[1]);
     }
-  }
 
-  applyStereoWidth(numSamples, dataL, dataR, widthGain);
+    // --- 6. Post chain, fused per frame: Haas delay on R and M/S width
+    // (stereo; wider layouts spread around the mean), output EQ,
+    // wow/flutter and ducking. At width=0% the Haas delay is 0
+    // (pass-through), scaling to 25ms at 400%. ---
+    {
+      PFS_PROFILE_STAGE(profiler, kStagePostChain);
+      processPostChain(chunkSize, chunk, numChannels, targets.widthGain,
+                       targets.haasDelaySamples, targets.wfAmount, wfEnabled,
+                       targets.duckingNorm);
+    }
 
-  outputEQ.process(numSamples, dataL, dataR);
+    PFS_PROFILE_STAGE(profiler, kStageOutput);
 
-  wowFlutter.process(numSamples, dataL, dataR, wfAmount, wfEnabled);
+    // --- 7. Output level gain trim on the WET signal only (before the
+    // dry/wet mix), ramped across the chunk when it moves ---
+    const float outputGain = targets.outputGain;
+    if (outputGain != lastOutputGain)
+      buffer.applyGainRamp(chunkStart, chunkSize, lastOutputGain, outputGain);
+    else if (outputGain != 1.0f)
+      buffer.applyGain(chunkStart, chunkSize, outputGain);
+    lastOutputGain = outputGain;
 
-  applyDucking(numSamples, dataL, dataR, duckingNorm);
+    wetPeak = juce::jmax(wetPeak, buffer.getMagnitude(chunkStart, chunkSize));
 
-  // -------------------------------------------------------------------------
-  // 7. Apply output level gain trim to WET signal only (before dry/wet mix)
-  // -------------------------------------------------------------------------
-  if (std::abs(outputLevelDb) > 0.01f) {
-    const float outputGain = juce::Decibels::decibelsToGain(outputLevelDb);
-    buffer.applyGain(outputGain);
+    // --- 8. Mix the chunk back with dry via DryWetMixer (its mix target
+    // was set with the chunk's parameters) ---
+    juce::dsp::AudioBlock<float> block(buffer);
+    dryWetMixer.mixWetSamples(block.getSubBlock(
+        static_cast<size_t>(chunkStart), static_cast<size_t>(chunkSize)));
   }
 
   // -------------------------------------------------------------------------
-  // 8. Mix wet signal back with dry via DryWetMixer
+  // Silent-tail detector: the input has been silent past the pre-delay and
+  // the wet output has stayed quiet for the hold time; confirm on the
+  // running peaks the FDN and diffuser keep of their ring writes before
+  // zeroing it all
   // -------------------------------------------------------------------------
-  {
-    juce::dsp::AudioBlock<float> block(buffer);
-    dryWetMixer.mixWetSamples(block);
+  if (inputSilent && xfadeState == CrossfadeState::Idle &&
+      wetPeak < kSilenceThreshold) {
+    silentSamples = juce::jmin(silentSamples + numSamples,
+                               std::numeric_limits<int>::max() / 2);
+    const float holdSamples =
+        targets.preDelaySamples +
+        kSilenceHoldSeconds * static_cast<float>(currentSampleRate);
+    if (static_cast<float>(silentSamples) >= holdSamples &&
+        isWetStateSilent())
+      enterSilentTail();
+  } else {
+    silentSamples = 0;
   }
 }
 
@@ -1039,6 +1526,9 @@ juce::AudioProcessorEditor *ChaosverbAudioProcessor::createEditor() {
 //==============================================================================
 void ChaosverbAudioProcessor::getStateInformation(juce::MemoryBlock &destData) {
   auto state = parameters.copyState();
+  state.setProperty("mutationSeed",
+                    juce::String(static_cast<juce::int64>(mutationSeed.load())),
+                    nullptr);
   std::unique_ptr<juce::XmlElement> xml(state.createXml());
   copyXmlToBinary(*xml, destData);
 }
@@ -1048,8 +1538,17 @@ void ChaosverbAudioProcessor::setStateInformation(const void *data,
   std::unique_ptr<juce::XmlElement> xmlState(
       getXmlFromBinary(data, sizeInBytes));
 
-  if (xmlState != nullptr && xmlState->hasTagName(parameters.state.getType()))
-    parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
+  if (xmlState == nullptr || !xmlState->hasTagName(parameters.state.getType()))
+    return;
+
+  auto state = juce::ValueTree::fromXml(*xmlState);
+
+  // Older sessions have no seed and keep this instance's
+  if (state.hasProperty("mutationSeed"))
+    mutationSeed.store(static_cast<std::uint64_t>(
+        state["mutationSeed"].toString().getLargeIntValue()));
+
+  parameters.replaceState(state);
 }
 
 //==============================================================================
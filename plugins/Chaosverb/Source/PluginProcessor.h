@@ -3,8 +3,16 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 
+#include <pfs/MemoryFootprint.h>
+#include <pfs/RandomSeed.h>
+#include <pfs/SpscRing.h>
+#include <pfs/StageProfiler.h>
+
+#include <array>
 #include <atomic>
 
+#include "ChaosverbBakedIR.h"
+#include "ChaosverbDiffuser.h"
 #include "ChaosverbEQ.h"
 #include "ChaosverbFDN.h"
 #include "ChaosverbWowFlutter.h"
@@ -18,11 +26,13 @@
  * on a user-defined interval. Dual FDN instances support crossfade between
  * current and new reverb states.
  *
- * Plugin type: Audio Effect (stereo in / stereo out)
- * Parameters: 31 (16 Float + 15 Bool)
+ * Plugin type: Audio Effect (mono, stereo, 5.1 or 7.1.4; input matches the
+ * output, or mono feeds stereo)
+ * Parameters: 39 (18 Float + 19 Bool + 2 Choice)
  *
  * Phase 4.3: Dual FDN + Crossfade System.
- * - FDN-A and FDN-B run continuously (both always process audio)
+ * - Only the active FDN runs while idle. On mutation the other one is woken
+ *   as a clone of the active state, and both run until the crossfade ends.
  * - Pre-delay, allpass diffuser, DryWetMixer, and stereo width are shared
  *   at PluginProcessor level (moved out of ChaosverbFDN)
  * - Equal-power crossfader blends FDN-A and FDN-B wet outputs
@@ -30,12 +40,41 @@
  * - triggerCrossfade() public method: used by UI and mutation timer
  *
  * Phase 4.4: Mutation Timer + Lock System.
- * - MutationTimer fires every mutationInterval seconds on the message thread
- * - triggerMutation() reads 10 lock params, randomizes unlocked params,
- * triggers crossfade
+ * - The mutation clock runs on the audio thread: note divisions land on the
+ *   host's PPQ grid and free times on its sample timeline while it plays
+ *   (its own sample count otherwise), at the exact sample within the block.
+ *   Targets are a hash of a per-instance seed and the grid slot, so bounces
+ *   of the same session mutate identically.
+ * - triggerMutation() (Mutate Now) reads the lock params, sends a random
+ *   target snapshot of the unlocked params and triggers the crossfade
+ * - The audio thread morphs to the snapshot over crossfadeSpeed; the host is
+ *   given the new values once, when the morph ends (MutationTimer)
  * - getRemainingTimeMs() for UI countdown display
+ *
+ * Quality tiers: both FDNs run the network size picked by the quality
+ * parameter (Eco/Normal/High/Offline: 4/8/16/32 lines), or by renderQuality
+ * when the host renders non-realtime. A live change is applied on the
+ * message thread (rebuildFDNs()), an offline one inside processBlock().
+ *
+ * Baked IR mode (bakedIR): once the FDN settings hold still and no mutation
+ * is running, the wet path swaps the FDN for a partitioned convolution of its
+ * rendered impulse response (see nbs::ChaosverbBakedIR).
+ *
+ * Silent tail: once the input has been below -120 dBFS for longer than the
+ * pre-delay and the wet output and FDN/diffuser state have fallen below it
+ * too, the wet state is zeroed and the wet path skipped until input returns.
+ *
+ * Surround: the wet path runs at the output's channel count (2, 6 or 12), one
+ * FDN lane per channel, so every speaker gets its own decorrelated tail. The
+ * LFE channel is kept out of the reverb. Haas delay, M/S width and baked IR
+ * mode are stereo-only; wider layouts spread each channel around the mean.
+ *
+ * Stage profiling: the wet path runs as per-stage passes over chunks of
+ * kWetChunkSize samples so each stage can be timed on its own (see profiler).
  */
-class ChaosverbAudioProcessor : public juce::AudioProcessor {
+class ChaosverbAudioProcessor : public juce::AudioProcessor,
+                                public pfs::StageProfilerSource,
+                                public pfs::MemoryFootprintSource {
 public:
   //==========================================================================
   ChaosverbAudioProcessor();
@@ -46,6 +85,10 @@ public:
   void prepareToPlay(double sampleRate, int samplesPerBlock) override;
   void releaseResources() override;
   void processBlock(juce::AudioBuffer<float> &, juce::MidiBuffer &) override;
+  bool isBusesLayoutSupported(const BusesLayout &layouts) const override;
+
+  // Switches the FDN quality tier between quality and renderQuality
+  void setNonRealtime(bool nonRealtime) noexcept override;
 
   //==========================================================================
   juce::AudioProcessorEditor *createEditor() override;
@@ -57,8 +100,9 @@ public:
   bool producesMidi() const override { return false; }
   bool isMidiEffect() const override { return false; }
 
-  // Report tail length as max decay (60s) so DAW knows to keep plugin alive
-  double getTailLengthSeconds() const override { return 60.0; }
+  // Time for the FDN to fall to the silent-tail threshold at the current
+  // decay and feedback gain, plus the pre-delay
+  double getTailLengthSeconds() const override;
 
   //==========================================================================
   int getNumPrograms() override { return 1; }
@@ -90,10 +134,11 @@ public:
    * Trigger a full mutation cycle immediately.
    *
    * Must be called from the message thread only (timer callback, UI button).
-   * Reads all 10 lock boolean parameters. For each unlocked parameter,
-   * generates a uniform random normalized value (0..1) and writes it to APVTS
-   * via setValueNotifyingHost(). Then calls triggerCrossfade() to blend to new
-   * state.
+   * Reads the lock parameters. For each unlocked parameter, generates a
+   * uniform random normalized value (0..1). The targets go to the audio
+   * thread as one MutationSnapshot, which morphs to them over crossfadeSpeed;
+   * MorphCommitTimer writes them to APVTS via setValueNotifyingHost() once
+   * the morph has ended. Then calls triggerCrossfade() to blend to new state.
    *
    * Guard: if mutationPending is already true (previous crossfade not yet
    * started), skips the mutation to prevent overlapping state changes.
@@ -102,14 +147,11 @@ public:
 
   //==========================================================================
   /**
-   * Returns the remaining time in milliseconds until the next mutation fires.
+   * Returns the remaining time in milliseconds until the next mutation fires,
+   * as of the start of the last processed block, or -1 while the mutation
+   * timer is stopped.
    *
-   * Computed as: mutationInterval * 1000 - (now - lastMutationTimeMs)
-   * Clamped to [0, mutationInterval * 1000].
-   * Returns 0.0 if the timer has not been started yet.
-   *
-   * Safe to call from any thread (message or UI). lastMutationTimeMs is
-   * written only from the message thread (timer callback + prepareToPlay).
+   * Safe to call from any thread; the audio thread publishes it per block.
    */
   double getRemainingTimeMs() const;
 
@@ -122,6 +164,14 @@ public:
   void setMutationTimerRunning(bool running);
   bool isMutationTimerRunning() const;
 
+  /**
+   * Write the last baked impulse response to a 32-bit stereo WAV.
+   * Returns false if nothing has been baked yet. Message thread.
+   */
+  bool exportBakedIR(const juce::File &file) const {
+    return bakedIR.exportImpulseResponse(file);
+  }
+
   //==========================================================================
   // APVTS — public so PluginEditor can access for parameter attachments
   juce::AudioProcessorValueTreeState parameters;
@@ -147,6 +197,10 @@ public:
   std::atomic<float> *outputLevelParam = nullptr;
   std::atomic<float> *duckingAmountParam = nullptr;
   std::atomic<float> *bypassParam = nullptr;
+  std::atomic<float> *qualityParam = nullptr;
+  std::atomic<float> *renderQualityParam = nullptr;
+  std::atomic<float> *bakedIRParam = nullptr;
+  std::atomic<float> *mutationIntervalParam = nullptr;
 
   //==========================================================================
   // Crossfade state machine — values accessed from audio thread only (except
@@ -159,6 +213,29 @@ public:
   // needed.
   std::atomic<bool> mutationPending{false};
 
+  //==========================================================================
+  // Per-stage processBlock timings (compiled in with -DPFS_PROFILING=ON).
+  // Written by the audio thread, drained by the editor's CPU meter timer.
+  enum ProfileStage {
+    kStagePreDelay,
+    kStageDiffuser,
+    kStageFdnA,
+    kStageFdnB,
+    kStageCrossfade,
+    kStageConvolver,
+    kStagePostChain,
+    kStageOutput
+  };
+
+  pfs::StageProfiler profiler{"Pre-delay", "Diffuser",  "FDN A",
+                              "FDN B",     "Crossfade", "Convolver",
+                              "Post chain", "Output"};
+
+  pfs::StageProfiler &getStageProfiler() noexcept override { return profiler; }
+
+  // Delay-line and FDN arena sizes after prepareToPlay() (benchmark harness)
+  void getMemoryFootprint(pfs::MemoryFootprint &footprint) const override;
+
 private:
   //==========================================================================
   // Phase 4.4 — Mutation timer system
@@ -167,28 +244,17 @@ private:
    * MutationTimer
    *
    * juce::Timer subclass owned by PluginProcessor (as a member, NOT via
-   * inheritance). Fires on the JUCE message thread at the current
-   * mutationInterval. On each tick, calls processor.triggerMutation().
+   * inheritance). Polls every 50ms on the JUCE message thread for mutations
+   * the audio thread has fired and schedules their host commit (see
+   * drainFiredMutations()). It never decides when a mutation fires.
    *
-   * Uses juce::Timer (not HighResolutionTimer) — message thread is fine for
-   * 5–600 second intervals. Timer is started in prepareToPlay() and stopped
-   * in the PluginProcessor destructor.
+   * Started in the constructor and stopped in the destructor.
    */
   class MutationTimer : public juce::Timer {
   public:
     explicit MutationTimer(ChaosverbAudioProcessor &p) : processor(p) {}
 
-    void timerCallback() override {
-      // Polling approach: check elapsed time against CURRENT interval value.
-      // computeMutationIntervalMs() handles bipolar interpretation:
-      // positive = absolute ms, negative = BPM-synced note divisions.
-      const double intervalMs = processor.computeMutationIntervalMs();
-      const double now = juce::Time::getMillisecondCounterHiRes();
-      const double elapsed = now - processor.lastMutationTimeMs;
-
-      if (elapsed >= intervalMs)
-        processor.triggerMutation();
-    }
+    void timerCallback() override { processor.drainFiredMutations(); }
 
   private:
     ChaosverbAudioProcessor &processor;
@@ -201,48 +267,232 @@ private:
   // visible).
   std::atomic<bool> mutationTimerRunning_{false};
 
-  // Host BPM — updated from processBlock via AudioPlayHead, read by timer
-  // callback. Fallback: 120 BPM when host doesn't report tempo.
+  // Host BPM — updated from processBlock via AudioPlayHead.
+  // Fallback: 120 BPM when host doesn't report tempo.
   std::atomic<float> hostBPM{120.0f};
 
   // Compute the effective mutation interval in milliseconds from the bipolar
   // mutationInterval parameter. Positive = absolute ms, negative = BPM-synced
   // note divisions. Returns minimum 50ms to prevent runaway mutations.
-  double computeMutationIntervalMs() const;
+  static double computeMutationIntervalMs(float intervalVal, float bpm);
+
+  // Note division (in quarter notes) of a negative mutationInterval value,
+  // 0 at the centre dead zone
+  static double mutationDivisionBeats(float intervalVal);
+
+  //==========================================================================
+  // Mutation clock — audio thread only, except remainingMutationMs
+
+  // Where the clock reads its position from. A change restarts the count.
+  enum class MutationClockSource { Stopped, HostPPQ, HostSamples, Internal };
+
+  MutationClockSource mutationClockSource = MutationClockSource::Stopped;
+  std::int64_t lastMutationSlot = 0;    // last grid slot fired
+  double lastMutationPos = 0.0;         // block-start position last seen
+  double internalClockSamples = 0.0;    // Internal: samples since start
+
+  // Per-instance seed for the slot hash; saved with the state so a session
+  // bounces the same way every time
+  std::atomic<std::uint64_t> mutationSeed{0};
+
+  std::atomic<float> remainingMutationMs{-1.0f};
 
-  // Timestamp of the last mutation (or prepareToPlay). Used for
-  // getRemainingTimeMs(). Written only from message thread (prepareToPlay +
-  // timer callback). Read from message/UI thread via getRemainingTimeMs().
-  double lastMutationTimeMs{0.0};
+  // Sample offset in this block at which the next mutation slot falls, or
+  // -1. slot receives the grid slot index for mutationTargetNorm().
+  int advanceMutationClock(
+      int numSamples,
+      const juce::Optional<juce::AudioPlayHead::PositionInfo> &position,
+      float bpm, std::int64_t &slot);
+
+  // Normalized target of one parameter for a grid slot (SplitMix64 hash)
+  static float mutationTargetNorm(std::uint64_t seed, std::int64_t slot,
+                                  int param);
 
   //==========================================================================
-  // Glide system — smooth parameter transitions during mutation.
-  // Instead of snapping params instantly, glide toward targets over
-  // crossfadeSpeed duration on the message thread (~60Hz timer).
+  // Mutation morph — a mutation sends the audio thread one snapshot of
+  // normalized targets for the unlocked parameters. The audio thread glides
+  // each one there over crossfadeSpeed and keeps overriding it until the
+  // message thread has written the targets to the host, once, at the end.
+  // Nothing is written to APVTS while a morph runs.
+
+  enum MorphParam {
+    kMorphTopology,
+    kMorphDecay,
+    kMorphPreDelay,
+    kMorphDensity,
+    kMorphSpectralTilt,
+    kMorphResonance,
+    kMorphModRate,
+    kMorphModDepth,
+    kMorphWidth,
+    kMorphMix,
+    kMorphLowCut,
+    kMorphHighCut,
+    kMorphTilt,
+    kMorphWowFlutterAmount,
+    kMorphOutputLevel,
+    kMorphDuckingAmount,
+    kNumMorphParams
+  };
 
-  static constexpr int kMaxGlideParams = 16;
+  struct MorphParamIDs {
+    const char *param;
+    const char *lock;
+  };
 
-  struct ParamGlideTarget {
-    juce::RangedAudioParameter *param = nullptr;
-    float startNorm = 0.0f;
-    float targetNorm = 0.0f;
+  static constexpr std::array<MorphParamIDs, kNumMorphParams> kMorphParamIDs{{
+      {"topology", "topologyLock"},
+      {"decay", "decayLock"},
+      {"preDelay", "preDelayLock"},
+      {"density", "densityLock"},
+      {"spectralTilt", "spectralTiltLock"},
+      {"resonance", "resonanceLock"},
+      {"modRate", "modRateLock"},
+      {"modDepth", "modDepthLock"},
+      {"width", "widthLock"},
+      {"mix", "mixLock"},
+      {"lowCut", "lowCutLock"},
+      {"highCut", "highCutLock"},
+      {"tilt", "tiltLock"},
+      {"wowFlutterAmount", "wowFlutterAmountLock"},
+      {"outputLevel", "outputLevelLock"},
+      {"duckingAmount", "duckingAmountLock"},
+  }};
+
+  struct MutationSnapshot {
+    std::array<float, kNumMorphParams> targetNorm{};
+    juce::uint32 mask = 0; // bit per MorphParam: unlocked, so morphing
+    int generation = 0;
   };
 
-  std::array<ParamGlideTarget, kMaxGlideParams> glideTargets{};
-  int numActiveGlides = 0;
-  float glidePhase = 0.0f;
-  float glidePhaseInc = 0.0f;
+  // Resolved once in the constructor, in MorphParam order
+  std::array<juce::RangedAudioParameter *, kNumMorphParams> morphParams{};
+
+  // Lock parameter values, in MorphParam order (audio thread masks)
+  std::array<std::atomic<float> *, kNumMorphParams> morphLockParams{};
+
+  // Message thread -> audio thread: Mutate Now snapshots
+  pfs::SpscRing<MutationSnapshot, 4> mutationSnapshots;
+
+  // Audio thread -> message thread: every mutation started, with the
+  // generation it was given, for the host commit
+  pfs::SpscRing<MutationSnapshot, 8> firedMutations;
+
+  // Last generation written to the host; the audio thread drops its
+  // overrides up to here once their morph is done
+  std::atomic<int> committedMorphGeneration{0};
+
+  // Message thread: the last mutation's targets until they are committed
+  MutationSnapshot pendingCommit;
+
+  // Writes pendingCommit to the host (one setValueNotifyingHost() each)
+  void commitPendingMorph();
 
-  class GlideTimer : public juce::Timer {
+  // Message thread: takes fired mutations from the audio thread and commits
+  // each one crossfadeSpeed later (or when the next one arrives)
+  void drainFiredMutations();
+
+  class MorphCommitTimer : public juce::Timer {
   public:
-    explicit GlideTimer(ChaosverbAudioProcessor &p) : processor(p) {}
-    void timerCallback() override;
+    explicit MorphCommitTimer(ChaosverbAudioProcessor &p) : processor(p) {}
+    void timerCallback() override { processor.commitPendingMorph(); }
 
   private:
     ChaosverbAudioProcessor &processor;
   };
 
-  GlideTimer glideTimerObj{*this};
+  MorphCommitTimer morphCommitTimer{*this};
+
+  // Audio thread: one glide per parameter, so a new mutation picks up any
+  // parameter mid-morph from where it is
+  struct ParamMorph {
+    float fromNorm = 0.0f;
+    float toNorm = 0.0f;
+    float phase = 0.0f;
+    float phaseInc = 0.0f;
+    int generation = 0;
+    bool active = false;
+  };
+
+  std::array<ParamMorph, kNumMorphParams> paramMorphs{};
+  int morphGeneration = 0; // audio thread: last generation handed out
+
+  // Audio thread: starts a morph to snapshot at the current chunk and
+  // reports it to the message thread. values hold the APVTS values.
+  void startMorph(MutationSnapshot snapshot, float phaseInc,
+                  const std::array<float, kNumMorphParams> &values);
+
+  // Audio thread: advances running morphs by the numSamples of the next wet
+  // chunk, then applies them to values (the APVTS values on entry), giving
+  // the plain values the chunk ends on. scheduled (may be nullptr) starts at
+  // the chunk.
+  void readMorphedParameters(std::array<float, kNumMorphParams> &values,
+                             int numSamples, float crossfadeSpeedMs,
+                             const MutationSnapshot *scheduled);
+
+  // Per-chunk targets derived from the morphed parameter values
+  struct WetTargets {
+    FDNParamSnapshot fdnParams;
+    nbs::IRBakeSettings bakeSettings;
+    float preDelaySamples = 0.0f;
+    float widthGain = 1.0f;
+    float haasDelaySamples = 0.0f;
+    float wfAmount = 0.0f;
+    float duckingNorm = 0.0f;
+    float outputGain = 1.0f;
+  };
+
+  // Audio thread: hands one chunk's values to the stages that take them as
+  // targets (diffuser, FDN coefficients, output EQ, dry/wet mix) and returns
+  // the rest, which the chunk's stages ramp towards
+  WetTargets applyWetParameters(const std::array<float, kNumMorphParams> &values,
+                                float bpm);
+
+  // Audio thread: clones the active FDN into the idle one and starts the
+  // equal-power crossfade
+  void beginCrossfade(float crossfadeSpeedMs);
+
+  // Output trim of the last chunk, ramped from when it changes
+  float lastOutputGain = 1.0f;
+
+  //==========================================================================
+  // Quality tier switching. Resizing the FDNs allocates, so a change of the
+  // quality parameters (or of the realtime mode) only flags a rebuild, and
+  // this timer does it on the message thread (see rebuildFDNs()). Listeners
+  // fire on whichever thread set the parameter, which under host automation
+  // is the audio thread, so parameterChanged() must not post messages.
+  class FDNRebuilder : public juce::Timer,
+                       public juce::AudioProcessorValueTreeState::Listener {
+  public:
+    explicit FDNRebuilder(ChaosverbAudioProcessor &p) : processor(p) {}
+
+    // Any thread: lock-free, picked up by the next timer tick
+    void requestRebuild() { pending.store(true, std::memory_order_release); }
+
+    void parameterChanged(const juce::String &, float) override {
+      requestRebuild();
+    }
+    void timerCallback() override {
+      if (pending.exchange(false, std::memory_order_acq_rel))
+        processor.rebuildFDNs();
+    }
+
+  private:
+    ChaosverbAudioProcessor &processor;
+    std::atomic<bool> pending{false};
+  };
+
+  FDNRebuilder fdnRebuilder{*this};
+
+  // quality, or renderQuality while the host renders non-realtime
+  FDNQuality selectFDNQuality() const;
+
+  // (Re)allocates both FDNs at fdnSpec for the given tier and resets the
+  // crossfade state. Not realtime safe.
+  void prepareFDNs(FDNQuality quality);
+
+  // Message thread: suspends processing and applies the selected tier
+  void rebuildFDNs();
 
   //==========================================================================
   // Phase 4.3 DSP — Shared pre-processing stage (moved out of ChaosverbFDN)
@@ -255,15 +505,9 @@ private:
                        juce::dsp::DelayLineInterpolationTypes::Lagrange3rd>
       preDelayLine;
 
-  // Allpass diffuser — 4 Schroeder stages with prime delays (scaled at prepare
-  // time) Stage delays at 48kHz: 347, 557, 743, 1013 samples
-  static constexpr int kNumDiffuserStages = 4;
-  static constexpr int kAllpassLengths48k[kNumDiffuserStages] = {347, 557, 743,
-                                                                 1013};
-  static constexpr float kAllpassCoeff = 0.7f;
-
-  juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::None>
-      diffLines[kNumDiffuserStages];
+  // Allpass diffuser — 4 Schroeder stages with prime delays, block-processed
+  // in place after the pre-delay. Density selects how many stages run.
+  nbs::ChaosverbDiffuser diffuser;
 
   // Dry/wet mixer — applied after crossfader blends A and B wet outputs
   juce::dsp::DryWetMixer<float> dryWetMixer;
@@ -273,16 +517,18 @@ private:
   nbs::ChaosverbEQ outputEQ;
 
   // Haas delay — mono delay applied to R channel wet signal for broadband
-  // width. Adds temporal decorrelation that complements the FDN's spectral
-  // decorrelation. Delay time scales with width parameter: 0% = 0ms, 300% =
-  // 12ms.
+  // width (stereo layout only). Adds temporal decorrelation that complements
+  // the FDN's spectral decorrelation. Delay time scales with width parameter:
+  // 0% = 0ms, 300% = 12ms.
   juce::dsp::DelayLine<float,
                        juce::dsp::DelayLineInterpolationTypes::Lagrange3rd>
       haasDelayLine;
 
   // Per-sample smoothers for zipper-free parameter changes
+  juce::SmoothedValue<float> preDelaySmoother;
   juce::SmoothedValue<float> widthSmoother;
   juce::SmoothedValue<float> haasDelaySmoother;
+  juce::SmoothedValue<float> duckingSmoother;
 
   //==========================================================================
   // Wow & Flutter — modulated pitch shift applied to wet signal after EQ.
@@ -296,26 +542,55 @@ private:
   float duckReleaseCoeff = 0.0f;
 
   //==========================================================================
-  // Per-FDN parameter snapshot for true crossfade between old/new reverb
-  // states. Captures per-sample DSP params so outgoing FDN keeps old reverb
-  // character while incoming FDN uses new mutated params during crossfade.
-  struct FDNParamSnapshot {
-    float feedbackGain = 0.0f;
-    float topologyBlend = 0.65f;
-    float modDepthSamples = 0.0f;
-    float resoSmoothCoeff = 0.0f;
-  };
-
+  // Per-FDN parameter snapshots (FDNParamSnapshot, ChaosverbFDN.h) for true
+  // crossfade between old/new reverb states: the outgoing FDN keeps old
+  // reverb character while the incoming FDN uses new mutated params.
   FDNParamSnapshot activeSnapshot;   // Tracks live params when idle
   FDNParamSnapshot outgoingSnapshot; // Frozen old params during crossfade
 
   //==========================================================================
-  // Dual FDN instances — both always run (no idle optimization)
+  // Wet-path scratch — pre-delay/diffuser output and each FDN's wet output
+  // for one chunk, per wet channel, plus a never-written silent channel.
+  // Fixed size so hosts that exceed samplesPerBlock are safe.
+  static constexpr int kWetChunkSize = 256;
+  static constexpr int kMaxWetChannels = ChaosverbFDN::kMaxChannels;
+
+  using WetChunk = std::array<float, kWetChunkSize>;
+  std::array<WetChunk, kMaxWetChannels> diffusedScratch{};
+  std::array<WetChunk, kMaxWetChannels> wetAScratch{};
+  std::array<WetChunk, kMaxWetChannels> wetBScratch{};
+  WetChunk silenceScratch{};
+
+  // Smoother values for the chunk: pre-delay, and width, Haas delay and
+  // ducking depth in the post chain
+  WetChunk preDelayRamp{};
+  WetChunk widthRamp{};
+  WetChunk haasDelayRamp{};
+  WetChunk duckingRamp{};
+
+  static_assert(kWetChunkSize <= nbs::ChaosverbEQ::kMaxRampSize &&
+                    kWetChunkSize <= nbs::ChaosverbWowFlutter::kMaxRampSize,
+                "post-chain chunks must fit the EQ and wow/flutter ramps");
+
+  // Output channel kept out of the wet path (-1 when the layout has no LFE)
+  int lfeChannel = -1;
+
+  //==========================================================================
+  // Dual FDN instances — only the active one runs while idle.
   // FDN-A is the "active" instance (full gain) at startup.
-  // When crossfade completes, roles swap: B becomes active, A becomes idle.
+  // Crossfade start clones the active state into the idle one; when the
+  // crossfade completes, roles swap: B becomes active, A goes idle.
   ChaosverbFDN fdnA;
   ChaosverbFDN fdnB;
 
+  // Wet spec of the last prepareToPlay() (channels rounded up to an FDN
+  // core: 2, 6 or 12), reused when the quality tier changes (sampleRate 0
+  // until then)
+  juce::dsp::ProcessSpec fdnSpec{};
+
+  // Baked IR mode — convolver that stands in for the FDNs while static
+  nbs::ChaosverbBakedIR bakedIR;
+
   //==========================================================================
   // Crossfade state machine — audio thread only
   CrossfadeState xfadeState = CrossfadeState::Idle;
@@ -336,16 +611,41 @@ private:
   double currentSampleRate = 48000.0;
 
   //==========================================================================
-  // Helper: process one sample through the 4-stage Schroeder allpass diffuser.
-  // Only numActiveStages are applied (0-4), controlled by density parameter.
-  float processDiffuserSample(float input, int channel, int numActiveStages);
+  // Silent-tail early exit — audio thread only, except the tail inputs
+  // below, which getTailLengthSeconds() reads from the message thread.
+  static constexpr float kSilenceThreshold = 1.0e-6f; // -120 dBFS
+  static constexpr float kSilenceHoldSeconds = 0.05f; // > Haas delay (25 ms)
+
+  bool tailSilent = false;
+  int silentSamples = 0; // input and wet output both below the threshold
+
+  // Mean FDN loop time at the current tier, and the last block's pre-delay
+  std::atomic<float> meanLoopSeconds{0.0f};
+  std::atomic<float> preDelaySeconds{0.0f};
+
+  // Wet state below the threshold, from the running peaks the diffuser and
+  // active FDN keep as they write their rings (no arena scan)
+  bool isWetStateSilent() const;
+  // Zeros every wet-path state so skipped blocks resume from silence
+  void enterSilentTail();
+
+  //==========================================================================
+  // Helper: run one FDN over a chunk. The first numFrozenSamples use the
+  // frozen (outgoing) snapshot, the rest the live parameters.
+  void processFDNPass(ChaosverbFDN &fdn, const float *const *in,
+                      float *const *out, int numSamples, int numFrozenSamples,
+                      const FDNParamSnapshot &frozen,
+                      const FDNParamSnapshot &live);
 
   //==========================================================================
   // DSP Helper Functions
-  void applyDucking(int numSamples, float *dataL, float *dataR,
-                    float duckingNorm);
-  void applyStereoWidth(int numSamples, float *dataL, float *dataR,
-                        float widthGain);
+  // Post-FDN chain, fused: Haas delay and width, output EQ, wow/flutter and
+  // ducking run one frame (a sample of every channel) at a time, so the wet
+  // buffer is read and written once. Works in chunks of kWetChunkSize with
+  // each smoother written out as a ramp for the chunk first.
+  void processPostChain(int numSamples, float *const *data, int numChannels,
+                        float widthGain, float haasDelaySamples,
+                        float wfAmount, bool wfEnabled, float duckingNorm);
 
   //==========================================================================
   // Creates the full 22-parameter APVTS layout
@@ -58,6 +58,14 @@ juce::AudioProcessorValueTreeState::ParameterLayout DriveVerbAudioProcessor::cre
         1.0f
     ));
 
+    // OVERSAMPLING FILTER - Halfbands around the drive (0=Linear Phase FIR, 1=Low Latency IIR)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID { "osFilter", 1 },
+        "OS Filter",
+        juce::StringArray { "Linear Phase", "Low Latency" },
+        0
+    ));
+
     return layout;
 }
 
@@ -67,10 +75,14 @@ DriveVerbAudioProcessor::DriveVerbAudioProcessor()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
     , parameters(*this, nullptr, "Parameters", createParameterLayout())
 {
+    parameters.addParameterListener("osFilter", &oversamplingRebuilder);
+    oversamplingRebuilder.startTimer(50);
 }
 
 DriveVerbAudioProcessor::~DriveVerbAudioProcessor()
 {
+    oversamplingRebuilder.stopTimer();
+    parameters.removeParameterListener("osFilter", &oversamplingRebuilder);
 }
 
 void DriveVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -88,20 +100,61 @@ void DriveVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlo
     dryWetMixer.prepare(spec);
     dryWetMixer.setMixingRule(juce::dsp::DryWetMixingRule::balanced); // Equal-power mixing
 
-    // Prepare drive waveshaper with tanh transfer function (Stage 4.2)
-    driveShaper.prepare(spec);
-    driveShaper.functionToUse = [](float sample) { return std::tanh(sample); };
+    // Prepare drive oversampling (also sets the wet latency)
+    preparedBlockSize = samplesPerBlock;
+    prepareOversampling(selectOversamplingFilter());
 
     // Prepare DJ-style filter (Stage 4.3)
-    filterProcessor.prepare(spec);
+    for (auto& state : filterState)
+        state.reset();
+    filterRamp.setImmediate(pfs::BiquadCoefficients{});
+}
+
+pfs::HalfbandFilter DriveVerbAudioProcessor::selectOversamplingFilter() const
+{
+    return parameters.getRawParameterValue("osFilter")->load() > 0.5f ? pfs::HalfbandFilter::LowLatency
+                                                                     : pfs::HalfbandFilter::LinearPhase;
+}
+
+void DriveVerbAudioProcessor::prepareOversampling(pfs::HalfbandFilter filter)
+{
+    oversampler.prepare(getTotalNumOutputChannels(), 1, filter, preparedBlockSize);
+    oversamplerPrepared = true;
+
+    // Delay the dry signal to line up with the oversampled drive
+    const double wetLatency = oversampler.getLatencyInSamples();
+    jassert(wetLatency <= kMaxWetLatencySamples);
+
+    dryWetMixer.setWetLatency(static_cast<float>(wetLatency));
+    dryWetMixer.reset();
+
+    // Report latency to the DAW for PDC
+    setLatencySamples(juce::roundToInt(wetLatency));
+}
+
+void DriveVerbAudioProcessor::rebuildOversampling()
+{
+    // Offline renders switch inside processBlock(); before the first
+    // prepareToPlay() there is nothing to rebuild
+    if (isNonRealtime() || !oversamplerPrepared)
+        return;
+
+    // suspendProcessing() takes the callback lock, so processBlock() is not
+    // running while the oversampler reallocates
+    suspendProcessing(true);
+    const auto filter = selectOversamplingFilter();
+    if (filter != oversampler.getFilter())
+        prepareOversampling(filter);
+    suspendProcessing(false);
 }
 
 void DriveVerbAudioProcessor::releaseResources()
 {
     reverb.reset();
     dryWetMixer.reset();
-    driveShaper.reset();
-    filterProcessor.reset();
+    oversampler.reset();
+    for (auto& state : filterState)
+        state.reset();
 }
 
 void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
@@ -109,6 +162,11 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
     juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
 
+    // Oversampling filter change during a non-realtime render: no deadline,
+    // so re-prepare in place (live changes go through rebuildOversampling())
+    if (isNonRealtime() && selectOversamplingFilter() != oversampler.getFilter())
+        prepareOversampling(selectOversamplingFilter());
+
     // Get current parameter values (atomic reads, real-time safe)
     auto* sizeParam = parameters.getRawParameterValue("size");
     auto* decayParam = parameters.getRawParameterValue("decay");
@@ -176,22 +234,33 @@ void DriveVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juc
 
 void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float driveValue)
 {
+    juce::ignoreUnused(context);  // Drive runs on the block's channel pointers directly
+
     // Apply drive to wet signal (Stage 4.2)
     // Convert dB to linear gain: gain = 10^(dB/20)
     float driveGain = std::pow(10.0f, driveValue / 20.0f);
 
-    // Apply gain before waveshaping (increases saturation with higher drive)
-    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    // Apply gain before waveshaping (increases saturation with higher drive),
+    // then tanh waveshaping (tape-like saturation) as one block call per
+    // channel, at 2x so the tanh harmonics don't fold back
+    const int numSamples = static_cast<int>(block.getNumSamples());
+    const int numChannels = juce::jmin(static_cast<int>(block.getNumChannels()), oversampler.getNumChannels());
+
+    float* channels[pfs::Oversampler::kMaxChannels] = {};
+    for (int channel = 0; channel < numChannels; ++channel)
+        channels[channel] = block.getChannelPointer(static_cast<size_t>(channel));
+
+    float* const* oversampled = oversampler.processUp(channels, numSamples);
+    const int numOversampledSamples = numSamples * oversampler.getFactor();
+
+    for (int channel = 0; channel < numChannels; ++channel)
     {
-        auto* channelData = block.getChannelPointer(channel);
-        for (size_t sample = 0; sample < block.getNumSamples(); ++sample)
-        {
-            channelData[sample] *= driveGain;
-        }
+        auto* channelData = oversampled[channel];
+        juce::FloatVectorOperations::multiply(channelData, driveGain, numOversampledSamples);
+        pfs::math::tanh(channelData, channelData, numOversampledSamples);
     }
 
-    // Apply tanh waveshaping (tape-like saturation)
-    driveShaper.process(context);
+    oversampler.processDown(channels, numSamples);
 
     // Measure output level for VU meter (after waveshaping)
     float maxLevel = 0.0f;
@@ -213,6 +282,8 @@ void DriveVerbAudioProcessor::applyDrive(juce::dsp::AudioBlock<float>& block, ju
 
 void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, juce::dsp::ProcessContextReplacing<float>& context, float filterValue)
 {
+    juce::ignoreUnused(context);  // Filter runs on the block's channel pointers directly
+
     // Apply DJ-style filter (Stage 4.3)
     // Center bypass zone: ±0.5% = no filtering (prevents filter artifacts at bypass)
     if (std::abs(filterValue) > 0.5f)
@@ -222,12 +293,16 @@ void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, j
 
         // Reset filter state when switching between low-pass and high-pass
         // Prevents burst caused by residual energy in delay buffers
-        if (isLowPass != previousWasLowPass)
+        const bool typeChanged = (isLowPass != previousWasLowPass);
+        if (typeChanged)
         {
-            filterProcessor.reset();
+            for (auto& state : filterState)
+                state.reset();
         }
         previousWasLowPass = isLowPass;
 
+        pfs::BiquadCoefficients coefficients;
+
         if (isLowPass)
         {
             // Low-pass filter (negative values)
@@ -235,9 +310,7 @@ void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, j
             float normalizedValue = std::abs(filterValue) / 100.0f; // 0.0 to 1.0
             float cutoffHz = 20000.0f * std::pow(10.0f, -normalizedValue * std::log10(20000.0f / 200.0f));
 
-            *filterProcessor.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                sampleRate, juce::jlimit(200.0f, 20000.0f, cutoffHz), 0.707f
-            );
+            coefficients.makeLowPass(sampleRate, juce::jlimit(200.0f, 20000.0f, cutoffHz), 0.707f);
         }
         else
         {
@@ -246,13 +319,23 @@ void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, j
             float normalizedValue = filterValue / 100.0f; // 0.0 to 1.0
             float cutoffHz = 20.0f * std::pow(10.0f, normalizedValue * std::log10(10000.0f / 20.0f));
 
-            *filterProcessor.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                sampleRate, juce::jlimit(20.0f, 10000.0f, cutoffHz), 0.707f
-            );
+            coefficients.makeHighPass(sampleRate, juce::jlimit(20.0f, 10000.0f, cutoffHz), 0.707f);
         }
 
+        // Glide to the new coefficients across the block (snap after a type change)
+        const int numSamples = static_cast<int>(block.getNumSamples());
+        if (typeChanged)
+            filterRamp.setImmediate(coefficients);
+        else
+            filterRamp.setTarget(coefficients, numSamples);
+
         // Process buffer through filter
-        filterProcessor.process(context);
+        const int numChannels = juce::jmin(static_cast<int>(block.getNumChannels()), maxFilterChannels);
+        float* channels[maxFilterChannels] = {};
+        for (int channel = 0; channel < numChannels; ++channel)
+            channels[channel] = block.getChannelPointer(static_cast<size_t>(channel));
+
+        pfs::processRamped(filterRamp, filterState, channels, numChannels, numSamples);
     }
     else
     {
@@ -260,7 +343,8 @@ void DriveVerbAudioProcessor::applyFilter(juce::dsp::AudioBlock<float>& block, j
         // Prevents residual energy when re-entering filter range
         if (previousWasLowPass)
         {
-            filterProcessor.reset();
+            for (auto& state : filterState)
+                state.reset();
             previousWasLowPass = false;
         }
     }
@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
+#include <pfs/FastMath.h>
+#include <pfs/Oversampler.h>
 
 class DriveVerbAudioProcessor : public juce::AudioProcessor
 {
@@ -43,13 +46,21 @@ private:
 
     // DSP Components (Stage 4.1: Core reverb + dry/wet mixing)
     juce::dsp::Reverb reverb;
-    juce::dsp::DryWetMixer<float> dryWetMixer;
 
-    // Stage 4.2: Drive saturation
-    juce::dsp::WaveShaper<float> driveShaper;
+    // The dry path is delayed by the drive's oversampling latency
+    static constexpr int kMaxWetLatencySamples = 64;
+    juce::dsp::DryWetMixer<float> dryWetMixer { kMaxWetLatencySamples };
+
+    // 2x around the drive's tanh; halfbands from the "osFilter" choice.
+    // Re-preparing allocates, so a change is applied by OversamplingRebuilder.
+    pfs::Oversampler oversampler;
+    bool oversamplerPrepared = false;
+    int preparedBlockSize = 0;
 
     // Stage 4.3: DJ-style filter (low-pass/high-pass with center bypass)
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> filterProcessor;
+    static constexpr int maxFilterChannels = 2;
+    pfs::BiquadRamp filterRamp;  // Allocation-free coefficients, ramped per sample
+    pfs::BiquadState filterState[maxFilterChannels];
     bool previousWasLowPass = false;  // Track filter type transitions
 
     // Stage 4.4: Helper methods for PRE/POST routing
@@ -59,5 +70,38 @@ private:
     // VU meter - drive output level
     std::atomic<float> driveOutputLevelDB { -60.0f };
 
+    // A change of "osFilter" is flagged by the listener and a message-thread
+    // timer re-prepares the oversampler (see rebuildOversampling())
+    class OversamplingRebuilder : public juce::Timer,
+                                  public juce::AudioProcessorValueTreeState::Listener
+    {
+    public:
+        explicit OversamplingRebuilder(DriveVerbAudioProcessor& p) : processor(p) {}
+
+        // Can run on the audio thread (host automation): only flags the change
+        void parameterChanged(const juce::String&, float) override { pending.store(true); }
+
+        void timerCallback() override
+        {
+            if (pending.exchange(false))
+                processor.rebuildOversampling();
+        }
+
+    private:
+        DriveVerbAudioProcessor& processor;
+        std::atomic<bool> pending { false };
+    };
+
+    OversamplingRebuilder oversamplingRebuilder { *this };
+
+    pfs::HalfbandFilter selectOversamplingFilter() const;
+
+    // Prepares the oversampler with the given halfbands and reports its
+    // latency to the dry/wet mixer and the host. Not realtime safe.
+    void prepareOversampling(pfs::HalfbandFilter filter);
+
+    // Message thread: suspends processing and applies the selected filter
+    void rebuildOversampling();
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DriveVerbAudioProcessor)
 };
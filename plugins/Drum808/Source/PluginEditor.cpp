@@ -131,6 +131,9 @@ Drum808AudioProcessorEditor::Drum808AudioProcessorEditor(Drum808AudioProcessor&
     // Set window size (from mockup)
     setSize(1000, 550);
 
+    // Triggers queued while the editor was closed would flash every LED at once
+    processorRef.triggerTelemetry.clear();
+
     // Start timer for LED updates (60fps)
     startTimer(16);
 }
@@ -153,44 +156,28 @@ void Drum808AudioProcessorEditor::resized()
 
 void Drum808AudioProcessorEditor::timerCallback()
 {
-    // Read atomic flags set by audio thread (Pattern 5: Threading)
-    // Check each voice and trigger corresponding LED in JavaScript
-
-    if (processorRef.kickTriggered.load(std::memory_order_relaxed))
-    {
-        processorRef.kickTriggered.store(false, std::memory_order_relaxed);
-        webView->emitEventIfBrowserIsVisible("ledTrigger", "kick");
-    }
-
-    if (processorRef.lowTomTriggered.load(std::memory_order_relaxed))
-    {
-        processorRef.lowTomTriggered.store(false, std::memory_order_relaxed);
-        webView->emitEventIfBrowserIsVisible("ledTrigger", "lowtom");
-    }
-
-    if (processorRef.midTomTriggered.load(std::memory_order_relaxed))
-    {
-        processorRef.midTomTriggered.store(false, std::memory_order_relaxed);
-        webView->emitEventIfBrowserIsVisible("ledTrigger", "midtom");
-    }
-
-    if (processorRef.clapTriggered.load(std::memory_order_relaxed))
-    {
-        processorRef.clapTriggered.store(false, std::memory_order_relaxed);
-        webView->emitEventIfBrowserIsVisible("ledTrigger", "clap");
-    }
-
-    if (processorRef.closedHatTriggered.load(std::memory_order_relaxed))
-    {
-        processorRef.closedHatTriggered.store(false, std::memory_order_relaxed);
-        webView->emitEventIfBrowserIsVisible("ledTrigger", "closedhat");
-    }
+    // Collect every voice triggered since the last tick (Pattern 5: Threading)
+    // and flash the corresponding LEDs in JavaScript
+    std::uint32_t voices = 0;
+    processorRef.triggerTelemetry.drain([&voices](const Drum808AudioProcessor::TriggerFrame& frame) {
+        voices |= frame.voices;
+    });
+
+    if (voices == 0)
+        return;
+
+    static constexpr std::pair<std::uint32_t, const char*> leds[] = {
+        { Drum808AudioProcessor::kTriggerKick,      "kick" },
+        { Drum808AudioProcessor::kTriggerLowTom,    "lowtom" },
+        { Drum808AudioProcessor::kTriggerMidTom,    "midtom" },
+        { Drum808AudioProcessor::kTriggerClap,      "clap" },
+        { Drum808AudioProcessor::kTriggerClosedHat, "closedhat" },
+        { Drum808AudioProcessor::kTriggerOpenHat,   "openhat" }
+    };
 
-    if (processorRef.openHatTriggered.load(std::memory_order_relaxed))
-    {
-        processorRef.openHatTriggered.store(false, std::memory_order_relaxed);
-        webView->emitEventIfBrowserIsVisible("ledTrigger", "openhat");
-    }
+    for (const auto& [bit, name] : leds)
+        if ((voices & bit) != 0)
+            webView->emitEventIfBrowserIsVisible("ledTrigger", name);
 }
 
 std::optional<juce::WebBrowserComponent::Resource>
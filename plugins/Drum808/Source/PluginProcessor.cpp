@@ -395,6 +395,8 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     const float openHatCenterFreq = 6000.0f + (openHatTone * 6000.0f);
 
     // Process MIDI messages
+    std::uint32_t triggeredVoices = 0;
+
     for (const auto metadata : midiMessages)
     {
         auto message = metadata.getMessage();
@@ -408,17 +410,17 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             if (note == 36) // C1 → Kick
             {
                 kick.trigger(velocity);
-                kickTriggered.store(true, std::memory_order_relaxed);
+                triggeredVoices |= kTriggerKick;
             }
             else if (note == 38) // D1 → Clap
             {
                 clap.trigger(velocity);
-                clapTriggered.store(true, std::memory_order_relaxed);
+                triggeredVoices |= kTriggerClap;
             }
             else if (note == 41) // F1 → Low Tom
             {
                 lowTom.trigger(velocity, lowTomBaseFreq);
-                lowTomTriggered.store(true, std::memory_order_relaxed);
+                triggeredVoices |= kTriggerLowTom;
             }
             else if (note == 42) // F#1 → Closed Hat (CHOKES open hat)
             {
@@ -427,28 +429,79 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
                 // THEN: Trigger closed hat
                 closedHat.trigger(velocity);
-                closedHatTriggered.store(true, std::memory_order_relaxed);
+                triggeredVoices |= kTriggerClosedHat;
             }
             else if (note == 45) // A1 → Mid Tom
             {
                 midTom.trigger(velocity, midTomBaseFreq);
-                midTomTriggered.store(true, std::memory_order_relaxed);
+                triggeredVoices |= kTriggerMidTom;
             }
             else if (note == 46) // A#1 → Open Hat
             {
                 openHat.trigger(velocity);
-                openHatTriggered.store(true, std::memory_order_relaxed);
+                triggeredVoices |= kTriggerOpenHat;
             }
         }
     }
 
+    if (triggeredVoices != 0)
+        triggerTelemetry.publish({ triggeredVoices });
+
     // Configure clap filter (outside loop for efficiency)
     clap.bandpassFilter.setCutoffFrequency(clapCenterFreq);
     clap.bandpassFilter.setResonance(clapQ);
 
+    // Exponential envelopes of every voice, evaluated together once per sample
+    enum EnvelopeSlot
+    {
+        kickPitchEnvelope, kickAttackEnvelope, kickAmplitudeEnvelope,
+        lowTomEnvelope, midTomEnvelope, clapEnvelope, closedHatEnvelope, openHatEnvelope,
+        numEnvelopeSlots
+    };
+
     // Synthesize voices (per-sample processing)
     for (int sample = 0; sample < numSamples; ++sample)
     {
+        // Gather the exponents of all playing voices into one block exp call
+        // (8 lanes); idle voices evaluate exp(0) and are ignored
+        float envelopes[numEnvelopeSlots] = {};
+
+        if (kick.isPlaying)
+        {
+            envelopes[kickPitchEnvelope] = -kick.envelopeTime / 0.02f;
+            envelopes[kickAttackEnvelope] = -kick.envelopeTime / 0.005f;
+            envelopes[kickAmplitudeEnvelope] = -kick.envelopeTime / kickDecay;
+        }
+        if (lowTom.isPlaying)
+            envelopes[lowTomEnvelope] = -lowTom.envelopeTime / lowTomDecay;
+        if (midTom.isPlaying)
+            envelopes[midTomEnvelope] = -midTom.envelopeTime / midTomDecay;
+        if (clap.isPlaying)
+        {
+            // Time since the start of the current clap segment (spikes: 3 ms, decay: 1.934 s)
+            int segmentStartSample = 0;
+            float timeConstant = 0.003f;
+
+            if (clap.envelopeState == ClapEnvelopeState::Spike2)
+                segmentStartSample = clap.spike2StartSample;
+            else if (clap.envelopeState == ClapEnvelopeState::Spike3)
+                segmentStartSample = clap.spike3StartSample;
+            else if (clap.envelopeState == ClapEnvelopeState::Decay)
+            {
+                segmentStartSample = clap.decayStartSample;
+                timeConstant = 1.934f;
+            }
+
+            float timeInSegment = (clap.envelopeSample - segmentStartSample) / static_cast<float>(currentSampleRate);
+            envelopes[clapEnvelope] = -timeInSegment / timeConstant;
+        }
+        if (closedHat.isPlaying)
+            envelopes[closedHatEnvelope] = -closedHat.envelopeTime / closedHatDecay;
+        if (openHat.isPlaying)
+            envelopes[openHatEnvelope] = -openHat.envelopeTime / openHatDecay;
+
+        pfs::math::exp(envelopes, envelopes, numEnvelopeSlots);
+
         float kickSample = 0.0f;
         float lowTomSample = 0.0f;
         float midTomSample = 0.0f;
@@ -460,7 +513,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         if (kick.isPlaying)
         {
             // Pitch envelope: exponential sweep from 2× to 1× base frequency
-            float currentFreq = kickBaseFreq * (1.0f + std::exp(-kick.envelopeTime / 0.02f));
+            float currentFreq = kickBaseFreq * (1.0f + envelopes[kickPitchEnvelope]);
             kick.bodyOscillator.setFrequency(currentFreq);
 
             // Body tone (sine oscillator)
@@ -468,10 +521,10 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
             // Attack transient (noise burst scaled by tone parameter)
             float attackSignal = (kick.noiseGenerator.nextFloat() * 2.0f - 1.0f) *
-                                 std::exp(-kick.envelopeTime / 0.005f) * kickTone;
+                                 envelopes[kickAttackEnvelope] * kickTone;
 
             // Amplitude envelope (exponential decay)
-            float amplitudeEnv = std::exp(-kick.envelopeTime / kickDecay);
+            float amplitudeEnv = envelopes[kickAmplitudeEnvelope];
 
             // Denormal protection
             if (amplitudeEnv < 1e-8f)
@@ -495,7 +548,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
             float oscSample = lowTom.oscillator.processSample(0.0f);
             float filteredSample = lowTom.filter.processSample(0, oscSample);
-            float envelope = std::exp(-lowTom.envelopeTime / lowTomDecay);
+            float envelope = envelopes[lowTomEnvelope];
 
             if (envelope < 1e-8f)
             {
@@ -515,7 +568,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
             float oscSample = midTom.oscillator.processSample(0.0f);
             float filteredSample = midTom.filter.processSample(0, oscSample);
-            float envelope = std::exp(-midTom.envelopeTime / midTomDecay);
+            float envelope = envelopes[midTomEnvelope];
 
             if (envelope < 1e-8f)
             {
@@ -542,8 +595,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
             if (clap.envelopeState == ClapEnvelopeState::Spike1)
             {
-                float timeInSpike = t / static_cast<float>(currentSampleRate);
-                envelope = clapSnap * std::exp(-timeInSpike / 0.003f);
+                envelope = clapSnap * envelopes[clapEnvelope];
 
                 if (t >= clap.spike2StartSample)
                 {
@@ -552,8 +604,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             }
             else if (clap.envelopeState == ClapEnvelopeState::Spike2)
             {
-                float timeInSpike = (t - clap.spike2StartSample) / static_cast<float>(currentSampleRate);
-                envelope = clapSnap * 0.6f * std::exp(-timeInSpike / 0.003f);
+                envelope = clapSnap * 0.6f * envelopes[clapEnvelope];
 
                 if (t >= clap.spike3StartSample)
                 {
@@ -562,8 +613,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             }
             else if (clap.envelopeState == ClapEnvelopeState::Spike3)
             {
-                float timeInSpike = (t - clap.spike3StartSample) / static_cast<float>(currentSampleRate);
-                envelope = clapSnap * 0.3f * std::exp(-timeInSpike / 0.003f);
+                envelope = clapSnap * 0.3f * envelopes[clapEnvelope];
 
                 if (t >= clap.decayStartSample)
                 {
@@ -572,8 +622,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             }
             else if (clap.envelopeState == ClapEnvelopeState::Decay)
             {
-                float timeInDecay = (t - clap.decayStartSample) / static_cast<float>(currentSampleRate);
-                envelope = std::exp(-timeInDecay / 1.934f);
+                envelope = envelopes[clapEnvelope];
 
                 // Stop voice after decay tail (envelope < threshold)
                 if (envelope < 1e-4f)
@@ -608,7 +657,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             float filteredSignal = closedHat.filter.processSample(0, mixedSignal);
 
             // Exponential decay
-            float envelope = std::exp(-closedHat.envelopeTime / closedHatDecay);
+            float envelope = envelopes[closedHatEnvelope];
 
             if (envelope < 1e-8f)
             {
@@ -635,7 +684,7 @@ void Drum808AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             openHat.filter.setCutoffFrequency(openHatCenterFreq);
             float filteredSignal = openHat.filter.processSample(0, mixedSignal);
 
-            float envelope = std::exp(-openHat.envelopeTime / openHatDecay);
+            float envelope = envelopes[openHatEnvelope];
 
             if (envelope < 1e-8f)
             {
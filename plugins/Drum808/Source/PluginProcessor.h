@@ -1,6 +1,9 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/FastMath.h>
+#include <pfs/RandomSeed.h>
+#include <pfs/Telemetry.h>
 
 class Drum808AudioProcessor : public juce::AudioProcessor
 {
@@ -32,13 +35,24 @@ public:
 
     juce::AudioProcessorValueTreeState parameters;
 
-    // LED trigger flags (audio thread → UI thread communication)
-    std::atomic<bool> kickTriggered{false};
-    std::atomic<bool> lowTomTriggered{false};
-    std::atomic<bool> midTomTriggered{false};
-    std::atomic<bool> clapTriggered{false};
-    std::atomic<bool> closedHatTriggered{false};
-    std::atomic<bool> openHatTriggered{false};
+    // LED triggers (audio thread → UI thread): one frame per block that
+    // triggered at least one voice, OR-ed together by the editor timer
+    enum TriggerBits : std::uint32_t
+    {
+        kTriggerKick      = 1u << 0,
+        kTriggerLowTom    = 1u << 1,
+        kTriggerMidTom    = 1u << 2,
+        kTriggerClap      = 1u << 3,
+        kTriggerClosedHat = 1u << 4,
+        kTriggerOpenHat   = 1u << 5
+    };
+
+    struct TriggerFrame
+    {
+        std::uint32_t voices = 0;
+    };
+
+    pfs::TelemetryChannel<TriggerFrame> triggerTelemetry;
 
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
@@ -73,7 +87,7 @@ private:
     struct KickVoice
     {
         juce::dsp::Oscillator<float> bodyOscillator;
-        juce::Random noiseGenerator;
+        juce::Random noiseGenerator { pfs::nextRandomSeed() };
 
         bool isPlaying = false;
         float envelopeTime = 0.0f;
@@ -65,8 +65,6 @@ void DrumRouletteVoice::setCurrentPlaybackSampleRate(double newRate)
     spec.maximumBlockSize = 512;  // Reasonable default for per-voice processing
     spec.numChannels = 1;  // Per-voice is mono
 
-    lowShelfFilter.prepare(spec);
-    highShelfFilter.prepare(spec);
     volumeGain.prepare(spec);
 
     // Reset filter states
@@ -122,14 +120,10 @@ void DrumRouletteVoice::startNote(int midiNoteNumber, float velocity, juce::Synt
         float tiltGain = juce::Decibels::decibelsToGain(tiltDb);
 
         // Low-shelf (below 1kHz): Same polarity as tilt value
-        auto lowShelfCoeffs = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-            voiceSampleRate, 1000.0f, 0.707f, tiltGain);
-        *lowShelfFilter.coefficients = *lowShelfCoeffs;
+        lowShelfFilter.coefficients.makeLowShelf(voiceSampleRate, 1000.0f, 0.707f, tiltGain);
 
         // High-shelf (above 1kHz): Opposite polarity (inverse gain)
-        auto highShelfCoeffs = juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-            voiceSampleRate, 1000.0f, 0.707f, 1.0f / tiltGain);
-        *highShelfFilter.coefficients = *highShelfCoeffs;
+        highShelfFilter.coefficients.makeHighShelf(voiceSampleRate, 1000.0f, 0.707f, 1.0f / tiltGain);
     }
 }
 
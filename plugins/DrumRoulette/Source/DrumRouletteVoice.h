@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
 
 class DrumRouletteVoice : public juce::SynthesiserVoice
 {
@@ -36,9 +37,9 @@ private:
     // ADSR envelope (Phase 4.2)
     juce::ADSR envelope;
 
-    // Tilt filter (Phase 4.3)
-    juce::dsp::IIR::Filter<float> lowShelfFilter;
-    juce::dsp::IIR::Filter<float> highShelfFilter;
+    // Tilt filter (Phase 4.3) — coefficients computed in place on note start
+    pfs::Biquad lowShelfFilter;
+    pfs::Biquad highShelfFilter;
 
     // Volume control (Phase 4.3)
     juce::dsp::Gain<float> volumeGain;
@@ -114,8 +114,9 @@ void FlutterVerbAudioProcessor::prepareToPlay(double sampleRate, int samplesPerB
     flutterPhase.resize(spec.numChannels, 0.0f);
 
     // Phase 4.3: Prepare filter
-    toneFilter.prepare(spec);
-    toneFilter.reset();
+    for (auto& state : toneFilter)
+        state.reset();
+    toneRamp.setImmediate(pfs::BiquadCoefficients{});
     currentFilterType = FilterType::None;
 }
 
@@ -206,45 +207,59 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
             {
                 auto* channelData = buffer.getWritePointer(channel);
 
-                for (int sample = 0; sample < numSamples; ++sample)
+                // LFO phases are laid out per chunk so both sines run as block calls
+                for (int chunkStart = 0; chunkStart < numSamples; chunkStart += lfoChunkSize)
                 {
-                    // Calculate wow LFO output (sine wave)
-                    float wowOutput = std::sin(wowPhase[channel]);
-
-                    // Calculate flutter LFO output (sine wave)
-                    float flutterOutput = std::sin(flutterPhase[channel]);
-
-                    // Combine modulation signals (both contribute to pitch variation)
-                    float totalModulation = (wowOutput + flutterOutput) * 0.5f;  // Average to keep in ±1.0 range
-
-                    // Fix 3: Scale by AGE parameter with exponential curve for more usable range
-                    // Exponential scaling gives more control in 0-50% range, still reaches extremes at 100%
-                    float scaledAge = ageValue * ageValue;  // Exponential response
-                    totalModulation *= scaledAge;
-
-                    // Calculate modulated delay time in samples
-                    float baseDelaySamples = (baseDelayMs / 1000.0f) * static_cast<float>(currentSampleRate);
-                    float modulationAmount = baseDelaySamples * maxModDepth * totalModulation;  // ±20% depth
-                    float delayTimeSamples = baseDelaySamples + modulationAmount;
-
-                    // Ensure delay time is within valid range
-                    delayTimeSamples = juce::jlimit(1.0f, static_cast<float>(currentSampleRate * 0.2), delayTimeSamples);
-
-                    // Set delay time for this channel
-                    modulationDelay.setDelay(static_cast<float>(delayTimeSamples));
-
-                    // Process sample through delay line
-                    modulationDelay.pushSample(channel, channelData[sample]);
-                    channelData[sample] = modulationDelay.popSample(channel);
-
-                    // Update LFO phases with wrapping
-                    wowPhase[channel] += wowPhaseInc;
-                    if (wowPhase[channel] >= 2.0f * juce::MathConstants<float>::pi)
-                        wowPhase[channel] -= 2.0f * juce::MathConstants<float>::pi;
-
-                    flutterPhase[channel] += flutterPhaseInc;
-                    if (flutterPhase[channel] >= 2.0f * juce::MathConstants<float>::pi)
-                        flutterPhase[channel] -= 2.0f * juce::MathConstants<float>::pi;
+                    const int chunkSize = juce::jmin(lfoChunkSize, numSamples - chunkStart);
+                    float wowOutput[lfoChunkSize];
+                    float flutterOutput[lfoChunkSize];
+
+                    for (int i = 0; i < chunkSize; ++i)
+                    {
+                        wowOutput[i] = wowPhase[channel];
+                        flutterOutput[i] = flutterPhase[channel];
+
+                        // Update LFO phases with wrapping
+                        wowPhase[channel] += wowPhaseInc;
+                        if (wowPhase[channel] >= 2.0f * juce::MathConstants<float>::pi)
+                            wowPhase[channel] -= 2.0f * juce::MathConstants<float>::pi;
+
+                        flutterPhase[channel] += flutterPhaseInc;
+                        if (flutterPhase[channel] >= 2.0f * juce::MathConstants<float>::pi)
+                            flutterPhase[channel] -= 2.0f * juce::MathConstants<float>::pi;
+                    }
+
+                    // Calculate wow and flutter LFO outputs (sine waves)
+                    pfs::math::sin(wowOutput, wowOutput, chunkSize);
+                    pfs::math::sin(flutterOutput, flutterOutput, chunkSize);
+
+                    for (int i = 0; i < chunkSize; ++i)
+                    {
+                        const int sample = chunkStart + i;
+
+                        // Combine modulation signals (both contribute to pitch variation)
+                        float totalModulation = (wowOutput[i] + flutterOutput[i]) * 0.5f;  // Average to keep in ±1.0 range
+
+                        // Fix 3: Scale by AGE parameter with exponential curve for more usable range
+                        // Exponential scaling gives more control in 0-50% range, still reaches extremes at 100%
+                        float scaledAge = ageValue * ageValue;  // Exponential response
+                        totalModulation *= scaledAge;
+
+                        // Calculate modulated delay time in samples
+                        float baseDelaySamples = (baseDelayMs / 1000.0f) * static_cast<float>(currentSampleRate);
+                        float modulationAmount = baseDelaySamples * maxModDepth * totalModulation;  // ±20% depth
+                        float delayTimeSamples = baseDelaySamples + modulationAmount;
+
+                        // Ensure delay time is within valid range
+                        delayTimeSamples = juce::jlimit(1.0f, static_cast<float>(currentSampleRate * 0.2), delayTimeSamples);
+
+                        // Set delay time for this channel
+                        modulationDelay.setDelay(static_cast<float>(delayTimeSamples));
+
+                        // Process sample through delay line
+                        modulationDelay.pushSample(channel, channelData[sample]);
+                        channelData[sample] = modulationDelay.popSample(channel);
+                    }
                 }
             }
         }
@@ -264,11 +279,9 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
             {
                 auto* channelData = buffer.getWritePointer(channel);
 
-                for (int sample = 0; sample < numSamples; ++sample)
-                {
-                    // Apply tanh saturation
-                    channelData[sample] = std::tanh(gain * channelData[sample]);
-                }
+                // Apply tanh saturation (block call, vectorised in fast-math builds)
+                juce::FloatVectorOperations::multiply(channelData, gain, numSamples);
+                pfs::math::tanh(channelData, channelData, numSamples);
             }
         }
     };
@@ -282,12 +295,16 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
 
             // Determine filter type and reset state if type changed
             FilterType newFilterType = isLowPass ? FilterType::LowPass : FilterType::HighPass;
-            if (newFilterType != currentFilterType)
+            const bool typeChanged = (newFilterType != currentFilterType);
+            if (typeChanged)
             {
-                toneFilter.reset();  // Prevent burst artifacts on type transition
+                for (auto& state : toneFilter)
+                    state.reset();  // Prevent burst artifacts on type transition
                 currentFilterType = newFilterType;
             }
 
+            pfs::BiquadCoefficients coefficients;
+
             if (isLowPass)
             {
                 // Low-pass filter (negative values: -100% to 0%)
@@ -296,9 +313,7 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                 float cutoffHz = 20000.0f * std::pow(10.0f, -normalizedValue * std::log10(100.0f));
                 cutoffHz = juce::jlimit(200.0f, 20000.0f, cutoffHz);
 
-                *toneFilter.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                    sampleRate, cutoffHz, 0.707f  // Q = 0.707 (Butterworth)
-                );
+                coefficients.makeLowPass(sampleRate, cutoffHz, 0.707f);  // Q = 0.707 (Butterworth)
             }
             else
             {
@@ -308,22 +323,26 @@ void FlutterVerbAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
                 float cutoffHz = 20.0f * std::pow(10.0f, normalizedValue * std::log10(500.0f));
                 cutoffHz = juce::jlimit(20.0f, 10000.0f, cutoffHz);
 
-                *toneFilter.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                    sampleRate, cutoffHz, 0.707f  // Q = 0.707 (Butterworth)
-                );
+                coefficients.makeHighPass(sampleRate, cutoffHz, 0.707f);  // Q = 0.707 (Butterworth)
             }
 
+            // Glide to the new coefficients across the block (snap after a type change)
+            if (typeChanged)
+                toneRamp.setImmediate(coefficients);
+            else
+                toneRamp.setTarget(coefficients, buffer.getNumSamples());
+
             // Process buffer through filter
-            juce::dsp::AudioBlock<float> filterBlock(buffer);
-            juce::dsp::ProcessContextReplacing<float> filterContext(filterBlock);
-            toneFilter.process(filterContext);
+            pfs::processRamped(toneRamp, toneFilter, buffer.getArrayOfWritePointers(),
+                               juce::jmin(buffer.getNumChannels(), maxToneChannels), buffer.getNumSamples());
         }
         else
         {
             // Reset filter state when entering bypass zone
             if (currentFilterType != FilterType::None)
             {
-                toneFilter.reset();
+                for (auto& state : toneFilter)
+                    state.reset();
                 currentFilterType = FilterType::None;
             }
         }
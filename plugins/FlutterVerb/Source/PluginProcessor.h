@@ -1,6 +1,8 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
+#include <pfs/FastMath.h>
 
 class FlutterVerbAudioProcessor : public juce::AudioProcessor
 {
@@ -45,10 +47,13 @@ private:
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> modulationDelay { 9600 }; // 200ms at 48kHz
     std::vector<float> wowPhase;    // Per-channel wow LFO phase (0-2π)
     std::vector<float> flutterPhase; // Per-channel flutter LFO phase (0-2π)
+    static constexpr int lfoChunkSize = 64;  // LFO values evaluated per block sin call
     double currentSampleRate = 44100.0; // Store sample rate for LFO calculations
 
     // Phase 4.3: Saturation and Filter
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> toneFilter;
+    static constexpr int maxToneChannels = 2;
+    pfs::BiquadRamp toneRamp;  // Allocation-free coefficients, ramped per sample
+    pfs::BiquadState toneFilter[maxToneChannels];
     enum class FilterType { None, LowPass, HighPass };
     FilterType currentFilterType = FilterType::None;
 
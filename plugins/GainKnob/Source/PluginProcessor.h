@@ -1,6 +1,8 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
+#include <pfs/Parameters.h>
 
 class GainKnobAudioProcessor : public juce::AudioProcessor
 {
@@ -30,14 +32,27 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // Parameter table: builds the layout and the cached atomic pointers below
+    enum Param { kGain, kPan, kFilter, kNumParams };
+
+    static constexpr std::array<pfs::ParamSpec, kNumParams> kParamSpecs {{
+        // GAIN -60..0 dB; PAN -100 (L)..100 (R); both glide over 20 ms
+        pfs::floatParam("GAIN", "Gain", -60.0f, 0.0f, 0.1f, 1.0f, 0.0f, "dB", 0.02f),
+        pfs::floatParam("PAN", "Pan", -100.0f, 100.0f, 0.1f, 1.0f, 0.0f, "%", 0.02f),
+        // FILTER: 0 = bypass, negative = low-pass, positive = high-pass (coefficients ramp themselves)
+        pfs::floatParam("FILTER", "Filter", -100.0f, 100.0f, 0.1f, 1.0f, 0.0f, "%"),
+    }};
+
     // Public access to parameters for editor
     juce::AudioProcessorValueTreeState parameters;
 
 private:
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    pfs::ParameterSet<Param, kNumParams> params { parameters, kParamSpecs };
 
-    // Filter state (per-channel)
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> filterProcessor;
+    // Filter state (per-channel) — allocation-free coefficients, ramped per sample
+    static constexpr int maxFilterChannels = 2;
+    pfs::BiquadRamp filterRamp;
+    pfs::BiquadState filterState[maxFilterChannels];
 
     // Track previous filter type to detect transitions
     bool previousWasLowPass = false;
@@ -1,42 +1,12 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
-juce::AudioProcessorValueTreeState::ParameterLayout LushPadAudioProcessor::createParameterLayout()
-{
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    // timbre - Float (0.0 to 1.0, default: 0.35, linear)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "timbre", 1 },
-        "Timbre",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f, 1.0f),
-        0.35f
-    ));
-
-    // filter_cutoff - Float (20.0 to 20000.0 Hz, default: 2000.0, skew: 0.3 logarithmic)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "filter_cutoff", 1 },
-        "Filter Cutoff",
-        juce::NormalisableRange<float>(20.0f, 20000.0f, 0.1f, 0.3f),
-        2000.0f,
-        "Hz"
-    ));
-
-    // reverb_amount - Float (0.0 to 1.0, default: 0.4, linear)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "reverb_amount", 1 },
-        "Reverb Amount",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f, 1.0f),
-        0.4f
-    ));
-
-    return layout;
-}
+static_assert(pfs::hasUniqueIds(LushPadAudioProcessor::kParamSpecs), "duplicate parameter ID");
 
 LushPadAudioProcessor::LushPadAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , parameters(*this, nullptr, "Parameters", createParameterLayout())
+    , parameters(*this, nullptr, "Parameters", pfs::createParameterLayout(kParamSpecs))
 {
 }
 
@@ -47,6 +17,7 @@ LushPadAudioProcessor::~LushPadAudioProcessor()
 void LushPadAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     currentSampleRate = sampleRate;
+    params.prepare(sampleRate);
 
     // Prepare DSP spec for stereo reverb
     juce::dsp::ProcessSpec reverbSpec;
@@ -67,17 +38,10 @@ void LushPadAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     reverbParams.freezeMode = 0.0f;   // No freeze
     reverb.setParameters(reverbParams);
 
-    // Prepare DSP spec for mono per-voice filtering
-    juce::dsp::ProcessSpec voiceSpec;
-    voiceSpec.sampleRate = sampleRate;
-    voiceSpec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    voiceSpec.numChannels = 1;  // Mono per-voice
-
-    // Initialize all voices with filter preparation
+    // Initialize all voices (filter state is cleared by reset)
     for (auto& voice : voices)
     {
         voice.adsr.setSampleRate(sampleRate);
-        voice.filter.prepare(voiceSpec);
         voice.reset();
     }
 }
@@ -87,12 +51,13 @@ void LushPadAudioProcessor::releaseResources()
     // Cleanup will be added in Stage 3 (DSP)
 }
 
-void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
+void LushPadAudioProcessor::advanceModulatorLFOs(SynthVoice& voice, float* phases)
 {
-    // Update tertiary LFOs first (indices 6-8) - slowest layer, modulate primary depths
-    for (int i = 0; i < 3; ++i)
+    // Secondary LFOs (indices 3-5) modulate primary speeds, tertiary LFOs
+    // (indices 6-8) - slowest layer - modulate primary depths
+    for (int i = 0; i < numModulatorLFOs; ++i)
     {
-        int lfoIndex = 6 + i;
+        int lfoIndex = numPrimaryLFOs + i;
         float phaseIncrement = (voice.lfoBaseFreq[lfoIndex] * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
         voice.lfoPhase[lfoIndex] += phaseIncrement;
 
@@ -100,35 +65,28 @@ void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
         if (voice.lfoPhase[lfoIndex] >= juce::MathConstants<float>::twoPi)
             voice.lfoPhase[lfoIndex] -= juce::MathConstants<float>::twoPi;
 
-        // Generate smooth random value using sine wave
-        float targetValue = std::sin(voice.lfoPhase[lfoIndex]);
-
-        // One-pole low-pass filter for smoothing
-        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
+        phases[i] = voice.lfoPhase[lfoIndex];
     }
+}
 
-    // Update secondary LFOs (indices 3-5) - middle layer, modulate primary speeds
-    for (int i = 0; i < 3; ++i)
+void LushPadAudioProcessor::applyModulatorLFOs(SynthVoice& voice, const float* sines)
+{
+    for (int i = 0; i < numModulatorLFOs; ++i)
     {
-        int lfoIndex = 3 + i;
-        float phaseIncrement = (voice.lfoBaseFreq[lfoIndex] * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
-        voice.lfoPhase[lfoIndex] += phaseIncrement;
-
-        // Wrap phase
-        if (voice.lfoPhase[lfoIndex] >= juce::MathConstants<float>::twoPi)
-            voice.lfoPhase[lfoIndex] -= juce::MathConstants<float>::twoPi;
+        int lfoIndex = numPrimaryLFOs + i;
 
-        // Generate smooth random value
-        float targetValue = std::sin(voice.lfoPhase[lfoIndex]);
-        voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
+        // Smooth random value from the sine, one-pole low-pass filter for smoothing
+        voice.lfoSmoothed[lfoIndex] += (sines[i] - voice.lfoSmoothed[lfoIndex]) * 0.01f;
     }
+}
 
-    // Update primary LFOs (indices 0-2) - fastest layer, modulated by secondary and tertiary
-    for (int i = 0; i < 3; ++i)
+void LushPadAudioProcessor::advancePrimaryLFOs(SynthVoice& voice, float* phases)
+{
+    // Primary LFOs (indices 0-2) - fastest layer, modulated by secondary and tertiary
+    for (int i = 0; i < numPrimaryLFOs; ++i)
     {
         int lfoIndex = i;
         int secondaryIndex = 3 + i;  // Secondary LFO that modulates this primary's speed
-        int tertiaryIndex = 6 + i;   // Tertiary LFO that modulates this primary's depth
 
         // Speed modulation from secondary LFO (±30%)
         float speedMod = 1.0f + (voice.lfoSmoothed[secondaryIndex] * 0.3f);
@@ -141,11 +99,22 @@ void LushPadAudioProcessor::updateVoiceLFOs(SynthVoice& voice)
         if (voice.lfoPhase[lfoIndex] >= juce::MathConstants<float>::twoPi)
             voice.lfoPhase[lfoIndex] -= juce::MathConstants<float>::twoPi;
 
+        phases[i] = voice.lfoPhase[lfoIndex];
+    }
+}
+
+void LushPadAudioProcessor::applyPrimaryLFOs(SynthVoice& voice, const float* sines)
+{
+    for (int i = 0; i < numPrimaryLFOs; ++i)
+    {
+        int lfoIndex = i;
+        int tertiaryIndex = 6 + i;   // Tertiary LFO that modulates this primary's depth
+
         // Depth modulation from tertiary LFO (±40%)
         float depthMod = 1.0f + (voice.lfoSmoothed[tertiaryIndex] * 0.4f);
 
         // Generate smooth random value with modulated depth
-        float targetValue = std::sin(voice.lfoPhase[lfoIndex]) * depthMod;
+        float targetValue = sines[i] * depthMod;
         voice.lfoSmoothed[lfoIndex] += (targetValue - voice.lfoSmoothed[lfoIndex]) * 0.01f;
     }
 }
@@ -177,27 +146,86 @@ void LushPadAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         }
     }
 
-    // Read parameters (atomic, done once per buffer for efficiency)
-    float timbreValue = parameters.getRawParameterValue("timbre")->load();
-    float filterCutoffValue = parameters.getRawParameterValue("filter_cutoff")->load();
-    float reverbAmountValue = parameters.getRawParameterValue("reverb_amount")->load();
-
     // Generate audio per-sample
     const int numSamples = buffer.getNumSamples();
 
+    // Read parameters (cached atomics, done once per buffer for efficiency)
+    // Timbre drives FM depth and saturation per sample, so it glides across the block
+    const auto timbreRamp = params.getRamp(kTimbre, numSamples);
+    float filterCutoffValue = params.get(kFilterCutoff);
+    float reverbAmountValue = params.get(kReverbAmount);
+
+    // Per-voice filter coefficients: cutoff only changes per block (parameter) and
+    // per voice (velocity), so compute once here and ramp across the block
+    for (auto& voice : voices)
+    {
+        if (!voice.active)
+            continue;
+
+        // Calculate velocity-scaled filter cutoff
+        // Soft notes (low velocity): darker sound (cutoff reduced by 50%)
+        // Hard notes (high velocity): brighter sound (cutoff at parameter value)
+        float velocityScaledCutoff = filterCutoffValue * (0.5f + 0.5f * voice.currentVelocity);
+
+        // Clamp to valid range
+        velocityScaledCutoff = juce::jlimit(20.0f, 20000.0f, velocityScaledCutoff);
+
+        // 12dB/octave low-pass, Q=0.35 (fixed resonance)
+        pfs::BiquadCoefficients coefficients;
+        coefficients.makeLowPass(currentSampleRate, velocityScaledCutoff, 0.35f);
+
+        if (voice.filterPrimed)
+        {
+            voice.filterRamp.setTarget(coefficients, numSamples);
+        }
+        else
+        {
+            voice.filterRamp.setImmediate(coefficients);
+            voice.filterPrimed = true;
+        }
+    }
+
+    // Voices are independent within a sample, so each transcendental stage is
+    // gathered across all active voices and evaluated in one block call
+    // (pfs::math; vectorised when LushPad is built with fast maths)
     for (int sample = 0; sample < numSamples; ++sample)
     {
         float mixL = 0.0f;
         float mixR = 0.0f;
+        const float timbreValue = timbreRamp.getValue(sample);
 
-        // Process all active voices
+        SynthVoice* activeVoices[maxVoices];
+        int numActive = 0;
         for (auto& voice : voices)
         {
-            if (!voice.active)
-                continue;
+            if (voice.active)
+                activeVoices[numActive++] = &voice;
+        }
+
+        // Update nested LFO system: modulator layers first, then the primaries they modulate
+        float modulatorValues[maxVoices * numModulatorLFOs];
+        float primaryValues[maxVoices * numPrimaryLFOs];
+
+        for (int v = 0; v < numActive; ++v)
+            advanceModulatorLFOs(*activeVoices[v], modulatorValues + v * numModulatorLFOs);
+        pfs::math::sin(modulatorValues, modulatorValues, numActive * numModulatorLFOs);
+
+        for (int v = 0; v < numActive; ++v)
+        {
+            applyModulatorLFOs(*activeVoices[v], modulatorValues + v * numModulatorLFOs);
+            advancePrimaryLFOs(*activeVoices[v], primaryValues + v * numPrimaryLFOs);
+        }
+        pfs::math::sin(primaryValues, primaryValues, numActive * numPrimaryLFOs);
+
+        // Oscillator arguments and per-voice modulation
+        float oscillatorValues[maxVoices * 3];
+        float saturationGains[maxVoices];
+        float panValues[maxVoices];
 
-            // Update nested LFO system
-            updateVoiceLFOs(voice);
+        for (int v = 0; v < numActive; ++v)
+        {
+            auto& voice = *activeVoices[v];
+            applyPrimaryLFOs(voice, primaryValues + v * numPrimaryLFOs);
 
             // Get LFO modulation values
             float panModulation = voice.lfoSmoothed[0];    // LFO1: -1 to +1 (panning)
@@ -212,28 +240,28 @@ void LushPadAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
             // Calculate modulated saturation gain
             float baseSaturationGain = 1.0f + (timbreValue * 2.0f);
             float modulatedSaturation = baseSaturationGain * (1.0f + satModulation * 0.15f);  // ±15%
-            modulatedSaturation = juce::jlimit(1.0f, 3.0f, modulatedSaturation);
+            saturationGains[v] = juce::jlimit(1.0f, 3.0f, modulatedSaturation);
 
             // Calculate pan position (0.0 = left, 0.5 = center, 1.0 = right)
             float panValue = 0.5f + (panModulation * 0.3f);  // ±30% from center
-            panValue = juce::jlimit(0.0f, 1.0f, panValue);
+            panValues[v] = juce::jlimit(0.0f, 1.0f, panValue);
 
-            // Calculate base frequency for this MIDI note
-            // f = 440 * 2^((note - 69) / 12)
-            float baseFreq = 440.0f * std::pow(2.0f, (voice.currentNote - 69) / 12.0f);
+            // 3 detuned sine oscillators WITH modulated FM feedback
+            // Formula: sin(phase + modulatedFeedback * previousOutput)
+            oscillatorValues[v * 3 + 0] = voice.phase1 + modulatedFeedback * voice.previousOutput1;
+            oscillatorValues[v * 3 + 1] = voice.phase2 + modulatedFeedback * voice.previousOutput2;
+            oscillatorValues[v * 3 + 2] = voice.phase3 + modulatedFeedback * voice.previousOutput3;
+        }
+        pfs::math::sin(oscillatorValues, oscillatorValues, numActive * 3);
 
-            // Detuning ratios
-            // +7 cents: 2^(7/1200) ≈ 1.00407
-            // -7 cents: 2^(-7/1200) ≈ 0.99593
-            float ratio1 = 1.0f;       // Base frequency
-            float ratio2 = 1.00407f;   // +7 cents
-            float ratio3 = 0.99593f;   // -7 cents
+        float voiceOutputs[maxVoices];
 
-            // Generate 3 detuned sine oscillators WITH modulated FM feedback
-            // Formula: sin(phase + modulatedFeedback * previousOutput)
-            float osc1 = std::sin(voice.phase1 + modulatedFeedback * voice.previousOutput1);
-            float osc2 = std::sin(voice.phase2 + modulatedFeedback * voice.previousOutput2);
-            float osc3 = std::sin(voice.phase3 + modulatedFeedback * voice.previousOutput3);
+        for (int v = 0; v < numActive; ++v)
+        {
+            auto& voice = *activeVoices[v];
+            float osc1 = oscillatorValues[v * 3 + 0];
+            float osc2 = oscillatorValues[v * 3 + 1];
+            float osc3 = oscillatorValues[v * 3 + 2];
 
             // Store outputs for next sample's feedback
             voice.previousOutput1 = osc1;
@@ -242,40 +270,41 @@ void LushPadAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
             // Sum oscillators (average to prevent clipping)
             float voiceOutput = (osc1 + osc2 + osc3) / 3.0f;
+            voiceOutputs[v] = saturationGains[v] * voiceOutput;
+        }
 
-            // Apply modulated harmonic saturation using tanh waveshaping
-            voiceOutput = std::tanh(modulatedSaturation * voiceOutput);
-
-            // Calculate velocity-scaled filter cutoff
-            // Soft notes (low velocity): darker sound (cutoff reduced by 50%)
-            // Hard notes (high velocity): brighter sound (cutoff at parameter value)
-            float velocityScaledCutoff = filterCutoffValue * (0.5f + 0.5f * voice.currentVelocity);
-
-            // Clamp to valid range
-            velocityScaledCutoff = juce::jlimit(20.0f, 20000.0f, velocityScaledCutoff);
+        // Apply modulated harmonic saturation using tanh waveshaping
+        pfs::math::tanh(voiceOutputs, voiceOutputs, numActive);
 
-            // Update filter coefficients (12dB/octave low-pass, Q=0.35)
-            auto coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                currentSampleRate,
-                velocityScaledCutoff,
-                0.35f  // Fixed resonance
-            );
-            *voice.filter.coefficients = *coefficients;
+        for (int v = 0; v < numActive; ++v)
+        {
+            auto& voice = *activeVoices[v];
 
-            // Process through filter
-            voiceOutput = voice.filter.processSample(voiceOutput);
+            // Process through filter (coefficients prepared per block above)
+            float voiceOutput = voice.filter.processSample(voiceOutputs[v], voice.filterRamp.next());
 
             // Apply ADSR envelope
             float envelope = voice.adsr.getNextSample();
             voiceOutput *= envelope * voice.currentVelocity;
 
             // Apply LFO-modulated panning
-            float leftGain = 1.0f - panValue;
-            float rightGain = panValue;
+            float leftGain = 1.0f - panValues[v];
+            float rightGain = panValues[v];
 
             mixL += voiceOutput * leftGain;
             mixR += voiceOutput * rightGain;
 
+            // Calculate base frequency for this MIDI note
+            // f = 440 * 2^((note - 69) / 12)
+            float baseFreq = 440.0f * std::pow(2.0f, (voice.currentNote - 69) / 12.0f);
+
+            // Detuning ratios
+            // +7 cents: 2^(7/1200) ≈ 1.00407
+            // -7 cents: 2^(-7/1200) ≈ 0.99593
+            float ratio1 = 1.0f;       // Base frequency
+            float ratio2 = 1.00407f;   // +7 cents
+            float ratio3 = 0.99593f;   // -7 cents
+
             // Update oscillator phases
             float phaseIncrement1 = (baseFreq * ratio1 * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
             float phaseIncrement2 = (baseFreq * ratio2 * juce::MathConstants<float>::twoPi) / static_cast<float>(currentSampleRate);
@@ -391,6 +420,7 @@ void LushPadAudioProcessor::startVoice(SynthVoice& voice, int note, float veloci
     voice.currentVelocity = velocity;
     voice.timestamp = voiceCounter++;
     voice.phase1 = voice.phase2 = voice.phase3 = 0.0f;
+    voice.filterPrimed = false;  // New note snaps to its own cutoff
 
     // Initialize random LFO base frequencies for this voice
     // Primary LFOs (0-2): 0.05-0.2 Hz
@@ -1,6 +1,10 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
+#include <pfs/FastMath.h>
+#include <pfs/Parameters.h>
+#include <pfs/RandomSeed.h>
 
 class LushPadAudioProcessor : public juce::AudioProcessor
 {
@@ -30,11 +34,21 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // Parameter table: builds the layout and the cached atomic pointers below
+    enum Param { kTimbre, kFilterCutoff, kReverbAmount, kNumParams };
+
+    static constexpr std::array<pfs::ParamSpec, kNumParams> kParamSpecs {{
+        // timbre glides over 20 ms (FM depth + saturation); cutoff is ramped by the voice filters
+        pfs::floatParam("timbre", "Timbre", 0.0f, 1.0f, 0.01f, 1.0f, 0.35f, "", 0.02f),
+        pfs::floatParam("filter_cutoff", "Filter Cutoff", 20.0f, 20000.0f, 0.1f, 0.3f, 2000.0f, "Hz"),
+        pfs::floatParam("reverb_amount", "Reverb Amount", 0.0f, 1.0f, 0.01f, 1.0f, 0.4f),
+    }};
+
     juce::AudioProcessorValueTreeState parameters;
 
 private:
-    // Parameter layout creation
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    // Resolved once from kParamSpecs (no string lookups in processBlock)
+    pfs::ParameterSet<Param, kNumParams> params { parameters, kParamSpecs };
 
     // Voice structure for polyphonic synthesis
     struct SynthVoice
@@ -54,8 +68,10 @@ private:
         float previousOutput2 = 0.0f;
         float previousOutput3 = 0.0f;
 
-        // Low-pass filter per voice
-        juce::dsp::IIR::Filter<float> filter;
+        // Low-pass filter per voice (coefficients ramped per sample, no allocation)
+        pfs::BiquadState filter;
+        pfs::BiquadRamp filterRamp;
+        bool filterPrimed = false;  // First block after note start snaps instead of ramping
 
         // Random LFO system (9 per voice)
         // Indices 0-2: Primary LFOs (panning, FM depth, saturation)
@@ -78,6 +94,7 @@ private:
             phase1 = phase2 = phase3 = 0.0f;
             previousOutput1 = previousOutput2 = previousOutput3 = 0.0f;
             filter.reset();
+            filterPrimed = false;
             adsr.reset();
 
             // Reset LFOs
@@ -100,15 +117,22 @@ private:
     juce::dsp::Reverb reverb;
 
     // Random number generator (for LFO frequency randomization)
-    juce::Random random;
+    juce::Random random { pfs::nextRandomSeed() };
 
     // Helper methods for voice allocation
     void allocateVoice(int note, float velocity);
     void releaseVoice(int note);
     void startVoice(SynthVoice& voice, int note, float velocity);
 
-    // LFO update (nested modulation)
-    void updateVoiceLFOs(SynthVoice& voice);
+    // LFO update (nested modulation), split into stages so the sines of every
+    // active voice are evaluated together: advance*() writes the phases,
+    // apply*() consumes the sines
+    static constexpr int numPrimaryLFOs = 3;     // Indices 0-2
+    static constexpr int numModulatorLFOs = 6;   // Secondary 3-5 + tertiary 6-8
+    void advanceModulatorLFOs(SynthVoice& voice, float* phases);
+    void applyModulatorLFOs(SynthVoice& voice, const float* sines);
+    void advancePrimaryLFOs(SynthVoice& voice, float* phases);
+    void applyPrimaryLFOs(SynthVoice& voice, const float* sines);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LushPadAudioProcessor)
 };
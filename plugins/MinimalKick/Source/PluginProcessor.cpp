@@ -156,40 +156,59 @@ void MinimalKickAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, j
         float pitchDecaySeconds = pitchDecayMs / 1000.0f;
         float pitchDecayRate = -std::log(0.001f) / pitchDecaySeconds;
 
-        // Process mono (oscillator generates single channel)
-        for (int sample = 0; sample < numSamples; ++sample)
+        // Saturation/drive gain (tanh waveshaping)
+        float driveNormalized = drivePercent / 100.0f;  // 0.0 to 1.0
+        float gain = 1.0f + (driveNormalized * 9.0f);   // 1.0 to 10.0
+
+        // Process mono (oscillator generates single channel) in chunks: the
+        // exp/pow2/tanh stages each run as one block call per chunk
+        for (int chunkStart = 0; chunkStart < numSamples; chunkStart += mathChunkSize)
         {
+            const int chunkSize = juce::jmin(mathChunkSize, numSamples - chunkStart);
+            float pitchEnvelope[mathChunkSize];
+            float frequencyMultiplier[mathChunkSize];
+            float outputSamples[mathChunkSize];
+
             // Update pitch envelope (exponential decay)
-            float elapsedSeconds = pitchEnvelopeSampleCount / static_cast<float>(sampleRate);
-            pitchEnvelopeValue = std::exp(-pitchDecayRate * elapsedSeconds);
-            pitchEnvelopeSampleCount++;
+            for (int i = 0; i < chunkSize; ++i)
+            {
+                float elapsedSeconds = pitchEnvelopeSampleCount / static_cast<float>(sampleRate);
+                pitchEnvelope[i] = -pitchDecayRate * elapsedSeconds;
+                pitchEnvelopeSampleCount++;
+            }
+            pfs::math::exp(pitchEnvelope, pitchEnvelope, chunkSize);
+            pitchEnvelopeValue = pitchEnvelope[chunkSize - 1];
 
             // Calculate modulated frequency
             // Formula: freq = baseFreq * pow(2.0, envelopeValue * sweepSemitones / 12.0)
             // This converts semitone offset to frequency multiplier
-            float pitchOffsetSemitones = pitchEnvelopeValue * sweepSemitones;
-            float frequencyMultiplier = std::pow(2.0f, pitchOffsetSemitones / 12.0f);
-            float modulatedFrequency = currentFrequency * frequencyMultiplier;
+            for (int i = 0; i < chunkSize; ++i)
+                frequencyMultiplier[i] = pitchEnvelope[i] * sweepSemitones / 12.0f;
+            pfs::math::pow2(frequencyMultiplier, frequencyMultiplier, chunkSize);
 
-            // Set oscillator frequency (juce::dsp::Oscillator handles phase continuity)
-            oscillator.setFrequency(modulatedFrequency);
+            for (int i = 0; i < chunkSize; ++i)
+            {
+                float modulatedFrequency = currentFrequency * frequencyMultiplier[i];
+
+                // Set oscillator frequency (juce::dsp::Oscillator handles phase continuity)
+                oscillator.setFrequency(modulatedFrequency);
 
-            // Generate sine wave sample
-            float oscillatorSample = oscillator.processSample(0.0f);
+                // Generate sine wave sample
+                float oscillatorSample = oscillator.processSample(0.0f);
 
-            // Apply amplitude envelope
-            float envelopeValue = envelope.getNextSample();
-            float envelopedSample = oscillatorSample * envelopeValue;
+                // Apply amplitude envelope
+                float envelopeValue = envelope.getNextSample();
+                float envelopedSample = oscillatorSample * envelopeValue;
+                outputSamples[i] = gain * envelopedSample;
+            }
 
             // Apply saturation/drive (tanh waveshaping)
-            float driveNormalized = drivePercent / 100.0f;  // 0.0 to 1.0
-            float gain = 1.0f + (driveNormalized * 9.0f);   // 1.0 to 10.0
-            float outputSample = std::tanh(gain * envelopedSample);
+            pfs::math::tanh(outputSamples, outputSamples, chunkSize);
 
             // Write to both channels (mono to stereo)
             for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
             {
-                buffer.setSample(channel, sample, outputSample);
+                juce::FloatVectorOperations::copy(buffer.getWritePointer(channel, chunkStart), outputSamples, chunkSize);
             }
         }
     }
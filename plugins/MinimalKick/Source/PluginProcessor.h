@@ -1,6 +1,7 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/FastMath.h>
 
 class MinimalKickAudioProcessor : public juce::AudioProcessor
 {
@@ -47,6 +48,7 @@ private:
     // Pitch envelope state
     float pitchEnvelopeValue { 0.0f };  // Normalized 0.0 to 1.0 (decays from 1.0 to 0.0)
     int pitchEnvelopeSampleCount { 0 };
+    static constexpr int mathChunkSize = 64;  // Samples per block exp/pow2/tanh call
 
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
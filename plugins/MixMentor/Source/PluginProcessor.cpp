@@ -76,15 +76,17 @@ void MixMentorAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     tonalityAnalyzer.process (buffer);
     stereoAnalyzer.process   (buffer);
 
-    // --- Snapshot analyser results into atomics for the editor ---------------
-
-    latestRmsDb.store            (dynamicsAnalyzer.getRmsDb());
-    latestLufs.store             (dynamicsAnalyzer.getLufsIntegrated());
-    latestPeakDb.store           (dynamicsAnalyzer.getPeakDb());
-    latestSpectralCentroid.store (tonalityAnalyzer.getSpectralCentroidHz());
-    latestSpectralFlatness.store (tonalityAnalyzer.getSpectralFlatness());
-    latestCorrelation.store      (stereoAnalyzer.getStereoCorrelation());
-    latestStereoWidth.store      (stereoAnalyzer.getStereoWidth());
+    // --- Publish one coherent snapshot for the editor ------------------------
+
+    MixAnalysisResult r;
+    r.rmsDb              = dynamicsAnalyzer.getRmsDb();
+    r.lufsIntegrated     = dynamicsAnalyzer.getLufsIntegrated();
+    r.peakDb             = dynamicsAnalyzer.getPeakDb();
+    r.spectralCentroidHz = tonalityAnalyzer.getSpectralCentroidHz();
+    r.spectralFlatness   = tonalityAnalyzer.getSpectralFlatness();
+    r.stereoCorrelation  = stereoAnalyzer.getStereoCorrelation();
+    r.stereoWidth        = stereoAnalyzer.getStereoWidth();
+    analysisTelemetry.publish (r);
 }
 
 // =============================================================================
@@ -100,17 +102,11 @@ juce::AudioProcessorEditor* MixMentorAudioProcessor::createEditor()
 // Thread-safe snapshot for the editor
 // =============================================================================
 
-MixAnalysisResult MixMentorAudioProcessor::getLatestAnalysis() const
+MixAnalysisResult MixMentorAudioProcessor::getLatestAnalysis()
 {
-    MixAnalysisResult r;
-    r.rmsDb              = latestRmsDb.load();
-    r.lufsIntegrated     = latestLufs.load();
-    r.peakDb             = latestPeakDb.load();
-    r.spectralCentroidHz = latestSpectralCentroid.load();
-    r.spectralFlatness   = latestSpectralFlatness.load();
-    r.stereoCorrelation  = latestCorrelation.load();
-    r.stereoWidth        = latestStereoWidth.load();
-    return r;
+    // Keeps the previous snapshot when no block ran since the last call
+    analysisTelemetry.readLatest (latestAnalysis);
+    return latestAnalysis;
 }
 
 // =============================================================================
@@ -1,6 +1,8 @@
 #pragma once
 #include <JuceHeader.h>
 
+#include <pfs/Telemetry.h>
+
 #include "analysis/DynamicsAnalyzer.h"
 #include "analysis/TonalityAnalyzer.h"
 #include "analysis/StereoAnalyzer.h"
@@ -10,7 +12,8 @@
  * MixMentorAudioProcessor
  *
  * Master-bus analyser.  Audio passes through unmodified; each block is
- * forwarded to three lightweight analyser objects that update atomic state.
+ * forwarded to three lightweight analyser objects, and their results are
+ * published as one MixAnalysisResult frame per block.
  * The editor polls getLatestAnalysis() via a juce::Timer to refresh the GUI.
  *
  * Parameters
@@ -56,9 +59,9 @@ public:
     // Public API for the editor
     // -------------------------------------------------------------------------
 
-    /** Returns a snapshot of the latest analysis results.
-     *  Safe to call from the message thread (reads atomics). */
-    MixAnalysisResult getLatestAnalysis() const;
+    /** Returns the newest analysis snapshot, all fields from the same block.
+     *  Message thread only (single telemetry reader). */
+    MixAnalysisResult getLatestAnalysis();
 
     /** APVTS — public so the editor can create parameter attachments. */
     juce::AudioProcessorValueTreeState apvts;
@@ -74,15 +77,10 @@ private:
     StereoAnalyzer   stereoAnalyzer;
 
     // -------------------------------------------------------------------------
-    // Atomic snapshot (written audio thread, read message thread)
+    // Snapshot channel (published audio thread, read message thread)
     // -------------------------------------------------------------------------
-    std::atomic<float> latestRmsDb           { -60.0f };
-    std::atomic<float> latestLufs            { -60.0f };
-    std::atomic<float> latestPeakDb          { -60.0f };
-    std::atomic<float> latestSpectralCentroid {1000.0f };
-    std::atomic<float> latestSpectralFlatness {   0.5f };
-    std::atomic<float> latestCorrelation      {   1.0f };
-    std::atomic<float> latestStereoWidth      {   0.0f };
+    pfs::TelemetryChannel<MixAnalysisResult> analysisTelemetry;
+    MixAnalysisResult latestAnalysis; // message thread only
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MixMentorAudioProcessor)
 };
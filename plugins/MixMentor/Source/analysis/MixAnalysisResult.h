@@ -4,8 +4,8 @@
  * MixAnalysisResult
  *
  * Plain data snapshot produced on the audio thread and consumed on the
- * message thread (via atomic fields in the processor).  All values are
- * in display-friendly units.
+ * message thread (one frame per block through pfs::TelemetryChannel, so it
+ * must stay trivially copyable).  All values are in display-friendly units.
  */
 struct MixAnalysisResult
 {
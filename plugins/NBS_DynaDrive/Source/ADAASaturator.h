@@ -1,8 +1,10 @@
 #pragma once
 
-// Self-contained: uses only standard C++ math.
+// Self-contained: uses only standard C++ math and pfs::math (FastMath.h).
 // No JUCE headers needed — keeps ADAASaturator.h independently compilable
 // and avoids include-order dependencies with juce_dsp.
+#include <pfs/FastMath.h>
+
 #include <algorithm>
 #include <cmath>
 
@@ -47,7 +49,7 @@ struct DC1Blocker
 //==============================================================================
 // ADAASaturator
 //
-// First-order Antiderivative Anti-Aliasing (ADAA) waveshaper.
+// First- and second-order Antiderivative Anti-Aliasing (ADAA) waveshaper.
 //
 // Phase 4.2 additions over Phase 4.1:
 //   - h_curve blend between soft (tanh) and hard (cubic polynomial)
@@ -63,7 +65,12 @@ struct DC1Blocker
 //   5. output compensation: y /= tanh(driveGain) / driveGain
 //   6. DC block:            y = HPF_5Hz(y)
 //
-// All ADAA math is double precision for numerical safety.
+// processSample runs the ADAA math in double precision and is the reference.
+// processBlock is the float path the plugin runs: same shaper, laid out over
+// time so the antiderivatives go through the block pfs::math kernels
+// (see processBlock for how it stays accurate in float).
+// processBlockSecondOrder is the second-order variant for the low
+// oversampling factors, in double (see there).
 // Input/output are float (JUCE audio thread convention).
 //
 // CRITICAL: xPrev stores the DRIVEN, pre-processed value (not raw input).
@@ -82,6 +89,8 @@ public:
     {
         xPrev[0] = 0.0;
         xPrev[1] = 0.0;
+        secondOrder[0] = {};
+        secondOrder[1] = {};
 
         for (int ch = 0; ch < 2; ++ch)
             dcBlocker[ch].prepare (sampleRate, 5.0f);
@@ -94,6 +103,8 @@ public:
     {
         xPrev[0] = 0.0;
         xPrev[1] = 0.0;
+        secondOrder[0] = {};
+        secondOrder[1] = {};
 
         for (int ch = 0; ch < 2; ++ch)
             dcBlocker[ch].reset();
@@ -190,7 +201,215 @@ public:
         return dcBlocker[ch].processSample (static_cast<float> (y));
     }
 
+    //==========================================================================
+    // processBlock — float path for one channel's block, in place
+    //
+    //   Same arguments and signal flow as processSample, with the parameters
+    //   held for the block. Each driven sample's antiderivative is evaluated
+    //   once (processSample evaluates two per sample) through the block
+    //   exp/log/tanh of Math, several samples per SIMD register; the ADAA
+    //   quotient is then taken over the block, and only the DC blocker runs
+    //   sample by sample. The steps with selects and clamps are written on the
+    //   pfs::fastmath lane operations, as compilers will not vectorise them
+    //   from plain loops without -ffast-math.
+    //
+    //   Float cancellation is kept down in two ways:
+    //     - F1(x) - F1(xPrev) is formed as (|x| - |xPrev|) + (G(x) - G(xPrev))
+    //       with G = F1 - |x|, which stays below 0.7, so rounding scales with
+    //       G rather than with F1 ~ |x|.
+    //     - Below kFloatDeltaThreshold the L'Hopital fallback f_blend takes
+    //       over, evaluated at the midpoint of the step. That is second-order
+    //       accurate, so the threshold can sit where float rounding would
+    //       otherwise dominate the quotient.
+    //
+    //   Max deviation from processSample: kFloatPathMaxError (checked by
+    //   test/fastmath/FastMathBench --check).
+    //==========================================================================
+    template <typename Math = pfs::math>
+    void processBlock (float* data,
+                       int    numSamples,
+                       int    channel,
+                       float  driveGain,
+                       float  alpha,
+                       float  bias,
+                       float  oddGain) noexcept
+    {
+        using Ops = pfs::fastmath::detail::VectorOps;
+        using V   = Ops::Float;
+
+        const int ch = (channel >= 0 && channel < 2) ? channel : 0;
+
+        const V hardMix = Ops::set (alpha);
+        const V softMix = Ops::set (1.0f - alpha);
+        const V one     = Ops::set (1.0f);
+
+        // Driven samples of the chunk, with the previous one at index 0. The
+        // lane loops run to a whole number of vectors, so the arrays are padded
+        // and x is extended past the chunk with its last sample.
+        float x[kPaddedChunk];
+        float absX[kPaddedChunk];
+        float g[kPaddedChunk];
+        float scratch[kPaddedChunk];
+        float y[kPaddedChunk];
+
+        x[0] = static_cast<float> (xPrev[ch]);
+
+        for (int start = 0; start < numSamples; start += kBlockChunk)
+        {
+            const int n = std::min (kBlockChunk, numSamples - start);
+            float* const chunk = data + start;
+
+            // Lane counts for the n + 1 antiderivatives and the n quotients
+            const int numG = roundUpToLanes (n + 1);
+            const int numQ = roundUpToLanes (n);
+
+            // 1-3. odd pre-distortion, even bias, drive
+            for (int i = 0; i < n; ++i)
+            {
+                const float v = chunk[i];
+                x[i + 1] = (v + oddGain * v * v * v + bias) * driveGain;
+            }
+            std::fill (x + n + 1, x + numG + 1, x[n]);
+
+            // G(x) = (1 - alpha) ln(1 + e^(-2|x|)) + alpha (F1_hard(x) - |x|),
+            // i.e. F1_blend without its |x| and constant terms. Index 0 is
+            // recomputed with the current alpha, as in processSample.
+            for (int i = 0; i < numG; ++i)
+            {
+                absX[i]    = std::abs (x[i]);
+                scratch[i] = -2.0f * absX[i];
+            }
+            Math::exp (scratch, scratch, numG);
+            for (int i = 0; i < numG; ++i)
+                scratch[i] += 1.0f;
+            Math::log (scratch, scratch, numG);
+            for (int i = 0; i < numG; i += Ops::width)
+            {
+                // F1_hard(x) - |x| is -0.375 from |x| = 1 on, where the
+                // polynomial lands too, so clamping |x| covers both pieces
+                const V m       = Ops::min (Ops::load (absX + i), one);
+                const V hardRel = Ops::mul (m, Ops::sub (Ops::mul (m, Ops::sub (Ops::set (0.75f),
+                                                                                Ops::mul (Ops::set (0.125f), Ops::mul (m, m)))),
+                                                         one));
+                Ops::store (g + i, Ops::add (Ops::mul (softMix, Ops::load (scratch + i)),
+                                             Ops::mul (hardMix, hardRel)));
+            }
+
+            // L'Hopital fallback at the step midpoints: f_hard into y (the
+            // clamp makes the cubic +-1 beyond |x| = 1), tanh into scratch
+            for (int i = 0; i < numQ; i += Ops::width)
+            {
+                const V mid = Ops::mul (Ops::set (0.5f), Ops::add (Ops::load (x + i), Ops::load (x + i + 1)));
+                const V m   = Ops::min (Ops::max (mid, Ops::set (-1.0f)), one);
+                Ops::store (scratch + i, mid);
+                Ops::store (y + i, Ops::mul (m, Ops::sub (Ops::set (1.5f), Ops::mul (Ops::set (0.5f), Ops::mul (m, m)))));
+            }
+            Math::tanh (scratch, scratch, numQ);
+
+            // 4-5. ADAA quotient, fallback, gain compensation
+            const V makeup    = Ops::set (driveGain > 1.0f ? 1.0f / driveGain : 1.0f);
+            const V threshold = Ops::set (kFloatDeltaThreshold);
+
+            for (int i = 0; i < numQ; i += Ops::width)
+            {
+                const V delta    = Ops::sub (Ops::load (x + i + 1), Ops::load (x + i));
+                const auto nearSing = Ops::lessThan (Ops::abs (delta), threshold);
+                const V diff     = Ops::add (Ops::sub (Ops::load (absX + i + 1), Ops::load (absX + i)),
+                                             Ops::sub (Ops::load (g + i + 1), Ops::load (g + i)));
+                const V quotient = Ops::div (diff, Ops::select (nearSing, one, delta));
+                const V fallback = Ops::add (Ops::mul (softMix, Ops::load (scratch + i)),
+                                             Ops::mul (hardMix, Ops::load (y + i)));
+                Ops::store (y + i, Ops::mul (Ops::select (nearSing, fallback, quotient), makeup));
+            }
+
+            // Non-finite guard, clamp and DC block, sample by sample
+            for (int i = 0; i < n; ++i)
+            {
+                const float shaped = std::isfinite (y[i]) ? std::min (std::max (y[i], -10.0f), 10.0f) : 0.0f;
+                chunk[i] = dcBlocker[ch].processSample (shaped);
+            }
+
+            x[0] = std::isfinite (x[n]) ? x[n] : 0.0f;
+        }
+
+        xPrev[ch] = static_cast<double> (x[0]);
+    }
+
+    //==========================================================================
+    // processBlockSecondOrder — second-order ADAA for one channel's block
+    //
+    //   Same arguments and pre-processing as processSample. The shaper output
+    //   is the second divided difference of F2_blend over the last three
+    //   driven samples,
+    //     y = 2 / (x0 - x2) * (D(x0, x1) - D(x1, x2)),
+    //     D(a, b) = (F2(a) - F2(b)) / (a - b),
+    //   which squares the sinc rolloff of first-order ADAA: at 1x or 2x it
+    //   suppresses aliases about as well as the first-order path at 4x.
+    //   Costs one F2 per sample (a dilogarithm series) and delays by one
+    //   sample where the first order delays by half (kSecondOrderDelay).
+    //
+    //   The second divided difference cancels far worse than the first, so
+    //   this runs in double. As in processSample, the history stores the
+    //   soft and hard parts apart and they are blended with the current
+    //   alpha, and the history is separate from processBlock's: switching
+    //   order needs a reset().
+    //==========================================================================
+    void processBlockSecondOrder (float* data,
+                                  int    numSamples,
+                                  int    channel,
+                                  float  driveGain,
+                                  float  alpha,
+                                  float  bias,
+                                  float  oddGain) noexcept
+    {
+        const int ch = (channel >= 0 && channel < 2) ? channel : 0;
+
+        const double drive  = static_cast<double> (driveGain);
+        const double odd    = static_cast<double> (oddGain);
+        const double offset = static_cast<double> (bias);
+        const double dalpha = static_cast<double> (alpha);
+        const double makeup = driveGain > 1.0f ? 1.0 / drive : 1.0;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const double x     = static_cast<double> (data[i]);
+            const double x_drv = (x + odd * x * x * x + offset) * drive;
+
+            double y = secondOrderShaper (x_drv, secondOrder[ch], dalpha) * makeup;
+
+            if (! std::isfinite (y))
+            {
+                y = 0.0;
+                secondOrder[ch] = {};
+            }
+            else
+            {
+                y = std::min (std::max (y, -10.0), 10.0);
+            }
+
+            data[i] = dcBlocker[ch].processSample (static_cast<float> (y));
+        }
+    }
+
+    // Float path accuracy (see processBlock)
+    static constexpr float kFloatDeltaThreshold = 0.02f;
+    static constexpr float kFloatPathMaxError   = 1.0e-4f;
+
+    // Group delay of the shaper at the rate it runs at, in samples
+    static constexpr double kFirstOrderDelay  = 0.5;
+    static constexpr double kSecondOrderDelay = 1.0;
+
 private:
+    // Samples per processBlock pass (stack scratch, no allocation)
+    static constexpr int kBlockChunk  = 256;
+    static constexpr int kPaddedChunk = kBlockChunk + 1 + pfs::fastmath::detail::VectorOps::width;
+
+    static int roundUpToLanes (int count) noexcept
+    {
+        constexpr int width = pfs::fastmath::detail::VectorOps::width;
+        return (count + width - 1) / width * width;
+    }
+
     //==========================================================================
     // Waveshaper: soft (tanh)
     //==========================================================================
@@ -258,6 +477,117 @@ private:
         return (1.0 - alpha) * F1_soft (x) + alpha * F1_hard (x);
     }
 
+    //==========================================================================
+    // Second antiderivatives, odd with F2(0) = 0
+    //
+    // F2_hard: |x| <= 1:  0.25x^3 - 0.025x^5
+    //           x >  1:   0.5x^2 - 0.375x + 0.1
+    //
+    // F2_soft, from ln(cosh(a)) = a - ln(2) + ln(1 + e^(-2a)) for a = |x|:
+    //   a^2 / 2 - a ln(2) + Li2(-e^(-2a)) / 2 + pi^2 / 24
+    // Li2(z) for z in [-1, 0) from its Bernoulli series in w = -ln(1 - z),
+    // here w = -ln(1 + e^(-2a)) in [-ln 2, 0): terms to w^13 reach double
+    // precision.
+    //==========================================================================
+    static double F2_hard (double x) noexcept
+    {
+        const double ax = std::abs (x);
+        const double magnitude = ax > 1.0 ? 0.5 * ax * ax - 0.375 * ax + 0.1
+                                          : ax * ax * ax * (0.25 - 0.025 * ax * ax);
+        return x < 0.0 ? -magnitude : magnitude;
+    }
+
+    static double F2_soft (double x) noexcept
+    {
+        const double ax = std::abs (x);
+        const double w  = -std::log1p (std::exp (-2.0 * ax));
+        const double w2 = w * w;
+
+        // Li2 = w - w^2/4 + sum B_2k w^(2k+1) / (2k+1)!
+        const double li2 = w - 0.25 * w2
+                         + w * w2 * (1.0 / 36.0
+                         + w2 * (-1.0 / 3600.0
+                         + w2 * (1.0 / 211680.0
+                         + w2 * (-1.0 / 10886400.0
+                         + w2 * (1.0 / 526901760.0
+                         + w2 * (-691.0 / 16999766784000.0))))));
+
+        const double magnitude = 0.5 * ax * ax - 0.6931471805599453 * ax
+                               + 0.5 * li2 + 0.41123351671205660;  // pi^2 / 24
+        return x < 0.0 ? -magnitude : magnitude;
+    }
+
+    //==========================================================================
+    // Second-order history per channel: the last two driven samples, F2 of
+    // x1 and D(x1, x2), each with soft and hard parts kept apart
+    //==========================================================================
+    struct SecondOrderState
+    {
+        double x1 = 0.0, x2 = 0.0;
+        double f2Soft1 = 0.0, f2Hard1 = 0.0;
+        double dSoft1 = 0.0, dHard1 = 0.0;
+    };
+
+    // Below this step D(a, b) is taken as F1 at the midpoint: its error
+    // (~f' step^2 / 24) and the F2 cancellation (~F2 * 1e-16 / step) meet here
+    static constexpr double kSecondOrderStepThreshold = 1.0e-4;
+
+    // Below this span the second difference takes the x0 = x2 limit
+    static constexpr double kSecondOrderSpanThreshold = 1.0e-3;
+
+    static double secondOrderShaper (double x0, SecondOrderState& s, double alpha) noexcept
+    {
+        const double f2Soft0 = F2_soft (x0);
+        const double f2Hard0 = F2_hard (x0);
+
+        double dSoft0, dHard0;
+        const double step = x0 - s.x1;
+        if (std::abs (step) < kSecondOrderStepThreshold)
+        {
+            const double mid = 0.5 * (x0 + s.x1);
+            dSoft0 = F1_soft (mid);
+            dHard0 = F1_hard (mid);
+        }
+        else
+        {
+            dSoft0 = (f2Soft0 - s.f2Soft1) / step;
+            dHard0 = (f2Hard0 - s.f2Hard1) / step;
+        }
+
+        double y;
+        const double span = x0 - s.x2;
+        if (std::abs (span) >= kSecondOrderSpanThreshold)
+        {
+            const double d0 = (1.0 - alpha) * dSoft0   + alpha * dHard0;
+            const double d1 = (1.0 - alpha) * s.dSoft1 + alpha * s.dHard1;
+            y = 2.0 * (d0 - d1) / span;
+        }
+        else
+        {
+            // x0 ~ x2: limit around their mean, exact for a linear shaper
+            const double mean  = 0.5 * (x0 + s.x2);
+            const double delta = mean - s.x1;
+            if (std::abs (delta) < kSecondOrderSpanThreshold)
+            {
+                y = blendedF ((2.0 * mean + s.x1) / 3.0, alpha);
+            }
+            else
+            {
+                const double f2Mean = (1.0 - alpha) * F2_soft (mean) + alpha * F2_hard (mean);
+                const double f2Prev = (1.0 - alpha) * s.f2Soft1      + alpha * s.f2Hard1;
+                y = 2.0 / delta * (blendedF1 (mean, alpha) + (f2Prev - f2Mean) / delta);
+            }
+        }
+
+        s.x2      = s.x1;
+        s.x1      = x0;
+        s.f2Soft1 = f2Soft0;
+        s.f2Hard1 = f2Hard0;
+        s.dSoft1  = dSoft0;
+        s.dHard1  = dHard0;
+        return y;
+    }
+
     //==========================================================================
     // State
     //==========================================================================
@@ -265,6 +595,9 @@ private:
     // Per-channel ADAA state: stores the driven, pre-processed x value
     double xPrev[2] = { 0.0, 0.0 };
 
+    // Per-channel second-order ADAA history (processBlockSecondOrder)
+    SecondOrderState secondOrder[2];
+
     // Per-channel DC-blocking 5 Hz 1-pole highpass (pure C++, no JUCE dependency)
     DC1Blocker dcBlocker[2];
 };
@@ -4,6 +4,7 @@
 // No JUCE headers needed — keeps DynamicsEngine.h independently compilable.
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 //==============================================================================
 // DynamicsEngine
@@ -11,11 +12,13 @@
 // Phase 4.3: Custom dual upward+downward compressor.
 //
 // Architecture:
-//   - RMS level detector with configurable window (~10ms)
+//   - Sliding RMS level detector (~10ms window, updated every sample)
 //   - Program-dependent ballistics (crest factor analysis over 50ms, 200ms smoothed)
 //   - Downward compression with 6dB soft knee (standard compressor logic)
 //   - Upward compression: raises signals below threshold toward threshold
 //   - Linked stereo detection: uses max(L, R) RMS for gain computation
+//   - Optional lookahead hold: sliding-window max of the RMS level
+//     (monotonic deque, O(1) amortised per sample), see setLevelWindow()
 //   - Gains computed in dB, summed, converted to linear once
 //   - Gain smoothing via 1-pole ballistic IIR (smoothed gain computer output)
 //
@@ -36,6 +39,9 @@
 //
 // M/S mode: use two independent DynamicsEngine instances (one per channel),
 //   each detects its own mono level and applies its own gain independently.
+//
+// Lookahead: detect on a key signal running N samples ahead of the audio the
+//   gain is applied to (LookaheadDelay below) with setLevelWindow(N + 1).
 //==============================================================================
 class DynamicsEngine
 {
@@ -44,14 +50,22 @@ public:
 
     //==========================================================================
     // prepare — call from PluginProcessor::prepareToPlay()
+    //
+    //   maxLevelWindow sizes the lookahead level window (setLevelWindow()
+    //   never allocates); 0 leaves it unavailable. The window itself is kept.
     //==========================================================================
-    void prepare (double sampleRate) noexcept
+    void prepare (double sampleRate, int maxLevelWindow = 0)
     {
         sampleRateVal = sampleRate;
 
-        // RMS window: ~10ms
+        windowValues.assign (static_cast<size_t> (std::max (maxLevelWindow, 0)), 0.0f);
+        windowTimes.assign (windowValues.size(), 0u);
+        levelWindowSize = std::min (levelWindowSize, static_cast<int> (windowValues.size()));
+
+        // RMS window: ~10ms of squared samples
         const int rmsWindowSamples = static_cast<int> (sampleRate * 0.010);
         rmsWindowSize = std::max (1, rmsWindowSamples);
+        rmsSquares.assign (static_cast<size_t> (rmsWindowSize), 0.0f);
 
         // Crest factor analysis window: 50ms
         const int crestWindowSamples = static_cast<int> (sampleRate * 0.050);
@@ -70,9 +84,13 @@ public:
     //==========================================================================
     void reset() noexcept
     {
-        rmsAccum        = 0.0f;
-        rmsCount        = 0;
-        rmsCurrent      = 0.0f;
+        std::fill (rmsSquares.begin(), rmsSquares.end(), 0.0f);
+        rmsSum          = 0.0;
+        rmsPos          = 0;
+        meanSquare      = 0.0f;
+        levelMeanSquare = 0.0f;
+        levelDbSquare   = 0.0f;
+        levelDb         = -120.0f;
 
         peakAccum       = 0.0f;
         peakCount       = 0;
@@ -83,13 +101,50 @@ public:
 
         gainDb          = 0.0f;
         gainSmoothed    = 0.0f;
+
+        resetLevelWindow();
     }
 
+    //==========================================================================
+    // setLevelWindow — lookahead hold
+    //
+    //   windowSamples > 0 makes computeGain() follow the max RMS level over
+    //   the last windowSamples samples. With the audio delayed by
+    //   windowSamples - 1, the level rises for a transient before it reaches
+    //   the gain stage, and it is held until the transient has passed. The
+    //   level is still the RMS, so the window only moves the timing: a window
+    //   of 1 is the plain RMS detector. 0 bypasses the window.
+    //   A resize keeps the held level: the window is trimmed to the new
+    //   length (or grows into it), so a lookahead change does not release
+    //   the compressor. Clamped to the prepare() capacity; no allocation.
+    //==========================================================================
+    void setLevelWindow (int windowSamples) noexcept
+    {
+        const int newSize = std::clamp (windowSamples, 0, static_cast<int> (windowValues.size()));
+        const bool wasOff = (levelWindowSize == 0);
+        levelWindowSize = newSize;
+
+        // Nothing was pushed while the window was off (or it is off now):
+        // start over from the current level
+        if (wasOff || newSize == 0)
+        {
+            resetLevelWindow();
+            return;
+        }
+
+        expireLevelWindow();
+        if (windowCount > 0)
+            levelMeanSquare = windowValues[static_cast<size_t> (windowHead)];
+    }
+
+    int getLevelWindow() const noexcept { return levelWindowSize; }
+
     //==========================================================================
     // detectLevel (linked stereo version)
     //
-    //   Accumulates RMS and peak for a single sample (using max of L/R).
-    //   Updates rmsCurrent and peakCurrent once a full window is filled.
+    //   Slides the RMS window on by one sample (using max of L/R), so the
+    //   level follows transients sample by sample. Updates peakCurrent and
+    //   the crest factor once a full crest window is filled.
     //   Call this with both channels to get linked stereo detection.
     //==========================================================================
     void detectLevel (float sampleL, float sampleR) noexcept
@@ -97,17 +152,28 @@ public:
         // Linked stereo: use the louder channel
         const float s = std::max (std::abs (sampleL), std::abs (sampleR));
 
-        // RMS accumulation (sum of squares)
-        rmsAccum += s * s;
-        ++rmsCount;
+        // Sliding RMS: running sum of the squares in the window. The sum is
+        // rebuilt exactly once per lap of the ring so rounding cannot creep.
+        const float square = s * s;
+        float& oldest = rmsSquares[static_cast<size_t> (rmsPos)];
+        rmsSum += static_cast<double> (square) - static_cast<double> (oldest);
+        oldest = square;
 
-        if (rmsCount >= rmsWindowSize)
+        if (++rmsPos == rmsWindowSize)
         {
-            rmsCurrent  = std::sqrt (std::max (rmsAccum / static_cast<float> (rmsCount), 1.0e-9f));
-            rmsAccum    = 0.0f;
-            rmsCount    = 0;
+            rmsPos = 0;
+            rmsSum = 0.0;
+            for (const float sq : rmsSquares)
+                rmsSum += static_cast<double> (sq);
         }
 
+        meanSquare = static_cast<float> (std::max (rmsSum, 0.0) / static_cast<double> (rmsWindowSize));
+
+        if (levelWindowSize > 0)
+            pushWindowLevel (meanSquare);
+        else
+            levelMeanSquare = meanSquare;
+
         // Peak accumulation (max abs)
         if (s > peakAccum)
             peakAccum = s;
@@ -120,6 +186,7 @@ public:
             peakCount   = 0;
 
             // Crest factor = peak / RMS (clamped to [1, 10])
+            const float rmsCurrent = std::sqrt (meanSquare);
             const float rawCrest = (rmsCurrent > 1.0e-6f)
                                    ? (peakCurrent / rmsCurrent)
                                    : 1.0f;
@@ -165,10 +232,13 @@ public:
                        float upAmount,
                        float dynamicsMacro) noexcept
     {
-        // Convert current RMS level to dB
-        const float levelDb = (rmsCurrent > 1.0e-6f)
-                              ? (20.0f * std::log10 (rmsCurrent))
-                              : -120.0f;
+        // Current RMS level in dB, held over the lookahead window when there
+        // is one; converted only when it changes (floored at -120 dB)
+        if (levelMeanSquare != levelDbSquare)
+        {
+            levelDbSquare = levelMeanSquare;
+            levelDb = (levelMeanSquare > 1.0e-12f) ? (10.0f * std::log10 (levelMeanSquare)) : -120.0f;
+        }
 
         // ------------------------------------------------------------------
         // Program-dependent ballistics: high crest factor → faster times
@@ -284,6 +354,67 @@ public:
     float getCrestFactor()      const noexcept { return crestFactor; }
 
 private:
+    //==========================================================================
+    // Sliding-window max: a monotonic deque in a ring buffer. Values decrease
+    // from the front, so the front is the window's max; a new sample drops
+    // every older value it beats from the back, and the front leaves once it
+    // is windowSize samples old. Each sample is pushed and popped at most
+    // once: O(1) amortised, at most windowSize entries. Values are mean
+    // squares, which order the same way as the dB levels.
+    //==========================================================================
+    void pushWindowLevel (float level) noexcept
+    {
+        const int capacity = static_cast<int> (windowValues.size());
+
+        expireLevelWindow();
+
+        while (windowCount > 0)
+        {
+            int back = windowHead + windowCount - 1;
+            if (back >= capacity)
+                back -= capacity;
+
+            if (windowValues[static_cast<size_t> (back)] > level)
+                break;
+
+            --windowCount;
+        }
+
+        int slot = windowHead + windowCount;
+        if (slot >= capacity)
+            slot -= capacity;
+
+        windowValues[static_cast<size_t> (slot)] = level;
+        windowTimes[static_cast<size_t> (slot)]  = windowClock;
+        ++windowCount;
+        ++windowClock;
+
+        levelMeanSquare = windowValues[static_cast<size_t> (windowHead)];
+    }
+
+    // Drops front entries older than the window (more than one only after
+    // the window shrank)
+    void expireLevelWindow() noexcept
+    {
+        const int capacity = static_cast<int> (windowValues.size());
+
+        while (windowCount > 0 && windowClock - windowTimes[static_cast<size_t> (windowHead)]
+                                      >= static_cast<unsigned int> (levelWindowSize))
+        {
+            if (++windowHead == capacity)
+                windowHead = 0;
+            --windowCount;
+        }
+    }
+
+    void resetLevelWindow() noexcept
+    {
+        windowHead      = 0;
+        windowCount     = 0;
+        windowClock     = 0;
+        levelMeanSquare = meanSquare;
+    }
+
     //==========================================================================
     // Inline dB → linear conversion (no JUCE dependency)
     //==========================================================================
@@ -298,11 +429,18 @@ private:
 
     double sampleRateVal  = 44100.0;
 
-    // RMS detector state (10ms window)
-    float rmsAccum  = 0.0f;
-    int   rmsCount  = 0;
-    int   rmsWindowSize = 441;    // updated in prepare()
-    float rmsCurrent = 0.0f;
+    // Sliding RMS detector state (10ms window of squared samples)
+    std::vector<float> rmsSquares;
+    double rmsSum        = 0.0;
+    int    rmsPos        = 0;
+    int    rmsWindowSize = 441;    // updated in prepare()
+    float  meanSquare    = 0.0f;   // current window mean of the squares
+
+    // Level the gain computer follows: meanSquare, or its max over the
+    // lookahead window; levelDb caches its dB value for levelDbSquare
+    float levelMeanSquare = 0.0f;
+    float levelDbSquare   = 0.0f;
+    float levelDb         = -120.0f;
 
     // Peak detector state (50ms crest window)
     float peakAccum  = 0.0f;
@@ -315,7 +453,107 @@ private:
     float crestSmoothed = 1.0f;
     float crestSmoothCoeff = 0.9f;  // updated in prepare()
 
+    // Lookahead level window (setLevelWindow); ring buffers sized in prepare()
+    std::vector<float>        windowValues;     // mean squares
+    std::vector<unsigned int> windowTimes;
+    int          levelWindowSize = 0;    // 0 = off
+    int          windowHead      = 0;
+    int          windowCount     = 0;
+    unsigned int windowClock     = 0;    // wraps; only differences are used
+
     // Gain computer state
     float gainDb       = 0.0f;   // instantaneous (unused — kept for clarity)
     float gainSmoothed = 0.0f;   // smoothed gain in dB (applied to audio)
 };
+
+//==============================================================================
+// LookaheadDelay
+//
+// Whole-sample delay for the compressor's audio path, in place and a block at
+// a time: each block is copied into a ring buffer and the delayed block is
+// copied back out (two memcpy-sized runs per channel at most).
+//
+// prepare() sizes the ring for the longest delay and block (message thread);
+// setDelay() and process() never allocate. The ring always holds the last
+// maxDelay samples, so setDelay() only moves the read tap.
+//==============================================================================
+class LookaheadDelay
+{
+public:
+    static constexpr int kMaxChannels = 2;
+
+    void prepare (int maxDelaySamples, int maxBlockSize)
+    {
+        maxDelay = std::max (maxDelaySamples, 0);
+        ringSize = maxDelay + std::max (maxBlockSize, 1);
+
+        for (auto& ring : rings)
+            ring.assign (static_cast<size_t> (ringSize), 0.0f);
+
+        delay = std::min (delay, maxDelay);
+        writePos = 0;
+    }
+
+    // Keeps the ring: the output jumps straight to the signal at the new tap
+    void setDelay (int samples) noexcept
+    {
+        delay = std::clamp (samples, 0, maxDelay);
+    }
+
+    int getDelay() const noexcept { return delay; }
+
+    void reset() noexcept
+    {
+        for (auto& ring : rings)
+            std::fill (ring.begin(), ring.end(), 0.0f);
+
+        writePos = 0;
+    }
+
+    // numSamples must not exceed prepare()'s maxBlockSize
+    void process (float* const* channels, int numChannels, int numSamples) noexcept
+    {
+        if (numSamples <= 0)
+            return;
+
+        int readPos = writePos - delay;
+        if (readPos < 0)
+            readPos += ringSize;
+
+        // Written at every delay (0 too), so a later setDelay() has history
+        for (int ch = 0; ch < std::min (numChannels, kMaxChannels); ++ch)
+        {
+            float* ring = rings[ch].data();
+            float* data = channels[ch];
+
+            copyIntoRing (ring, writePos, data, numSamples);
+            if (delay > 0)
+                copyFromRing (ring, readPos, data, numSamples);
+        }
+
+        writePos += numSamples;
+        if (writePos >= ringSize)
+            writePos -= ringSize;
+    }
+
+private:
+    void copyIntoRing (float* ring, int pos, const float* src, int count) const noexcept
+    {
+        const int first = std::min (count, ringSize - pos);
+        std::copy_n (src, first, ring + pos);
+        std::copy_n (src + first, count - first, ring);
+    }
+
+    void copyFromRing (const float* ring, int pos, float* dest, int count) const noexcept
+    {
+        const int first = std::min (count, ringSize - pos);
+        std::copy_n (ring + pos, first, dest);
+        std::copy_n (ring, count - first, dest + first);
+    }
+
+    std::vector<float> rings[kMaxChannels];
+    int ringSize = 1;
+    int maxDelay = 0;
+    int delay    = 0;
+    int writePos = 0;
+};
@@ -0,0 +1,307 @@
+#pragma once
+
+// Self-contained: uses only standard C++ math and the pfs::fastmath lane
+// operations. No JUCE headers needed — keeps MultibandCrossover.h
+// independently compilable, like ADAASaturator.h and DynamicsEngine.h.
+#include <pfs/FastMath.h>
+
+#include <algorithm>
+#include <cmath>
+
+//==============================================================================
+// MultibandCrossover
+//
+// Phase-coherent Linkwitz-Riley (LR4, 24 dB/oct) split into 3 or 4 bands.
+//
+// Each LR4 section is two cascaded Butterworth state-variable filters. A
+// band is the path through the crossover tree, plus an allpass at every
+// crossover it does not pass through, so all bands carry the same phase and
+// their sum is an allpass (flat magnitude, no notches at the crossovers):
+//
+//   4 bands (f1 < f2 < f3):
+//     band 0:  LP4(f2) LP4(f1) AP(f3)     band 2:  HP4(f2) LP4(f3) AP(f1)
+//     band 1:  LP4(f2) HP4(f1) AP(f3)     band 3:  HP4(f2) HP4(f3) AP(f1)
+//
+//   3 bands (f1 < f2):
+//     band 0:  LP4(f1) AP(f2)
+//     band 1:  HP4(f1) LP4(f2)
+//     band 2:  HP4(f1) HP4(f2)
+//
+//   AP(f) = LP4(f) + HP4(f), a second-order allpass with Q = 1/sqrt(2).
+//
+// Every band is then the same chain of (up to) five SVF sections, each one
+// reading out lowpass, highpass, allpass or straight through, with its own
+// cutoff. Bands are therefore the four lanes of one SIMD loop: the shared
+// LP4(f2) / HP4(f1) sections are computed once per lane rather than shared,
+// which costs nothing extra on 4-wide SSE/NEON.
+//
+// SVF: Zavalishin's TPT form (stable under cutoff modulation), with
+//   hp = (x - (k + g) s1 - s2) / (1 + k g + g^2),  bp = g hp + s1,
+//   lp = g bp + s2,  and x = lp + k bp + hp exactly.
+//
+// setCrossovers() only recomputes coefficients when a value moves, and
+// process() never allocates.
+//==============================================================================
+class MultibandCrossover
+{
+public:
+    static constexpr int kMaxBands    = 4;
+    static constexpr int kMaxChannels = 2;
+
+    MultibandCrossover() = default;
+
+    //==========================================================================
+    // prepare — call from PluginProcessor::prepareToPlay()
+    //==========================================================================
+    void prepare (double sampleRate) noexcept
+    {
+        sampleRateVal = sampleRate;
+        numBands      = 0;
+        setCrossovers (kMaxBands, 120.0f, 1000.0f, 5000.0f);
+        reset();
+    }
+
+    //==========================================================================
+    // reset — clears the filter state of both channels
+    //==========================================================================
+    void reset() noexcept
+    {
+        std::fill (&s1[0][0][0], &s1[0][0][0] + kMaxChannels * kMaxStages * kLanes, 0.0f);
+        std::fill (&s2[0][0][0], &s2[0][0][0] + kMaxChannels * kMaxStages * kLanes, 0.0f);
+    }
+
+    //==========================================================================
+    // setCrossovers
+    //
+    //   bands   — 3 or 4
+    //   lowHz   — lowest crossover (both layouts)
+    //   midHz   — middle crossover (4 bands only)
+    //   highHz  — highest crossover (both layouts)
+    //
+    //   The frequencies are expected in ascending order and are clamped below
+    //   0.45 fs. Changing the band count resets the state, since each lane's
+    //   sections change meaning.
+    //==========================================================================
+    void setCrossovers (int bands, float lowHz, float midHz, float highHz) noexcept
+    {
+        bands = std::clamp (bands, 3, kMaxBands);
+
+        if (bands == numBands && lowHz == cachedLow && midHz == cachedMid && highHz == cachedHigh)
+            return;
+
+        const bool layoutChanged = bands != numBands;
+        numBands   = bands;
+        cachedLow  = lowHz;
+        cachedMid  = midHz;
+        cachedHigh = highHz;
+
+        if (numBands == 4)
+        {
+            numStages = 5;
+            setLane (0, { Lowpass, Lowpass, Lowpass,  Lowpass,  Allpass }, { midHz, midHz, lowHz,  lowHz,  highHz });
+            setLane (1, { Lowpass, Lowpass, Highpass, Highpass, Allpass }, { midHz, midHz, lowHz,  lowHz,  highHz });
+            setLane (2, { Highpass, Highpass, Lowpass,  Lowpass,  Allpass }, { midHz, midHz, highHz, highHz, lowHz });
+            setLane (3, { Highpass, Highpass, Highpass, Highpass, Allpass }, { midHz, midHz, highHz, highHz, lowHz });
+        }
+        else
+        {
+            numStages = 4;
+            // Fifth section unused; lane 3 carries no band
+            setLane (0, { Lowpass,  Lowpass,  Allpass,  Through,  Through }, { lowHz, lowHz, highHz, highHz, highHz });
+            setLane (1, { Highpass, Highpass, Lowpass,  Lowpass,  Through }, { lowHz, lowHz, highHz, highHz, highHz });
+            setLane (2, { Highpass, Highpass, Highpass, Highpass, Through }, { lowHz, lowHz, highHz, highHz, highHz });
+            setLane (3, { Through,  Through,  Through,  Through,  Through }, { lowHz, lowHz, highHz, highHz, highHz });
+        }
+
+        if (layoutChanged)
+            reset();
+    }
+
+    int getNumBands() const noexcept { return numBands; }
+
+    //==========================================================================
+    // process — splits a block into getNumBands() bands per channel
+    //
+    //   input        — numChannels (1 or 2) channels of numSamples
+    //   numChannels  — each channel has its own filter state
+    //   bandChannels — band b of channel ch goes to bandChannels[b * 2 + ch]
+    //                  (must not alias input)
+    //
+    //   Both channels run in the same loop: the sections of one sample depend
+    //   on each other, so the second channel's chain fills the latency of the
+    //   first.
+    //==========================================================================
+    void process (const float* const* input, int numChannels,
+                  float* const* bandChannels, int numSamples) noexcept
+    {
+        if (numChannels >= 2)
+        {
+            if (numStages == 5) runLanes<5, 2> (input, bandChannels, numSamples);
+            else                runLanes<4, 2> (input, bandChannels, numSamples);
+        }
+        else
+        {
+            if (numStages == 5) runLanes<5, 1> (input, bandChannels, numSamples);
+            else                runLanes<4, 1> (input, bandChannels, numSamples);
+        }
+    }
+
+private:
+    static constexpr int kLanes     = 4;  // one band per lane
+    static constexpr int kMaxStages = 5;
+
+    // sqrt(2): Butterworth damping, LR4 = two of these in cascade
+    static constexpr float kDamping = 1.41421356f;
+
+    // Four lanes wide on every backend: SSE2 (also under AVX2) and NEON, else
+    // a plain four-float loop
+  #if PFS_SIMD_SSE2
+    using LaneOps = pfs::fastmath::detail::Sse2Ops;
+  #elif PFS_SIMD_NEON
+    using LaneOps = pfs::fastmath::detail::NeonOps;
+  #else
+    struct LaneOps
+    {
+        struct Float
+        {
+            float v[kLanes];
+        };
+
+        static Float set (float s) noexcept { Float r; std::fill_n (r.v, kLanes, s); return r; }
+        static Float load (const float* p) noexcept { Float r; std::copy_n (p, kLanes, r.v); return r; }
+        static void store (float* p, Float a) noexcept { std::copy_n (a.v, kLanes, p); }
+        static Float add (Float a, Float b) noexcept { for (int l = 0; l < kLanes; ++l) a.v[l] += b.v[l]; return a; }
+        static Float sub (Float a, Float b) noexcept { for (int l = 0; l < kLanes; ++l) a.v[l] -= b.v[l]; return a; }
+        static Float mul (Float a, Float b) noexcept { for (int l = 0; l < kLanes; ++l) a.v[l] *= b.v[l]; return a; }
+    };
+  #endif
+
+    //==========================================================================
+    // Section read-outs: out = mixLp lp + mixBp bp + mixHp hp
+    //==========================================================================
+    enum Response
+    {
+        Lowpass,   // lp
+        Highpass,  // hp
+        Allpass,   // lp - k bp + hp
+        Through    // lp + k bp + hp = x
+    };
+
+    void setLane (int lane, const Response (&responses)[kMaxStages], const float (&freqs)[kMaxStages]) noexcept
+    {
+        const double maxHz = 0.45 * sampleRateVal;
+        const double pi    = 3.14159265358979323846;
+
+        for (int k = 0; k < kMaxStages; ++k)
+        {
+            const double hz = std::clamp (static_cast<double> (freqs[k]), 10.0, maxHz);
+            const float  g  = static_cast<float> (std::tan (pi * hz / sampleRateVal));
+
+            coefG[k][lane]      = g;
+            coefKPlusG[k][lane] = kDamping + g;
+            coefH[k][lane]      = 1.0f / (1.0f + kDamping * g + g * g);
+
+            const Response r = responses[k];
+            mixLp[k][lane] = r == Highpass ? 0.0f : 1.0f;
+            mixHp[k][lane] = r == Lowpass  ? 0.0f : 1.0f;
+            mixBp[k][lane] = r == Allpass  ? -kDamping
+                           : r == Through  ?  kDamping
+                                           :  0.0f;
+        }
+    }
+
+    //==========================================================================
+    // Count sections per lane over the block for Channels channels, state and
+    // coefficients held in registers (or at worst in L1) for the whole loop
+    //==========================================================================
+    template <int Count, int Channels>
+    void runLanes (const float* const* input, float* const* bandChannels, int numSamples) noexcept
+    {
+        using Ops = LaneOps;
+        using V   = Ops::Float;
+
+        V g[kMaxStages], kg[kMaxStages], h[kMaxStages];
+        V mL[kMaxStages], mB[kMaxStages], mH[kMaxStages];
+        V z1[kMaxChannels][kMaxStages], z2[kMaxChannels][kMaxStages];
+
+        for (int k = 0; k < Count; ++k)
+        {
+            g[k]  = Ops::load (coefG[k]);
+            kg[k] = Ops::load (coefKPlusG[k]);
+            h[k]  = Ops::load (coefH[k]);
+            mL[k] = Ops::load (mixLp[k]);
+            mB[k] = Ops::load (mixBp[k]);
+            mH[k] = Ops::load (mixHp[k]);
+
+            for (int ch = 0; ch < Channels; ++ch)
+            {
+                z1[ch][k] = Ops::load (s1[ch][k]);
+                z2[ch][k] = Ops::load (s2[ch][k]);
+            }
+        }
+
+        alignas (16) float lanes[kLanes];
+        for (int n = 0; n < numSamples; ++n)
+        {
+            V v[kMaxChannels];
+            for (int ch = 0; ch < Channels; ++ch)
+                v[ch] = Ops::set (input[ch][n]);
+
+            for (int k = 0; k < Count; ++k)
+            {
+                for (int ch = 0; ch < Channels; ++ch)
+                {
+                    const V hp = Ops::mul (Ops::sub (Ops::sub (v[ch], Ops::mul (kg[k], z1[ch][k])), z2[ch][k]), h[k]);
+                    const V gh = Ops::mul (g[k], hp);
+                    const V bp = Ops::add (gh, z1[ch][k]);
+                    const V gb = Ops::mul (g[k], bp);
+                    const V lp = Ops::add (gb, z2[ch][k]);
+                    z1[ch][k] = Ops::add (gh, bp);
+                    z2[ch][k] = Ops::add (gb, lp);
+
+                    v[ch] = Ops::add (Ops::add (Ops::mul (mL[k], lp), Ops::mul (mB[k], bp)), Ops::mul (mH[k], hp));
+                }
+            }
+
+            for (int ch = 0; ch < Channels; ++ch)
+            {
+                Ops::store (lanes, v[ch]);
+                for (int b = 0; b < numBands; ++b)
+                    bandChannels[b * kMaxChannels + ch][n] = lanes[b];
+            }
+        }
+
+        for (int k = 0; k < Count; ++k)
+        {
+            for (int ch = 0; ch < Channels; ++ch)
+            {
+                Ops::store (s1[ch][k], z1[ch][k]);
+                Ops::store (s2[ch][k], z2[ch][k]);
+            }
+        }
+    }
+
+    //==========================================================================
+    // State
+    //==========================================================================
+
+    double sampleRateVal = 44100.0;
+    int    numBands      = 0;
+    int    numStages     = kMaxStages;
+
+    float cachedLow  = 0.0f;
+    float cachedMid  = 0.0f;
+    float cachedHigh = 0.0f;
+
+    // Per-section coefficients, one value per lane
+    alignas (16) float coefG[kMaxStages][kLanes]      {};
+    alignas (16) float coefKPlusG[kMaxStages][kLanes] {};
+    alignas (16) float coefH[kMaxStages][kLanes]      {};
+    alignas (16) float mixLp[kMaxStages][kLanes]      {};
+    alignas (16) float mixBp[kMaxStages][kLanes]      {};
+    alignas (16) float mixHp[kMaxStages][kLanes]      {};
+
+    // Per-channel integrator state, one value per lane
+    alignas (16) float s1[kMaxChannels][kMaxStages][kLanes] {};
+    alignas (16) float s2[kMaxChannels][kMaxStages][kLanes] {};
+};
@@ -4,6 +4,42 @@
 // Binary resource data — generated by juce_add_binary_data in CMakeLists.txt
 #include <BinaryData.h>
 
+//==============================================================================
+namespace
+{
+    // Per-stage CPU breakdown for the UI's "cpu_profile" event. Loads are
+    // percent of the buffer deadline (numSamples / sampleRate); "other" is
+    // processBlock time outside every instrumented stage.
+    juce::var makeProfileEvent (const pfs::StageProfiler& profiler, const pfs::ProfileSummary& summary)
+    {
+        juce::Array<juce::var> stages;
+        double stagedNs = 0.0;
+
+        for (int stage = 0; stage < profiler.getNumStages(); ++stage)
+        {
+            auto entry = std::make_unique<juce::DynamicObject>();
+            entry->setProperty ("name", profiler.getStageName (stage));
+            entry->setProperty ("load", summary.getStageLoad (stage) * 100.0);
+            entry->setProperty ("us",   summary.meanStageNs[static_cast<size_t> (stage)] * 1.0e-3);
+            stages.add (juce::var (entry.release()));
+
+            stagedNs += summary.meanStageNs[static_cast<size_t> (stage)];
+        }
+
+        auto data = std::make_unique<juce::DynamicObject>();
+        data->setProperty ("blocks",     summary.numBlocks);
+        data->setProperty ("dropped",    summary.numDropped);
+        data->setProperty ("deadlineUs", summary.meanDeadlineNs * 1.0e-3);
+        data->setProperty ("load",       summary.getLoad() * 100.0);
+        data->setProperty ("peakLoad",   summary.peakBlockLoad * 100.0);
+        data->setProperty ("otherLoad",  summary.meanDeadlineNs > 0.0
+                                             ? std::max (0.0, summary.meanBlockNs - stagedNs) / summary.meanDeadlineNs * 100.0
+                                             : 0.0);
+        data->setProperty ("stages",     stages);
+        return juce::var (data.release());
+    }
+}
+
 //==============================================================================
 NBS_DynaDriveAudioProcessorEditor::NBS_DynaDriveAudioProcessorEditor (
     NBS_DynaDriveAudioProcessor& p)
@@ -209,7 +245,9 @@ NBS_DynaDriveAudioProcessorEditor::NBS_DynaDriveAudioProcessorEditor (
     getConstrainer()->setFixedAspectRatio (
         static_cast<double> (kDefaultWidth) / static_cast<double> (isExpanded ? kExpandedHeight : kCollapsedHeight));
 
-    // Start meter update timer at ~30 Hz
+    // Start meter update timer at ~30 Hz (also drains the stage profiler).
+    // Frames queued while the editor was closed are stale.
+    audioProcessor.meterTelemetry.clear();
     startTimerHz (30);
 }
 
@@ -223,20 +261,31 @@ NBS_DynaDriveAudioProcessorEditor::~NBS_DynaDriveAudioProcessorEditor()
 //==============================================================================
 void NBS_DynaDriveAudioProcessorEditor::timerCallback()
 {
-    // Read peak levels from processor (atomic, lock-free) and reset for next cycle
-    float inL  = audioProcessor.meterInL.exchange  (0.0f, std::memory_order_relaxed);
-    float inR  = audioProcessor.meterInR.exchange  (0.0f, std::memory_order_relaxed);
-    float outL = audioProcessor.meterOutL.exchange (0.0f, std::memory_order_relaxed);
-    float outR = audioProcessor.meterOutR.exchange (0.0f, std::memory_order_relaxed);
+    // Fold every meter frame published since the last tick: hold the peaks,
+    // keep the deepest gain reduction (dB, negative = compression, 0 = none)
+    float inL = 0.0f, inR = 0.0f, outL = 0.0f, outR = 0.0f;
+    float grMin = 0.0f;
+
+    const int numFrames = audioProcessor.meterTelemetry.drain ([&] (const NBS_DynaDriveAudioProcessor::MeterFrame& frame)
+    {
+        inL   = std::max (inL,  frame.inL);
+        inR   = std::max (inR,  frame.inR);
+        outL  = std::max (outL, frame.outL);
+        outR  = std::max (outR, frame.outR);
+        grMin = std::min (grMin, frame.gainReductionDb);
+    });
+
+    // No blocks since the last tick (transport stopped): GR holds its last value
+    if (numFrames > 0)
+        lastGainReductionDb = grMin;
+
+    const float gr = lastGainReductionDb;
 
     // Convert linear amplitude (0.0–1.0+) to percentage (0–100) for JS meter bars
     auto toPct = [] (float linear) {
         return std::clamp (linear * 100.0f, 0.0f, 100.0f);
     };
 
-    // Read gain reduction (dB, negative = compression, 0 = none)
-    float gr = audioProcessor.meterGR.load (std::memory_order_relaxed);
-
     auto meterData = std::make_unique<juce::DynamicObject>();
     meterData->setProperty ("inL",  toPct (inL));
     meterData->setProperty ("inR",  toPct (inR));
@@ -245,6 +294,14 @@ void NBS_DynaDriveAudioProcessorEditor::timerCallback()
     meterData->setProperty ("gr",   gr);
 
     webView->emitEventIfBrowserIsVisible ("meter_update", juce::var (meterData.release()));
+
+    // Per-stage CPU meter — only when built with -DPFS_PROFILING=ON
+    if constexpr (pfs::StageProfiler::isEnabled())
+    {
+        const auto summary = audioProcessor.profiler.drain();
+        if (summary.numBlocks > 0)
+            webView->emitEventIfBrowserIsVisible ("cpu_profile", makeProfileEvent (audioProcessor.profiler, summary));
+    }
 }
 
 //==============================================================================
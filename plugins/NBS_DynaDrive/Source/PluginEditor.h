@@ -30,7 +30,8 @@ public:
     void resized() override;
 
 private:
-    // juce::Timer override — sends meter levels to WebView at ~30 Hz
+    // juce::Timer override — sends meter levels (and, with PFS_PROFILING,
+    // the per-stage CPU breakdown) to WebView at ~30 Hz
     void timerCallback() override;
 
     //==========================================================================
@@ -152,6 +153,9 @@ private:
     // Window size state (tracks collapsed/expanded)
     bool isExpanded = false;
 
+    // GR shown while no meter frames arrive (timer thread only)
+    float lastGainReductionDb = 0.0f;
+
     static constexpr int kDefaultWidth    = 740;
     static constexpr int kCollapsedHeight = 418;   // 400 main + 18 toggle bar
     static constexpr int kExpandedHeight  = 548;   // 400 main + 18 toggle + 130 advanced
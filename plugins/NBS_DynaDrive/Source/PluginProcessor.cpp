@@ -29,6 +29,22 @@ juce::AudioProcessorValueTreeState::ParameterLayout NBS_DynaDriveAudioProcessor:
         "Comp Enable",
         true));
 
+    // oversampling — factor around the saturation: 1x, 2x, 4x, 8x (default 4x)
+    //   1x/2x switch the shaper to second-order ADAA; latency follows the factor
+    params.push_back (std::make_unique<juce::AudioParameterChoice> (
+        juce::ParameterID { "oversampling", 1 },
+        "Oversampling",
+        juce::StringArray { "1x", "2x", "4x", "8x" },
+        2));
+
+    // os_filter — oversampling halfbands: linear-phase FIR (default) or
+    //   low-latency polyphase IIR (under 2 samples at 2x, for live monitoring)
+    params.push_back (std::make_unique<juce::AudioParameterChoice> (
+        juce::ParameterID { "os_filter", 1 },
+        "OS Filter",
+        juce::StringArray { "Linear Phase", "Low Latency" },
+        0));
+
     // --- Saturation Section ---
 
     // drive — primary saturation input drive (0–100 %)
@@ -192,6 +208,37 @@ juce::AudioProcessorValueTreeState::ParameterLayout NBS_DynaDriveAudioProcessor:
         100.0f,
         "ms"));
 
+    // lookahead — compressor lookahead (0–10 ms): delays the audio so the
+    //   detector sees transients early; adds to the reported latency. Only
+    //   the single-band compressor uses it: with comp_enable off, or in bands
+    //   mode ("bands" not Off, where the band compressors detect in-band),
+    //   it is 0 and adds no latency.
+    params.push_back (std::make_unique<juce::AudioParameterFloat> (
+        juce::ParameterID { "lookahead", 1 },
+        "Lookahead",
+        juce::NormalisableRange<float> (0.0f, 10.0f, 0.1f, 1.0f),
+        0.0f,
+        "ms"));
+
+    // --- Sidechain ---
+
+    // sc_external — key the compressor from the sidechain input bus (falls
+    //   back to the main input while the host leaves the bus disconnected;
+    //   multiband bands always detect their own band)
+    params.push_back (std::make_unique<juce::AudioParameterBool> (
+        juce::ParameterID { "sc_external", 1 },
+        "External Sidechain",
+        false));
+
+    // sc_hpf — detector key high-pass (20–500 Hz, 20 Hz = off)
+    // Skew 0.4: more travel in the 20–150 Hz range where kick/bass pumping lives
+    params.push_back (std::make_unique<juce::AudioParameterFloat> (
+        juce::ParameterID { "sc_hpf", 1 },
+        "SC High-Pass",
+        juce::NormalisableRange<float> (20.0f, 500.0f, 1.0f, 0.4f),
+        20.0f,
+        "Hz"));
+
     // --- Advanced Panel: Post-Dynamics Tilt ---
 
     // dyn_tilt_freq — post-dynamics tilt filter pivot frequency (100–10000 Hz)
@@ -236,6 +283,79 @@ juce::AudioProcessorValueTreeState::ParameterLayout NBS_DynaDriveAudioProcessor:
         20.0f,
         "%"));
 
+    // --- Multiband ---
+
+    // bands — Off (single band) or a phase-coherent Linkwitz-Riley split into
+    //   3 or 4 bands, each with its own drive, harmonics and compression
+    //   (mid_drive / side_drive do not apply; h_curve and the dynamics detail
+    //   are shared)
+    params.push_back (std::make_unique<juce::AudioParameterChoice> (
+        juce::ParameterID { "bands", 1 },
+        "Bands",
+        juce::StringArray { "Off", "3 Bands", "4 Bands" },
+        0));
+
+    // xover_low / xover_mid / xover_high — crossover frequencies
+    //   3 bands split at low and high; 4 bands use all three
+    params.push_back (std::make_unique<juce::AudioParameterFloat> (
+        juce::ParameterID { "xover_low", 1 },
+        "Crossover Low",
+        juce::NormalisableRange<float> (30.0f, 300.0f, 1.0f, 0.5f),
+        120.0f,
+        "Hz"));
+
+    params.push_back (std::make_unique<juce::AudioParameterFloat> (
+        juce::ParameterID { "xover_mid", 1 },
+        "Crossover Mid",
+        juce::NormalisableRange<float> (300.0f, 3000.0f, 1.0f, 0.5f),
+        1000.0f,
+        "Hz"));
+
+    params.push_back (std::make_unique<juce::AudioParameterFloat> (
+        juce::ParameterID { "xover_high", 1 },
+        "Crossover High",
+        juce::NormalisableRange<float> (3000.0f, 16000.0f, 1.0f, 0.5f),
+        5000.0f,
+        "Hz"));
+
+    // bandN_drive / bandN_even / bandN_odd — per-band saturation, same ranges
+    //   and skews as drive / even / odd; 0 % drive leaves the band linear
+    //   (no shaper, no oversampling of its own)
+    // bandN_comp — per-band downward compression amount (in place of down)
+    for (int band = 1; band <= kMaxBands; ++band)
+    {
+        const juce::String id   = "band" + juce::String (band);
+        const juce::String name = "Band " + juce::String (band);
+
+        params.push_back (std::make_unique<juce::AudioParameterFloat> (
+            juce::ParameterID { id + "_drive", 1 },
+            name + " Drive",
+            juce::NormalisableRange<float> (0.0f, 100.0f, 0.1f, 0.6f),
+            20.0f,
+            "%"));
+
+        params.push_back (std::make_unique<juce::AudioParameterFloat> (
+            juce::ParameterID { id + "_even", 1 },
+            name + " Even",
+            juce::NormalisableRange<float> (0.0f, 100.0f, 0.1f, 0.5f),
+            0.0f,
+            "%"));
+
+        params.push_back (std::make_unique<juce::AudioParameterFloat> (
+            juce::ParameterID { id + "_odd", 1 },
+            name + " Odd",
+            juce::NormalisableRange<float> (0.0f, 100.0f, 0.1f, 0.5f),
+            0.0f,
+            "%"));
+
+        params.push_back (std::make_unique<juce::AudioParameterFloat> (
+            juce::ParameterID { id + "_comp", 1 },
+            name + " Comp",
+            juce::NormalisableRange<float> (0.0f, 100.0f, 0.1f, 1.0f),
+            50.0f,
+            "%"));
+    }
+
     return { params.begin(), params.end() };
 }
 
@@ -245,14 +365,40 @@ juce::AudioProcessorValueTreeState::ParameterLayout NBS_DynaDriveAudioProcessor:
 
 NBS_DynaDriveAudioProcessor::NBS_DynaDriveAudioProcessor()
     : AudioProcessor (BusesProperties()
-                        .withInput  ("Input",  juce::AudioChannelSet::stereo(), true)
-                        .withOutput ("Output", juce::AudioChannelSet::stereo(), true))
+                        .withInput  ("Input",     juce::AudioChannelSet::stereo(), true)
+                        .withOutput ("Output",    juce::AudioChannelSet::stereo(), true)
+                        .withInput  ("Sidechain", juce::AudioChannelSet::stereo(), false))
     , parameters (*this, nullptr, "Parameters", createParameterLayout())
 {
+    parameters.addParameterListener ("oversampling", &oversamplingRebuilder);
+    parameters.addParameterListener ("os_filter", &oversamplingRebuilder);
+    parameters.addParameterListener ("lookahead", &oversamplingRebuilder);
+    parameters.addParameterListener ("comp_enable", &oversamplingRebuilder);
+    parameters.addParameterListener ("bands", &oversamplingRebuilder);
+    oversamplingRebuilder.startTimer (50);
+
+    // Per-band parameters are looked up once (processBlock() must not build
+    // the ID strings)
+    for (int b = 0; b < kMaxBands; ++b)
+    {
+        auto& band = bands[static_cast<size_t> (b)];
+        const juce::String id = "band" + juce::String (b + 1);
+
+        band.driveParam = parameters.getRawParameterValue (id + "_drive");
+        band.evenParam  = parameters.getRawParameterValue (id + "_even");
+        band.oddParam   = parameters.getRawParameterValue (id + "_odd");
+        band.compParam  = parameters.getRawParameterValue (id + "_comp");
+    }
 }
 
 NBS_DynaDriveAudioProcessor::~NBS_DynaDriveAudioProcessor()
 {
+    oversamplingRebuilder.stopTimer();
+    parameters.removeParameterListener ("oversampling", &oversamplingRebuilder);
+    parameters.removeParameterListener ("os_filter", &oversamplingRebuilder);
+    parameters.removeParameterListener ("lookahead", &oversamplingRebuilder);
+    parameters.removeParameterListener ("comp_enable", &oversamplingRebuilder);
+    parameters.removeParameterListener ("bands", &oversamplingRebuilder);
 }
 
 //==============================================================================
@@ -274,32 +420,17 @@ void NBS_DynaDriveAudioProcessor::prepareToPlay (double sampleRate, int samplesP
     inputGain.reset();
     inputGain.setGainLinear (1.0f);
 
-    // 2x oversampling — prepare before ADAA saturator
-    oversampling.initProcessing (static_cast<size_t> (samplesPerBlock));
-    oversampling.reset();
-
-    // ADAA saturator — handles h_curve blend, even/odd harmonics, DC blocking
-    // Channel 0 = L (or Mid in M/S), Channel 1 = R (or Side in M/S)
-    // Prepared at 4x sample rate since it runs inside the oversampled block
-    adaaSaturator.prepare (sampleRate * 4.0);
-    adaaSaturator.reset();
-
     outputGain.prepare (processSpec);
     outputGain.reset();
     outputGain.setGainLinear (1.0f);
 
     dryWetMixer.prepare (processSpec);
     dryWetMixer.reset();
-
-    // Phase compensation: the 4x oversampling FIR filter introduces group delay.
-    // Tell the DryWetMixer so dry samples are delayed to match, preventing
-    // comb-filtering artefacts when mix < 100%.
-    const auto osLatency = static_cast<int> (oversampling.getLatencyInSamples());
-    dryWetMixer.setWetLatency (osLatency);
     dryWetMixer.setWetMixProportion (1.0f);
 
-    // Report total latency to the DAW for PDC (plugin delay compensation)
-    setLatencySamples (osLatency);
+    // Oversampler + ADAA saturator at the selected factor; also reports the
+    // latency to the DryWetMixer and the DAW
+    prepareOversampling (selectOversamplingOrder(), selectOversamplingFilter());
 
     //--------------------------------------------------------------------------
     // Phase 4.2: Tilt filters
@@ -334,15 +465,46 @@ void NBS_DynaDriveAudioProcessor::prepareToPlay (double sampleRate, int samplesP
     // Phase 4.3: Dynamics Engines
     //--------------------------------------------------------------------------
 
-    stereoEngine.prepare (sampleRate);
+    // Level windows and the delay line are sized for the longest lookahead;
+    // prepareLookahead() then applies the selected one and reports the
+    // latency
+    maxLookaheadSamples = std::min (static_cast<int> (std::ceil (kMaxLookaheadMs * 0.001 * sampleRate)),
+                                    kMaxWetLatencySamples - kMaxOversamplingLatency);
+
+    stereoEngine.prepare (sampleRate, maxLookaheadSamples + 1);
     stereoEngine.reset();
 
-    midEngine.prepare (sampleRate);
+    midEngine.prepare (sampleRate, maxLookaheadSamples + 1);
     midEngine.reset();
 
-    sideEngine.prepare (sampleRate);
+    sideEngine.prepare (sampleRate, maxLookaheadSamples + 1);
     sideEngine.reset();
 
+    lookaheadDelay.prepare (maxLookaheadSamples, samplesPerBlock);
+    lookaheadDelay.reset();
+    prepareLookahead (selectLookaheadSamples());
+
+    // Detector key buffer and sidechain high-pass
+    detectorKey.setSize (2, samplesPerBlock);
+    for (auto& state : sidechainHpf)
+        state.reset();
+    cachedSidechainHpfFreq = 0.0f;
+
+    //--------------------------------------------------------------------------
+    // Multiband: crossover, per-band engines and scratch buffers (the band
+    // oversamplers and saturators are set up in prepareOversampling())
+    //--------------------------------------------------------------------------
+
+    crossover.prepare (sampleRate);
+    bandBuffer.setSize (kMaxBands * 2, samplesPerBlock);
+    bandLinear.setSize (2, samplesPerBlock << pfs::Oversampler::kMaxOrder);
+
+    for (auto& band : bands)
+        band.engine.prepare (sampleRate);
+
+    resetMultiband();
+    activeBandCount = 0;
+
     //--------------------------------------------------------------------------
     // Parameter smoothers — 5 ms ramp at current sample rate
     //--------------------------------------------------------------------------
@@ -368,6 +530,14 @@ void NBS_DynaDriveAudioProcessor::prepareToPlay (double sampleRate, int samplesP
     msSmoother.reset (sampleRate, 0.010);
     msBlendBuffer.resize (static_cast<size_t> (samplesPerBlock));
 
+    // Multiband per-band saturation smoothers
+    for (auto& band : bands)
+    {
+        band.driveSmoother.reset (sampleRate, rampSeconds);
+        band.biasSmoother.reset  (sampleRate, rampSeconds);
+        band.oddSmoother.reset   (sampleRate, rampSeconds);
+    }
+
     // Seed all smoothers with current parameter values (no startup ramp)
     const float inputDb   = parameters.getRawParameterValue ("input")->load();
     const float outputDb  = parameters.getRawParameterValue ("output")->load();
@@ -401,15 +571,29 @@ void NBS_DynaDriveAudioProcessor::prepareToPlay (double sampleRate, int samplesP
     // M/S crossfade: seed from current parameter
     const float msInit = parameters.getRawParameterValue ("ms_enable")->load() > 0.5f ? 1.0f : 0.0f;
     msSmoother.setCurrentAndTargetValue (msInit);
+
+    for (auto& band : bands)
+    {
+        band.driveSmoother.setCurrentAndTargetValue (1.0f + (band.driveParam->load() / 100.0f) * 7.0f);
+        band.biasSmoother.setCurrentAndTargetValue  ((band.evenParam->load() / 100.0f) * 0.15f);
+        band.oddSmoother.setCurrentAndTargetValue   ((band.oddParam->load()  / 100.0f) * 0.05f);
+    }
 }
 
 void NBS_DynaDriveAudioProcessor::releaseResources()
 {
-    oversampling.reset();
+    oversampler.reset();
+
     adaaSaturator.reset();
     stereoEngine.reset();
     midEngine.reset();
     sideEngine.reset();
+    lookaheadDelay.reset();
+
+    for (auto& state : sidechainHpf)
+        state.reset();
+
+    resetMultiband();
 }
 
 bool NBS_DynaDriveAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts) const
@@ -420,9 +604,149 @@ bool NBS_DynaDriveAudioProcessor::isBusesLayoutSupported (const BusesLayout& lay
     if (layouts.getMainInputChannelSet() != juce::AudioChannelSet::stereo())
         return false;
 
+    // Sidechain: disabled, mono or stereo
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto sidechainSet = layouts.getChannelSet (true, 1);
+        if (! sidechainSet.isDisabled()
+            && sidechainSet != juce::AudioChannelSet::mono()
+            && sidechainSet != juce::AudioChannelSet::stereo())
+            return false;
+    }
+
     return true;
 }
 
+//==============================================================================
+// Oversampling factor
+//==============================================================================
+
+int NBS_DynaDriveAudioProcessor::selectOversamplingOrder() const
+{
+    return juce::jlimit (0, 3, juce::roundToInt (parameters.getRawParameterValue ("oversampling")->load()));
+}
+
+pfs::HalfbandFilter NBS_DynaDriveAudioProcessor::selectOversamplingFilter() const
+{
+    return parameters.getRawParameterValue ("os_filter")->load() > 0.5f ? pfs::HalfbandFilter::LowLatency
+                                                                       : pfs::HalfbandFilter::LinearPhase;
+}
+
+void NBS_DynaDriveAudioProcessor::prepareOversampling (int order, pfs::HalfbandFilter filter)
+{
+    oversampler.prepare (static_cast<int> (processSpec.numChannels), order, filter,
+                         static_cast<int> (processSpec.maximumBlockSize));
+    oversamplingOrder = order;
+
+    // ADAA saturator — handles h_curve blend, even/odd harmonics, DC blocking
+    // Channel 0 = L (or Mid in M/S), Channel 1 = R (or Side in M/S)
+    // Prepared at the oversampled rate since it runs inside the oversampled block
+    const double factor = static_cast<double> (oversampler.getFactor());
+    adaaSaturator.prepare (processSpec.sampleRate * factor);
+    adaaSaturator.reset();
+    useSecondOrderAdaa = order <= 1;
+
+    // Multiband: every band gets an up path and a saturator at the same
+    // factor, so the bands share the main oversampler's latency (band 0 runs
+    // on the main oversampler itself)
+    for (int b = 0; b < kMaxBands; ++b)
+    {
+        auto& band = bands[static_cast<size_t> (b)];
+        if (b > 0)
+            band.oversampler.prepare (static_cast<int> (processSpec.numChannels), order, filter,
+                                      static_cast<int> (processSpec.maximumBlockSize));
+        band.saturator.prepare (processSpec.sampleRate * factor);
+        band.saturating = false;
+        band.satMix = 0.0f;
+        std::fill (&band.linearHistory[0][0], &band.linearHistory[0][0] + 4, 0.0f);
+    }
+
+    reportLatency();
+}
+
+int NBS_DynaDriveAudioProcessor::selectLookaheadSamples() const
+{
+    // Nothing looks ahead with the compressor off, and the band compressors
+    // detect in-band, so neither pays for the delay
+    const bool compEnable = parameters.getRawParameterValue ("comp_enable")->load() > 0.5f;
+    const int  bandsChoice = juce::roundToInt (parameters.getRawParameterValue ("bands")->load());
+    if (! compEnable || bandsChoice != 0)
+        return 0;
+
+    const double ms = parameters.getRawParameterValue ("lookahead")->load();
+    return juce::jlimit (0, maxLookaheadSamples,
+                         juce::roundToInt (ms * 0.001 * processSpec.sampleRate));
+}
+
+void NBS_DynaDriveAudioProcessor::prepareLookahead (int samples)
+{
+    // Clamped to what prepareToPlay() sized the delay for. The ring keeps its
+    // history, so the audio jumps to the new tap without a gap.
+    lookaheadDelay.setDelay (samples);
+    lookaheadSamples = lookaheadDelay.getDelay();
+
+    // The window spans the delayed sample and everything up to the key's
+    // newest, so the level of a transient is held until it leaves the delay.
+    // At 0 ms it is one sample: the plain RMS detector.
+    const int window = lookaheadSamples + 1;
+    stereoEngine.setLevelWindow (window);
+    midEngine.setLevelWindow (window);
+    sideEngine.setLevelWindow (window);
+
+    reportLatency();
+}
+
+void NBS_DynaDriveAudioProcessor::reportLatency()
+{
+    // Phase compensation: the oversampling filters and the ADAA shaper both
+    // delay the wet path (the shaper by its group delay at the oversampled
+    // rate), and so does the compressor lookahead. The DryWetMixer delays the
+    // dry samples to match, preventing comb-filtering artefacts when mix < 100%.
+    const double factor = static_cast<double> (oversampler.getFactor());
+    const double adaaDelay = useSecondOrderAdaa ? ADAASaturator::kSecondOrderDelay
+                                                : ADAASaturator::kFirstOrderDelay;
+    const double wetLatency = oversampler.getLatencyInSamples() + adaaDelay / factor + lookaheadSamples;
+    jassert (wetLatency <= kMaxWetLatencySamples);
+
+    dryWetMixer.setWetLatency (static_cast<float> (wetLatency));
+    dryWetMixer.reset();
+
+    // Report total latency to the DAW for PDC (plugin delay compensation)
+    setLatencySamples (juce::roundToInt (wetLatency));
+}
+
+void NBS_DynaDriveAudioProcessor::rebuildOversampling()
+{
+    // Offline renders switch inside processBlock(); suspending here would drop
+    // blocks from the render. Before the first prepareToPlay() there is
+    // nothing to rebuild.
+    if (isNonRealtime() || oversamplingOrder < 0)
+        return;
+
+    // suspendProcessing() takes the callback lock, so processBlock() is not
+    // running while the oversampler reallocates or the lookahead delay and
+    // the dry/wet mixer move
+    suspendProcessing (true);
+    const int order = selectOversamplingOrder();
+    const auto filter = selectOversamplingFilter();
+    if (order != oversamplingOrder || filter != oversampler.getFilter())
+        prepareOversampling (order, filter);
+
+    const int lookahead = selectLookaheadSamples();
+    if (lookahead != lookaheadSamples)
+        prepareLookahead (lookahead);
+    suspendProcessing (false);
+}
+
+juce::dsp::AudioBlock<float> NBS_DynaDriveAudioProcessor::upsample (const juce::AudioBuffer<float>& buf) noexcept
+{
+    const int numSamples = buf.getNumSamples();
+    float* const* channels = oversampler.processUp (buf.getArrayOfReadPointers(), numSamples);
+
+    return { channels, static_cast<size_t> (oversampler.getNumChannels()),
+             static_cast<size_t> (numSamples * oversampler.getFactor()) };
+}
+
 //==============================================================================
 // Tilt Filter Coefficient Helpers
 //==============================================================================
@@ -487,7 +811,7 @@ void NBS_DynaDriveAudioProcessor::applyDynTilt (juce::AudioBuffer<float>& buf, f
 // Phase 4.3 Helper: runSaturation (stereo, AudioBlock)
 //
 //   Applies ADAA waveshaping to all channels of block.
-//   Works on oversampled AudioBlock directly.
+//   Works on oversampled AudioBlock directly; second-order ADAA at 1x/2x.
 //==============================================================================
 void NBS_DynaDriveAudioProcessor::runSaturation (juce::dsp::AudioBlock<float>& block,
                                                    float driveGain, float alpha,
@@ -501,8 +825,10 @@ void NBS_DynaDriveAudioProcessor::runSaturation (juce::dsp::AudioBlock<float>& b
         float* data = block.getChannelPointer (static_cast<size_t> (ch));
         const int adaaCh = (ch < 2) ? ch : 1;
 
-        for (int n = 0; n < numSamples; ++n)
-            data[n] = adaaSaturator.processSample (data[n], adaaCh, driveGain, alpha, bias, oddGain);
+        if (useSecondOrderAdaa)
+            adaaSaturator.processBlockSecondOrder (data, numSamples, adaaCh, driveGain, alpha, bias, oddGain);
+        else
+            adaaSaturator.processBlock (data, numSamples, adaaCh, driveGain, alpha, bias, oddGain);
     }
 }
 
@@ -517,23 +843,136 @@ void NBS_DynaDriveAudioProcessor::runSaturationMS (juce::dsp::AudioBlock<float>&
 {
     const int numSamples = static_cast<int> (block.getNumSamples());
 
-    if (block.getNumChannels() >= 2)
+    if (block.getNumChannels() < 2)
+        return;
+
+    if (useSecondOrderAdaa)
+    {
+        adaaSaturator.processBlockSecondOrder (block.getChannelPointer (0), numSamples, 0, midDrive,  alpha, bias, oddGain);
+        adaaSaturator.processBlockSecondOrder (block.getChannelPointer (1), numSamples, 1, sideDrive, alpha, bias, oddGain);
+    }
+    else
+    {
+        adaaSaturator.processBlock (block.getChannelPointer (0), numSamples, 0, midDrive,  alpha, bias, oddGain);
+        adaaSaturator.processBlock (block.getChannelPointer (1), numSamples, 1, sideDrive, alpha, bias, oddGain);
+    }
+}
+
+//==============================================================================
+// Dynamics stage (single band)
+//
+//   Key → lookahead delay → gain computed from the key, applied to the delayed
+//   audio → comp output volume. The delay runs even with the compressor off:
+//   it is 0 there once the rebuilder has run, and until then the audio still
+//   matches the latency the host was told.
+//==============================================================================
+void NBS_DynaDriveAudioProcessor::runDynamicsStage (juce::AudioBuffer<float>& buf,
+                                                      const juce::AudioBuffer<float>& sidechain,
+                                                      int numSamples, bool compEnable, bool msEnable,
+                                                      bool useSidechain, float sidechainHpfFreq,
+                                                      float thresholdDb, float ratio,
+                                                      float attackCoeff, float releaseCoeff,
+                                                      float downAmount, float upAmount,
+                                                      float dynamicsMacro, float compOutGain) noexcept
+{
+    const int numChannels = buf.getNumChannels();
+
+    if (compEnable)
+        fillDetectorKey (buf, sidechain, numSamples, useSidechain, sidechainHpfFreq);
+
+    lookaheadDelay.process (buf.getArrayOfWritePointers(), numChannels, numSamples);
+
+    if (! compEnable)
+    {
+        meterFrame.gainReductionDb = 0.0f;
+        return;
+    }
+
+    if (msEnable && numChannels >= 2)
+    {
+        runDynamicsMS (buf, numSamples,
+                       thresholdDb, ratio, attackCoeff, releaseCoeff,
+                       downAmount, upAmount, dynamicsMacro);
+    }
+    else
+    {
+        runDynamicsStereo (buf, numSamples,
+                           thresholdDb, ratio, attackCoeff, releaseCoeff,
+                           downAmount, upAmount, dynamicsMacro);
+    }
+
+    // GR metering
+    meterFrame.gainReductionDb = msEnable
+        ? std::min (midEngine.getGainReductionDb(), sideEngine.getGainReductionDb())
+        : stereoEngine.getGainReductionDb();
+
+    // Comp output volume
+    buf.applyGain (0, numSamples, compOutGain);
+}
+
+//==============================================================================
+// Dynamics Helper: fillDetectorKey
+//
+//   The internal key is the stage input itself (copied before the audio delay).
+//   An external key follows the main signal's M/S encode so the mid and side
+//   engines stay keyed by mid and side; a mono sidechain feeds both channels.
+//==============================================================================
+void NBS_DynaDriveAudioProcessor::fillDetectorKey (const juce::AudioBuffer<float>& buf,
+                                                     const juce::AudioBuffer<float>& sidechain,
+                                                     int numSamples, bool useSidechain,
+                                                     float sidechainHpfFreq) noexcept
+{
+    const int numSidechain = sidechain.getNumChannels();
+    const bool external = useSidechain && numSidechain > 0;
+    const int numKey = std::min (buf.getNumChannels(), detectorKey.getNumChannels());
+
+    for (int ch = 0; ch < numKey; ++ch)
     {
-        float* dataMid  = block.getChannelPointer (0);
-        float* dataSide = block.getChannelPointer (1);
+        const float* src = external ? sidechain.getReadPointer (std::min (ch, numSidechain - 1))
+                                    : buf.getReadPointer (ch);
+        detectorKey.copyFrom (ch, 0, src, numSamples);
+    }
+
+    if (external && numKey >= 2)
+    {
+        float* keyL = detectorKey.getWritePointer (0);
+        float* keyR = detectorKey.getWritePointer (1);
 
         for (int n = 0; n < numSamples; ++n)
         {
-            dataMid[n]  = adaaSaturator.processSample (dataMid[n],  0, midDrive,  alpha, bias, oddGain);
-            dataSide[n] = adaaSaturator.processSample (dataSide[n], 1, sideDrive, alpha, bias, oddGain);
+            const float blend = msBlendBuffer[static_cast<size_t> (n)];
+            if (blend < 0.0001f) continue;  // pure stereo — skip
+
+            const float l = keyL[n];
+            const float r = keyR[n];
+            keyL[n] = l * (1.0f - blend) + (l + r) * 0.5f * blend;
+            keyR[n] = r * (1.0f - blend) + (l - r) * 0.5f * blend;
         }
     }
+
+    if (sidechainHpfFreq <= kSidechainHpfOff)
+        return;
+
+    if (sidechainHpfFreq != cachedSidechainHpfFreq)
+    {
+        // Re-tuning keeps the filter state; switching it on starts clean
+        if (cachedSidechainHpfFreq <= kSidechainHpfOff)
+            for (auto& state : sidechainHpf)
+                state.reset();
+
+        cachedSidechainHpfFreq = sidechainHpfFreq;
+        sidechainHpfCoefficients.makeHighPass (processSpec.sampleRate, sidechainHpfFreq);
+    }
+
+    for (int ch = 0; ch < numKey; ++ch)
+        sidechainHpf[ch].process (detectorKey.getWritePointer (ch), numSamples, sidechainHpfCoefficients);
 }
 
 //==============================================================================
 // Phase 4.3 Helper: runDynamicsStereo
 //
-//   Detects linked stereo level (max L/R) and applies the same gain to both channels.
+//   Detects linked stereo level (max L/R of the key) and applies the same gain
+//   to both channels.
 //==============================================================================
 void NBS_DynaDriveAudioProcessor::runDynamicsStereo (juce::AudioBuffer<float>& buf,
                                                        int numSamples,
@@ -546,10 +985,12 @@ void NBS_DynaDriveAudioProcessor::runDynamicsStereo (juce::AudioBuffer<float>& b
 
     float* dataL = buf.getWritePointer (0);
     float* dataR = buf.getWritePointer (1);
+    const float* keyL = detectorKey.getReadPointer (0);
+    const float* keyR = detectorKey.getReadPointer (1);
 
     for (int n = 0; n < numSamples; ++n)
     {
-        stereoEngine.detectLevel (dataL[n], dataR[n]);
+        stereoEngine.detectLevel (keyL[n], keyR[n]);
 
         const float g = stereoEngine.computeGain (thresholdDb, ratio,
                                                    attackCoeff, releaseCoeff,
@@ -559,22 +1000,376 @@ void NBS_DynaDriveAudioProcessor::runDynamicsStereo (juce::AudioBuffer<float>& b
     }
 }
 
+//==============================================================================
+// Phase 4.3 Helper: runDynamicsMS
+//
+//   Independent mid / side engines, each detecting its own key channel.
+//==============================================================================
+void NBS_DynaDriveAudioProcessor::runDynamicsMS (juce::AudioBuffer<float>& buf,
+                                                   int numSamples,
+                                                   float thresholdDb, float ratio,
+                                                   float attackCoeff, float releaseCoeff,
+                                                   float downAmount, float upAmount,
+                                                   float dynamicsMacro) noexcept
+{
+    jassert (buf.getNumChannels() >= 2);
+
+    float* dataMid  = buf.getWritePointer (0);
+    float* dataSide = buf.getWritePointer (1);
+    const float* keyMid  = detectorKey.getReadPointer (0);
+    const float* keySide = detectorKey.getReadPointer (1);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        midEngine.detectLevelMono (keyMid[n]);
+        const float gMid = midEngine.computeGain (thresholdDb, ratio,
+                                                   attackCoeff, releaseCoeff,
+                                                   downAmount, upAmount, dynamicsMacro);
+        dataMid[n] *= gMid;
+
+        sideEngine.detectLevelMono (keySide[n]);
+        const float gSide = sideEngine.computeGain (thresholdDb, ratio,
+                                                     attackCoeff, releaseCoeff,
+                                                     downAmount, upAmount, dynamicsMacro);
+        dataSide[n] *= gSide;
+    }
+}
+
+//==============================================================================
+// Multiband Helper: applyBandDynamics
+//
+//   Linked detection on every stride-th sample of the band; the gain is held
+//   over the stride. At stride 1 this is runDynamicsStereo on a band. On an
+//   oversampled band the detector reads the (unfiltered) decimated samples,
+//   which is fine for a level estimate and keeps the engine at the base rate.
+//==============================================================================
+void NBS_DynaDriveAudioProcessor::applyBandDynamics (DynamicsEngine& engine,
+                                                     float* dataL, float* dataR,
+                                                     int numFrames, int stride,
+                                                     float thresholdDb, float ratio,
+                                                     float attackCoeff, float releaseCoeff,
+                                                     float downAmount, float upAmount,
+                                                     float dynamicsMacro) noexcept
+{
+    for (int n = 0; n < numFrames; ++n)
+    {
+        float* frameL = dataL + n * stride;
+        float* frameR = dataR + n * stride;
+
+        engine.detectLevel (frameL[0], frameR[0]);
+
+        const float g = engine.computeGain (thresholdDb, ratio,
+                                            attackCoeff, releaseCoeff,
+                                            downAmount, upAmount, dynamicsMacro);
+        for (int i = 0; i < stride; ++i)
+        {
+            frameL[i] *= g;
+            frameR[i] *= g;
+        }
+    }
+}
+
+//==============================================================================
+// Multiband Helper: runMultiband
+//
+//   1. Split into bands (both channels, bands as SIMD lanes of one loop).
+//   2. Per band: dynamics (DYN->SAT, and always at the base rate for linear
+//      bands), its own up path (the main oversampler's for band 0), then
+//      the shaper's small-signal response (linear: 0 % drive, or sat off),
+//      ADAA, or a kBandFadeSeconds crossfade between the two, then dynamics
+//      (SAT->DYN), summed in the main oversampler's upsampled block.
+//   3. One down path for the recombined signal.
+//==============================================================================
+void NBS_DynaDriveAudioProcessor::runMultiband (juce::AudioBuffer<float>& buf, int numBands,
+                                                bool satEnable, bool compEnable, bool prePost, float alpha,
+                                                float thresholdDb, float ratio,
+                                                float attackCoeff, float releaseCoeff,
+                                                float upAmount, float dynamicsMacro) noexcept
+{
+    jassert (buf.getNumChannels() >= 2);
+
+    const int numSamples = buf.getNumSamples();
+    const int factor     = oversampler.getFactor();
+    const int osSamples  = numSamples * factor;
+
+    // Step 1: Split
+    {
+        PFS_PROFILE_STAGE (profiler, kStageCrossover);
+        crossover.process (buf.getArrayOfReadPointers(), 2, bandBuffer.getArrayOfWritePointers(), numSamples);
+    }
+
+    // Block settings per band. A band entering or leaving the shaper moves its
+    // shaper share by up to one block's worth of the kBandFadeSeconds ramp
+    const float fadeStep = static_cast<float> (numSamples / (kBandFadeSeconds * processSpec.sampleRate));
+
+    for (int b = 0; b < numBands; ++b)
+    {
+        auto& band = bands[static_cast<size_t> (b)];
+        const float driveVal = band.driveParam->load();
+
+        band.driveSmoother.setTargetValue (1.0f + (driveVal / 100.0f) * 7.0f);
+        band.biasSmoother.setTargetValue  ((band.evenParam->load() / 100.0f) * 0.15f);
+        band.oddSmoother.setTargetValue   ((band.oddParam->load()  / 100.0f) * 0.05f);
+
+        // The shaper starts clean on the way in; its share is 0 at that point
+        const bool saturating = satEnable && driveVal > 0.0f;
+        if (saturating && band.satMix == 0.0f)
+            band.saturator.reset();
+        band.saturating = saturating;
+    }
+
+    // Step 2: Per band: dynamics, up path, linear and/or saturated output.
+    // Band 0 is processed in the main oversampler's buffer, the others are
+    // added to it.
+    float* const* mixed = nullptr;
+
+    for (int b = 0; b < numBands; ++b)
+    {
+        auto& band = bands[static_cast<size_t> (b)];
+
+        float* bandChannels[2] = { bandBuffer.getWritePointer (b * 2),
+                                   bandBuffer.getWritePointer (b * 2 + 1) };
+        const float downAmount = band.compParam->load() / 100.0f;
+
+        const float mixStart = band.satMix;
+        const float mixEnd   = band.saturating ? std::min (mixStart + fadeStep, 1.0f)
+                                               : std::max (mixStart - fadeStep, 0.0f);
+        band.satMix = mixEnd;
+
+        const bool linear   = mixStart == 0.0f && mixEnd == 0.0f;
+        const bool shaped   = mixStart == 1.0f && mixEnd == 1.0f;
+        const bool postDyn  = compEnable && prePost && ! linear;
+
+        // Linear bands compress at the base rate whatever the order
+        if (compEnable && ! postDyn)
+        {
+            PFS_PROFILE_STAGE (profiler, kStageDynamics);
+            applyBandDynamics (band.engine, bandChannels[0], bandChannels[1], numSamples, 1,
+                               thresholdDb, ratio, attackCoeff, releaseCoeff,
+                               downAmount, upAmount, dynamicsMacro);
+        }
+
+        // Every band's up path runs every block, so a band entering the
+        // shaper does not start its halfbands cold
+        float* const* upsampled = nullptr;
+        {
+            PFS_PROFILE_STAGE (profiler, kStageOversampleUp);
+            auto& upPath = (b == 0) ? oversampler : band.oversampler;
+            upsampled = upPath.processUp (bandChannels, numSamples);
+        }
+
+        if (b == 0)
+            mixed = upsampled;
+
+        {
+            PFS_PROFILE_STAGE (profiler, kStageAdaa);
+
+            if (linear)
+            {
+                for (int ch = 0; ch < 2; ++ch)
+                    applyLinearAdaa (upsampled[ch], osSamples, band.linearHistory[ch]);
+
+                band.driveSmoother.skip (numSamples);
+                band.biasSmoother.skip (numSamples);
+                band.oddSmoother.skip (numSamples);
+            }
+            else
+            {
+                // The linear share is kept while fading; a fully shaped band
+                // only tracks its history for when it fades out
+                for (int ch = 0; ch < 2; ++ch)
+                {
+                    const float* data = upsampled[ch];
+                    auto& history = band.linearHistory[ch];
+
+                    if (shaped)
+                    {
+                        history[1] = osSamples > 1 ? data[osSamples - 2] : history[0];
+                        history[0] = data[osSamples - 1];
+                    }
+                    else
+                    {
+                        float* linearShare = bandLinear.getWritePointer (ch);
+                        std::copy_n (data, osSamples, linearShare);
+                        applyLinearAdaa (linearShare, osSamples, history);
+                    }
+                }
+
+                // The saturator takes one drive / bias / odd per call, so while
+                // a smoother ramps it runs in kBandRampSamples sub-blocks
+                // (ramping in steps of that length, not of the host block)
+                const bool ramping = band.driveSmoother.isSmoothing()
+                                  || band.biasSmoother.isSmoothing()
+                                  || band.oddSmoother.isSmoothing();
+                const int  subBlock = ramping ? kBandRampSamples : numSamples;
+
+                for (int pos = 0; pos < numSamples; pos += subBlock)
+                {
+                    const int n = std::min (subBlock, numSamples - pos);
+                    const float driveGain = band.driveSmoother.skip (n);
+                    const float bias      = band.biasSmoother.skip (n);
+                    const float oddGain   = band.oddSmoother.skip (n);
+
+                    for (int ch = 0; ch < 2; ++ch)
+                    {
+                        float* data = upsampled[ch] + pos * factor;
+
+                        if (useSecondOrderAdaa)
+                            band.saturator.processBlockSecondOrder (data, n * factor, ch, driveGain, alpha, bias, oddGain);
+                        else
+                            band.saturator.processBlock (data, n * factor, ch, driveGain, alpha, bias, oddGain);
+                    }
+                }
+
+                if (! shaped)
+                {
+                    // Linear ramp of the shaper share across the block
+                    const float step = (mixEnd - mixStart) / static_cast<float> (osSamples);
+
+                    for (int ch = 0; ch < 2; ++ch)
+                    {
+                        float* data = upsampled[ch];
+                        const float* linearShare = bandLinear.getReadPointer (ch);
+
+                        for (int i = 0; i < osSamples; ++i)
+                        {
+                            const float w = mixStart + step * static_cast<float> (i + 1);
+                            data[i] = linearShare[i] + w * (data[i] - linearShare[i]);
+                        }
+                    }
+                }
+            }
+        }
+
+        if (postDyn)
+        {
+            PFS_PROFILE_STAGE (profiler, kStageDynamics);
+            applyBandDynamics (band.engine, upsampled[0], upsampled[1], numSamples, factor,
+                               thresholdDb, ratio, attackCoeff, releaseCoeff,
+                               downAmount, upAmount, dynamicsMacro);
+        }
+
+        if (b > 0)
+        {
+            PFS_PROFILE_STAGE (profiler, kStageOversampleDown);
+            juce::FloatVectorOperations::add (mixed[0], upsampled[0], osSamples);
+            juce::FloatVectorOperations::add (mixed[1], upsampled[1], osSamples);
+        }
+    }
+
+    // Step 3: Recombine
+    {
+        PFS_PROFILE_STAGE (profiler, kStageOversampleDown);
+        oversampler.processDown (buf.getArrayOfWritePointers(), numSamples);
+    }
+
+    // GR metering: the band compressing hardest
+    float gainReductionDb = 0.0f;
+    if (compEnable)
+        for (int b = 0; b < numBands; ++b)
+            gainReductionDb = std::min (gainReductionDb, bands[static_cast<size_t> (b)].engine.getGainReductionDb());
+
+    meterFrame.gainReductionDb = gainReductionDb;
+}
+
+void NBS_DynaDriveAudioProcessor::resetMultiband() noexcept
+{
+    crossover.reset();
+
+    for (auto& band : bands)
+    {
+        band.engine.reset();
+        band.oversampler.reset();
+        band.saturator.reset();
+        band.saturating = false;
+        band.satMix = 0.0f;
+        std::fill (&band.linearHistory[0][0], &band.linearHistory[0][0] + 4, 0.0f);
+    }
+}
+
+void NBS_DynaDriveAudioProcessor::applyLinearAdaa (float* data, int numSamples, float (&history)[2]) const noexcept
+{
+    // First-order ADAA of a linear shaper is the two-sample average,
+    // second-order the three-sample one
+    float x1 = history[0];
+    float x2 = history[1];
+
+    if (useSecondOrderAdaa)
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float x0 = data[i];
+            data[i] = (x0 + x1 + x2) * (1.0f / 3.0f);
+            x2 = x1;
+            x1 = x0;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float x0 = data[i];
+            data[i] = 0.5f * (x0 + x1);
+            x2 = x1;
+            x1 = x0;
+        }
+    }
+
+    history[0] = x1;
+    history[1] = x2;
+}
+
+//==============================================================================
+// Helper: decodeMidSide
+//
+//   Per-sample blend between the processed channels and their M/S decode,
+//   using msBlendBuffer. blend=0: pass-through (stereo), blend=1: full decode.
+//==============================================================================
+void NBS_DynaDriveAudioProcessor::decodeMidSide (juce::AudioBuffer<float>& buf, int numSamples) noexcept
+{
+    if (buf.getNumChannels() < 2)
+        return;
+
+    float* dataL = buf.getWritePointer (0);
+    float* dataR = buf.getWritePointer (1);
+
+    for (int n = 0; n < numSamples; ++n)
+    {
+        const float blend = msBlendBuffer[static_cast<size_t> (n)];
+        if (blend < 0.0001f) continue;  // pure stereo — no decode needed
+
+        const float ch0 = dataL[n];
+        const float ch1 = dataR[n];
+        const float L = ch0 + ch1;   // M/S decode
+        const float R = ch0 - ch1;
+        dataL[n] = ch0 * (1.0f - blend) + L * blend;
+        dataR[n] = ch1 * (1.0f - blend) + R * blend;
+    }
+}
+
 //==============================================================================
 // Process
 //==============================================================================
 
-void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
+void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& hostBuffer,
                                                  juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused (midiMessages);
+    PFS_PROFILE_BLOCK (profiler, hostBuffer.getNumSamples(), processSpec.sampleRate);
+
+    // Main bus (processed in place) and the sidechain bus, which has no
+    // channels while the host leaves it disabled. Both refer to hostBuffer's
+    // channels; nothing is copied or allocated.
+    auto buffer = getBusBuffer (hostBuffer, false, 0);
+    const auto sidechain = getBusBuffer (hostBuffer, true, 1);
 
     const int numChannels = buffer.getNumChannels();
     const int numSamples  = buffer.getNumSamples();
 
     // Clear any channels beyond our input count (defensive)
     for (int ch = getTotalNumInputChannels(); ch < getTotalNumOutputChannels(); ++ch)
-        buffer.clear (ch, 0, numSamples);
+        hostBuffer.clear (ch, 0, numSamples);
 
     //--------------------------------------------------------------------------
     // 0. Bypass — pass audio through unprocessed
@@ -583,6 +1378,27 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
     if (bypassed)
         return;
 
+    //--------------------------------------------------------------------------
+    // 0b. Oversampling factor / filter or lookahead change during a
+    //     non-realtime render: applied in place (live changes go through
+    //     rebuildOversampling()). prepareOversampling() allocates and both
+    //     call setLatencySamples() from inside processBlock(); that is only
+    //     acceptable because an offline render has no deadline and cannot
+    //     suspend itself without dropping blocks. It runs only on the block
+    //     where the choice changed.
+    //--------------------------------------------------------------------------
+    if (isNonRealtime())
+    {
+        const int renderOrder = selectOversamplingOrder();
+        const auto renderFilter = selectOversamplingFilter();
+        if (renderOrder != oversamplingOrder || renderFilter != oversampler.getFilter())
+            prepareOversampling (renderOrder, renderFilter);
+
+        const int renderLookahead = selectLookaheadSamples();
+        if (renderLookahead != lookaheadSamples)
+            prepareLookahead (renderLookahead);
+    }
+
     //--------------------------------------------------------------------------
     // 1. Read parameters (atomic, lock-free — real-time safe)
     //--------------------------------------------------------------------------
@@ -619,6 +1435,17 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
     const float attackMs      = parameters.getRawParameterValue ("attack_time")->load();
     const float releaseMs     = parameters.getRawParameterValue ("release_time")->load();
 
+    // Sidechain parameters
+    const bool  scExternal    = parameters.getRawParameterValue ("sc_external")->load() > 0.5f;
+    const float scHpfFreq     = parameters.getRawParameterValue ("sc_hpf")->load();
+
+    // Multiband parameters ("bands": 0 = Off, 1 = 3 bands, 2 = 4 bands)
+    const int   bandsChoice   = juce::roundToInt (parameters.getRawParameterValue ("bands")->load());
+    const int   numBands      = bandsChoice > 0 ? bandsChoice + 2 : 0;
+    const float xoverLow      = parameters.getRawParameterValue ("xover_low")->load();
+    const float xoverMid      = parameters.getRawParameterValue ("xover_mid")->load();
+    const float xoverHigh     = parameters.getRawParameterValue ("xover_high")->load();
+
     //--------------------------------------------------------------------------
     // 2. Update smoother targets
     //--------------------------------------------------------------------------
@@ -719,9 +1546,12 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
     //--------------------------------------------------------------------------
     // 8. Input gain (smoothed, per-sample)
     //    Two-pass: advance smoother on ch 0, apply settled value on ch 1+.
+    //    (Stages 8-9 all accumulate into the "Input" profile stage.)
     //--------------------------------------------------------------------------
     for (int ch = 0; ch < numChannels; ++ch)
     {
+        PFS_PROFILE_STAGE (profiler, kStageInput);
+
         float* data = buffer.getWritePointer (ch);
 
         if (ch == 0)
@@ -743,6 +1573,8 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
     //   We track the maximum absolute sample value per channel per block.
     //--------------------------------------------------------------------------
     {
+        PFS_PROFILE_STAGE (profiler, kStageInput);
+
         float peakL = 0.0f;
         float peakR = 0.0f;
 
@@ -759,12 +1591,9 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
                 peakR = std::max (peakR, std::abs (dataR[n]));
         }
 
-        // Atomic peak hold: keep the maximum seen since last timer read.
-        // The UI timer reads and applies decay separately.
-        meterInL.store (std::max (peakL, meterInL.load (std::memory_order_relaxed)),
-                        std::memory_order_relaxed);
-        meterInR.store (std::max (peakR, meterInR.load (std::memory_order_relaxed)),
-                        std::memory_order_relaxed);
+        // Per-block peak; the UI timer holds the max across frames and applies decay
+        meterFrame.inL = peakL;
+        meterFrame.inR = peakR;
     }
 
     //--------------------------------------------------------------------------
@@ -775,6 +1604,8 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
     //--------------------------------------------------------------------------
     if (numChannels >= 2)
     {
+        PFS_PROFILE_STAGE (profiler, kStageInput);
+
         float* dataL = buffer.getWritePointer (0);
         float* dataR = buffer.getWritePointer (1);
 
@@ -811,84 +1642,112 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
     //
     //     For simplicity and clarity, M/S handling is integrated into each
     //     processing call: if msEnable, we use per-channel drive/dynamics instances.
+    //
+    //     bands == 3 or 4 replaces both with the multiband chain (runMultiband),
+    //     where pre_post sets the order inside each band.
     //--------------------------------------------------------------------------
 
-    if (!prePost)
+    if (numBands != activeBandCount)
+    {
+        // Entering multiband (or changing the band count): the crossover and
+        // band state are stale from the last time they ran
+        if (numBands > 0)
+            resetMultiband();
+        activeBandCount = numBands;
+    }
+
+    if (numBands > 0 && numChannels >= 2)
     {
         //----------------------------------------------------------------------
-        // DYN→SAT mode (pre_post == false, default)
-        //   Order: Dynamics → ADAA Sat → Post-Sat Tilt → [M/S Decode] → Post-Dyn Tilt
+        // Multiband mode (bands == 3 or 4)
+        //   Order: Crossover → per band Dynamics / ADAA Sat (in pre_post order)
+        //          → Recombine → Post-Sat Tilt → [M/S Decode] → Post-Dyn Tilt
         //----------------------------------------------------------------------
+        crossover.setCrossovers (numBands, xoverLow, xoverMid, xoverHigh);
+
+        runMultiband (buffer, numBands, satEnable, compEnable, prePost, alphaBlock,
+                      thresholdDb, ratio, attackCoeff, releaseCoeff,
+                      upAmount, dynamicsMacro);
 
-        // Step A: Dynamics (gated by comp_enable)
-        if (compEnable)
         {
-            if (msEnable && numChannels >= 2)
-            {
-                float* dataMid  = buffer.getWritePointer (0);
-                float* dataSide = buffer.getWritePointer (1);
+            PFS_PROFILE_STAGE (profiler, kStageDynamics);
 
-                for (int n = 0; n < numSamples; ++n)
-                {
-                    midEngine.detectLevelMono (dataMid[n]);
-                    const float gMid = midEngine.computeGain (thresholdDb, ratio,
-                                                               attackCoeff, releaseCoeff,
-                                                               downAmount, upAmount, dynamicsMacro);
-                    dataMid[n] *= gMid;
-
-                    sideEngine.detectLevelMono (dataSide[n]);
-                    const float gSide = sideEngine.computeGain (thresholdDb, ratio,
-                                                                 attackCoeff, releaseCoeff,
-                                                                 downAmount, upAmount, dynamicsMacro);
-                    dataSide[n] *= gSide;
-                }
-            }
-            else
-            {
-                runDynamicsStereo (buffer, numSamples,
-                                   thresholdDb, ratio, attackCoeff, releaseCoeff,
-                                   downAmount, upAmount, dynamicsMacro);
-            }
-
-            // GR metering
-            if (msEnable)
-                meterGR.store (std::min (midEngine.getGainReductionDb(), sideEngine.getGainReductionDb()),
-                               std::memory_order_relaxed);
-            else
-                meterGR.store (stereoEngine.getGainReductionDb(), std::memory_order_relaxed);
+            // The bands detect in-band, so the lookahead is 0 here once the
+            // rebuilder has run; until then this keeps the audio on the
+            // latency the host was told
+            lookaheadDelay.process (buffer.getArrayOfWritePointers(), numChannels, numSamples);
 
             // Comp output volume
-            for (int ch = 0; ch < numChannels; ++ch)
-            {
-                float* data = buffer.getWritePointer (ch);
-                for (int n = 0; n < numSamples; ++n)
-                    data[n] *= compOutBlock;
-            }
+            if (compEnable)
+                buffer.applyGain (compOutBlock);
         }
-        else
+
+        if (satEnable)
+        {
+            PFS_PROFILE_STAGE (profiler, kStageTilt);
+
+            // Post-Saturation Tilt and drive output volume, on the recombined bands
+            applySatTilt (buffer, satTiltSlope);
+            buffer.applyGain (driveOutBlock);
+        }
+
+        // Step D: M/S Decode (smoothed crossfade — click-free)
+        {
+            PFS_PROFILE_STAGE (profiler, kStageOutput);
+            decodeMidSide (buffer, numSamples);
+        }
+
+        // Step E: Post-Dynamics Tilt (in L/R space after decode)
+        {
+            PFS_PROFILE_STAGE (profiler, kStageTilt);
+            applyDynTilt (buffer, dynTiltSlope);
+        }
+    }
+    else if (!prePost)
+    {
+        //----------------------------------------------------------------------
+        // DYN→SAT mode (pre_post == false, default)
+        //   Order: Dynamics → ADAA Sat → Post-Sat Tilt → [M/S Decode] → Post-Dyn Tilt
+        //----------------------------------------------------------------------
+
+        // Step A: Dynamics (gated by comp_enable; the lookahead delay always runs)
         {
-            meterGR.store (0.0f, std::memory_order_relaxed);
+            PFS_PROFILE_STAGE (profiler, kStageDynamics);
+            runDynamicsStage (buffer, sidechain, numSamples, compEnable, msEnable,
+                              scExternal, scHpfFreq,
+                              thresholdDb, ratio, attackCoeff, releaseCoeff,
+                              downAmount, upAmount, dynamicsMacro, compOutBlock);
         }
 
-        // Step B: ADAA Saturation (4x oversampled)
+        // Step B: ADAA Saturation (oversampled at the selected factor)
         //   Always run oversampling up/down to maintain consistent latency for
         //   DryWetMixer phase alignment and DAW PDC, even when sat is bypassed.
         {
-            juce::dsp::AudioBlock<float> inputBlock (buffer);
-            auto oversampledBlock = oversampling.processSamplesUp (inputBlock);
+            juce::dsp::AudioBlock<float> oversampledBlock;
+            {
+                PFS_PROFILE_STAGE (profiler, kStageOversampleUp);
+                oversampledBlock = upsample (buffer);
+            }
 
             if (satEnable)
             {
+                PFS_PROFILE_STAGE (profiler, kStageAdaa);
+
                 if (msEnable && numChannels >= 2)
                     runSaturationMS (oversampledBlock, midDriveBlock, sideDriveBlock, alphaBlock, biasBlock, oddGainBlock);
                 else
                     runSaturation (oversampledBlock, driveBlock, alphaBlock, biasBlock, oddGainBlock);
             }
 
-            oversampling.processSamplesDown (inputBlock);
+            {
+                PFS_PROFILE_STAGE (profiler, kStageOversampleDown);
+                oversampler.processDown (buffer.getArrayOfWritePointers(), numSamples);
+            }
 
             if (satEnable)
             {
+                PFS_PROFILE_STAGE (profiler, kStageTilt);
+
                 // Post-Saturation Tilt (only when sat is active)
                 applySatTilt (buffer, satTiltSlope);
 
@@ -903,27 +1762,16 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
         }
 
         // Step D: M/S Decode (smoothed crossfade — click-free)
-        if (numChannels >= 2)
         {
-            float* dataL = buffer.getWritePointer (0);
-            float* dataR = buffer.getWritePointer (1);
-
-            for (int n = 0; n < numSamples; ++n)
-            {
-                const float blend = msBlendBuffer[static_cast<size_t> (n)];
-                if (blend < 0.0001f) continue;  // pure stereo — no decode needed
-
-                const float ch0 = dataL[n];
-                const float ch1 = dataR[n];
-                const float L = ch0 + ch1;   // M/S decode
-                const float R = ch0 - ch1;
-                dataL[n] = ch0 * (1.0f - blend) + L * blend;
-                dataR[n] = ch1 * (1.0f - blend) + R * blend;
-            }
+            PFS_PROFILE_STAGE (profiler, kStageOutput);
+            decodeMidSide (buffer, numSamples);
         }
 
         // Step E: Post-Dynamics Tilt (applied in L/R space after decode)
-        applyDynTilt (buffer, dynTiltSlope);
+        {
+            PFS_PROFILE_STAGE (profiler, kStageTilt);
+            applyDynTilt (buffer, dynTiltSlope);
+        }
     }
     else
     {
@@ -932,24 +1780,34 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
         //   Order: ADAA Sat → Post-Sat Tilt → Dynamics → [M/S Decode] → Post-Dyn Tilt
         //----------------------------------------------------------------------
 
-        // Step A: ADAA Saturation (4x oversampled)
+        // Step A: ADAA Saturation (oversampled at the selected factor)
         //   Always run oversampling up/down for consistent latency (see DYN→SAT path).
         {
-            juce::dsp::AudioBlock<float> inputBlock (buffer);
-            auto oversampledBlock = oversampling.processSamplesUp (inputBlock);
+            juce::dsp::AudioBlock<float> oversampledBlock;
+            {
+                PFS_PROFILE_STAGE (profiler, kStageOversampleUp);
+                oversampledBlock = upsample (buffer);
+            }
 
             if (satEnable)
             {
+                PFS_PROFILE_STAGE (profiler, kStageAdaa);
+
                 if (msEnable && numChannels >= 2)
                     runSaturationMS (oversampledBlock, midDriveBlock, sideDriveBlock, alphaBlock, biasBlock, oddGainBlock);
                 else
                     runSaturation (oversampledBlock, driveBlock, alphaBlock, biasBlock, oddGainBlock);
             }
 
-            oversampling.processSamplesDown (inputBlock);
+            {
+                PFS_PROFILE_STAGE (profiler, kStageOversampleDown);
+                oversampler.processDown (buffer.getArrayOfWritePointers(), numSamples);
+            }
 
             if (satEnable)
             {
+                PFS_PROFILE_STAGE (profiler, kStageTilt);
+
                 // Post-Saturation Tilt (only when sat is active)
                 applySatTilt (buffer, satTiltSlope);
 
@@ -963,83 +1821,33 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
             }
         }
 
-        // Step C: Dynamics (gated by comp_enable)
-        if (compEnable)
+        // Step C: Dynamics (gated by comp_enable; the lookahead delay always runs)
         {
-            if (msEnable && numChannels >= 2)
-            {
-                float* dataMid  = buffer.getWritePointer (0);
-                float* dataSide = buffer.getWritePointer (1);
-
-                for (int n = 0; n < numSamples; ++n)
-                {
-                    midEngine.detectLevelMono (dataMid[n]);
-                    const float gMid = midEngine.computeGain (thresholdDb, ratio,
-                                                               attackCoeff, releaseCoeff,
-                                                               downAmount, upAmount, dynamicsMacro);
-                    dataMid[n] *= gMid;
-
-                    sideEngine.detectLevelMono (dataSide[n]);
-                    const float gSide = sideEngine.computeGain (thresholdDb, ratio,
-                                                                 attackCoeff, releaseCoeff,
-                                                                 downAmount, upAmount, dynamicsMacro);
-                    dataSide[n] *= gSide;
-                }
-            }
-            else
-            {
-                runDynamicsStereo (buffer, numSamples,
-                                   thresholdDb, ratio, attackCoeff, releaseCoeff,
-                                   downAmount, upAmount, dynamicsMacro);
-            }
-
-            // GR metering
-            if (msEnable)
-                meterGR.store (std::min (midEngine.getGainReductionDb(), sideEngine.getGainReductionDb()),
-                               std::memory_order_relaxed);
-            else
-                meterGR.store (stereoEngine.getGainReductionDb(), std::memory_order_relaxed);
-
-            // Comp output volume
-            for (int ch = 0; ch < numChannels; ++ch)
-            {
-                float* data = buffer.getWritePointer (ch);
-                for (int n = 0; n < numSamples; ++n)
-                    data[n] *= compOutBlock;
-            }
-        }
-        else
-        {
-            meterGR.store (0.0f, std::memory_order_relaxed);
+            PFS_PROFILE_STAGE (profiler, kStageDynamics);
+            runDynamicsStage (buffer, sidechain, numSamples, compEnable, msEnable,
+                              scExternal, scHpfFreq,
+                              thresholdDb, ratio, attackCoeff, releaseCoeff,
+                              downAmount, upAmount, dynamicsMacro, compOutBlock);
         }
 
         // Step D: M/S Decode (smoothed crossfade — click-free)
-        if (numChannels >= 2)
         {
-            float* dataL = buffer.getWritePointer (0);
-            float* dataR = buffer.getWritePointer (1);
-
-            for (int n = 0; n < numSamples; ++n)
-            {
-                const float blend = msBlendBuffer[static_cast<size_t> (n)];
-                if (blend < 0.0001f) continue;
-
-                const float ch0 = dataL[n];
-                const float ch1 = dataR[n];
-                const float L = ch0 + ch1;
-                const float R = ch0 - ch1;
-                dataL[n] = ch0 * (1.0f - blend) + L * blend;
-                dataR[n] = ch1 * (1.0f - blend) + R * blend;
-            }
+            PFS_PROFILE_STAGE (profiler, kStageOutput);
+            decodeMidSide (buffer, numSamples);
         }
 
         // Step E: Post-Dynamics Tilt (in L/R space after decode)
-        applyDynTilt (buffer, dynTiltSlope);
+        {
+            PFS_PROFILE_STAGE (profiler, kStageTilt);
+            applyDynTilt (buffer, dynTiltSlope);
+        }
     }
 
     //--------------------------------------------------------------------------
     // 11. Output gain (smoothed, per-sample)
     //--------------------------------------------------------------------------
+    PFS_PROFILE_STAGE (profiler, kStageOutput);
+
     for (int ch = 0; ch < numChannels; ++ch)
     {
         float* data = buffer.getWritePointer (ch);
@@ -1079,10 +1887,9 @@ void NBS_DynaDriveAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer
                 peakR = std::max (peakR, std::abs (dataR[n]));
         }
 
-        meterOutL.store (std::max (peakL, meterOutL.load (std::memory_order_relaxed)),
-                         std::memory_order_relaxed);
-        meterOutR.store (std::max (peakR, meterOutR.load (std::memory_order_relaxed)),
-                         std::memory_order_relaxed);
+        meterFrame.outL = peakL;
+        meterFrame.outR = peakR;
+        meterTelemetry.publish (meterFrame);
     }
 
     //--------------------------------------------------------------------------
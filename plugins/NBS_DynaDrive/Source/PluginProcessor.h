@@ -3,10 +3,17 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
 
+#include <pfs/Biquad.h>
+#include <pfs/Oversampler.h>
+#include <pfs/StageProfiler.h>
+#include <pfs/Telemetry.h>
+
 #include "ADAASaturator.h"
 #include "DynamicsEngine.h"
+#include "MultibandCrossover.h"
 
 class NBS_DynaDriveAudioProcessor : public juce::AudioProcessor
+                                  , public pfs::StageProfilerSource
 {
 public:
     NBS_DynaDriveAudioProcessor();
@@ -42,28 +49,66 @@ public:
     juce::AudioProcessorValueTreeState parameters;
 
     //--------------------------------------------------------------------------
-    // Phase 5.3: Level meter peaks (written by audio thread, read by UI timer)
-    //   One atomic float per channel — lock-free, no blocking on audio thread.
-    //   Values are linear peak amplitude (0.0 to ~1.0+).
-    //   PluginEditor timer reads and decays these at ~30 Hz.
+    // Phase 5.3: Level meters (published by the audio thread once per block,
+    //   drained by the PluginEditor timer at ~30 Hz, which holds the peak over
+    //   every frame since its last tick and applies decay).
+    //   Peaks are linear amplitude (0.0 to ~1.0+).
+    //   v1.3.0: gainReductionDb is negative while compressing, 0 = none.
     //--------------------------------------------------------------------------
-    std::atomic<float> meterInL  { 0.0f };
-    std::atomic<float> meterInR  { 0.0f };
-    std::atomic<float> meterOutL { 0.0f };
-    std::atomic<float> meterOutR { 0.0f };
+    struct MeterFrame
+    {
+        float inL  = 0.0f;
+        float inR  = 0.0f;
+        float outL = 0.0f;
+        float outR = 0.0f;
+        float gainReductionDb = 0.0f;
+    };
+
+    pfs::TelemetryChannel<MeterFrame> meterTelemetry;
 
-    // v1.3.0: Gain reduction meter (dB, negative = gain reduction, 0 = no compression)
-    std::atomic<float> meterGR   { 0.0f };
+    //--------------------------------------------------------------------------
+    // Per-stage processBlock timings (compiled in with -DPFS_PROFILING=ON)
+    //   Drained by the editor's meter timer and sent to the UI as "cpu_profile".
+    //   Oversampling up/down are timed apart from the ADAA shaper they wrap.
+    //--------------------------------------------------------------------------
+    enum ProfileStage
+    {
+        kStageInput,        // input gain, input meter, M/S encode
+        kStageCrossover,    // multiband split (bands mode only)
+        kStageDynamics,     // dynamics engines + comp out volume
+        kStageOversampleUp,
+        kStageAdaa,
+        kStageOversampleDown,
+        kStageTilt,         // post-sat tilt, drive out volume, post-dyn tilt
+        kStageOutput        // M/S decode, output gain, output meter, dry/wet
+    };
+
+    pfs::StageProfiler profiler { "Input", "Crossover", "Dynamics", "OS up", "ADAA", "OS down", "Tilt", "Output" };
+
+    pfs::StageProfiler& getStageProfiler() noexcept override { return profiler; }
 
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
+    // Filled in as processBlock() runs, published at the output meter (audio thread only)
+    MeterFrame meterFrame;
+
     //--------------------------------------------------------------------------
     // DSP Components — declared BEFORE parameters (JUCE initialisation order)
     //--------------------------------------------------------------------------
 
-    // 4x oversampling for anti-aliased saturation (FIR equiripple — steepest rolloff)
-    juce::dsp::Oversampling<float> oversampling { 2, 2, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true };
+    // Oversampling around the saturation.
+    //   Factor from the "oversampling" choice (1x/2x/4x/8x), halfbands from
+    //   "os_filter" (linear-phase FIR or low-latency IIR). Re-preparing it
+    //   allocates, so it only happens in prepareOversampling() (see
+    //   OversamplingRebuilder); processBlock() never allocates.
+    pfs::Oversampler oversampler;
+
+    // log2 of the factor the oversampler runs at (-1 before prepareToPlay())
+    int oversamplingOrder = -1;
+
+    // 1x and 2x run second-order ADAA to make up for the lower rate
+    bool useSecondOrderAdaa = false;
 
     // Phase 4.1: Input gain stage
     juce::dsp::Gain<float> inputGain;
@@ -94,11 +139,89 @@ private:
     DynamicsEngine midEngine;
     DynamicsEngine sideEngine;
 
+    // Detector key: the "Sidechain" input bus when sc_external is on and the
+    //   host connects one, otherwise the signal entering the dynamics stage;
+    //   high-passed by sc_hpf. Sized in prepareToPlay().
+    juce::AudioBuffer<float> detectorKey;
+    pfs::BiquadCoefficients sidechainHpfCoefficients;
+    pfs::BiquadState sidechainHpf[2];
+    float cachedSidechainHpfFreq = 0.0f;
+
+    static constexpr float kSidechainHpfOff = 20.0f;  // sc_hpf at its minimum
+
+    // Lookahead ("lookahead", 0–10 ms): the audio is delayed by
+    //   lookaheadSamples while the engines read the undelayed key and hold
+    //   its level over lookaheadSamples + 1. It is 0 with the compressor off
+    //   or in bands mode, so it only adds latency where it is used. Changes
+    //   go through the rebuilder (see prepareLookahead()).
+    static constexpr double kMaxLookaheadMs = 10.0;
+    LookaheadDelay lookaheadDelay;
+    int maxLookaheadSamples = 0;
+    int lookaheadSamples = 0;
+
+    //--------------------------------------------------------------------------
+    // Multiband mode ("bands" = 3 or 4)
+    //   The crossover splits the signal after the M/S encode, and each band
+    //   runs its own dynamics engine and saturator with its own drive,
+    //   harmonics and compression amount (see runMultiband()).
+    //
+    //   Every band runs through its own up path every block (band 0 through
+    //   the main oversampler's), and the bands are summed at the oversampled
+    //   rate ahead of the main oversampler's single down path. So every band
+    //   sees the same round trip and the recombined bands stay phase-coherent.
+    //   A band at 0 % drive is linear and skips the shaper; entering or
+    //   leaving it, the band crossfades between its linear and saturated
+    //   output over kBandFadeSeconds, on an up path that is already warm.
+    //--------------------------------------------------------------------------
+    static constexpr int kMaxBands = MultibandCrossover::kMaxBands;
+    static constexpr double kBandFadeSeconds = 0.005;
+    static constexpr int    kBandRampSamples = 32;  // drive / bias / odd ramp step
+
+    struct Band
+    {
+        ADAASaturator    saturator;
+        DynamicsEngine   engine;
+        pfs::Oversampler oversampler;  // up path only, unused by band 0 (down runs on the sum)
+
+        // "bandN_drive", "bandN_even", "bandN_odd", "bandN_comp"
+        std::atomic<float>* driveParam = nullptr;
+        std::atomic<float>* evenParam  = nullptr;
+        std::atomic<float>* oddParam   = nullptr;
+        std::atomic<float>* compParam  = nullptr;
+
+        juce::LinearSmoothedValue<float> driveSmoother;
+        juce::LinearSmoothedValue<float> biasSmoother;
+        juce::LinearSmoothedValue<float> oddSmoother;
+
+        // Shaper share of the band's output: 0 linear, 1 saturating, ramped
+        // towards saturating ? 1 : 0 over kBandFadeSeconds
+        bool  saturating = false;
+        float satMix     = 0.0f;
+
+        // Last up-path samples ahead of the shaper, for the linear share's
+        // ADAA average: [channel][x[-1], x[-2]]
+        float linearHistory[2][2] {};
+    };
+
+    MultibandCrossover crossover;
+    std::array<Band, kMaxBands> bands;
+
+    juce::AudioBuffer<float> bandBuffer;  // band b, channel ch at b * 2 + ch
+    juce::AudioBuffer<float> bandLinear;  // linear share of a crossfading band (oversampled)
+
+    // Band count processBlock() last ran with (0 = single band)
+    int activeBandCount = 0;
+
     // Phase 4.1: Output gain stage
     juce::dsp::Gain<float> outputGain;
 
     // Phase 4.1: Dry/Wet mixer
-    juce::dsp::DryWetMixer<float> dryWetMixer;
+    //   The dry path is delayed by the oversampling + ADAA + lookahead latency.
+    //   8x linear phase stays inside kMaxOversamplingLatency; the lookahead
+    //   gets the rest (10 ms up to 192 kHz, clamped above that).
+    static constexpr int kMaxOversamplingLatency = 512;
+    static constexpr int kMaxWetLatencySamples   = 4096;
+    juce::dsp::DryWetMixer<float> dryWetMixer { kMaxWetLatencySamples };
 
     // ProcessSpec shared across all JUCE DSP components
     juce::dsp::ProcessSpec processSpec;
@@ -155,7 +278,28 @@ private:
                           float midDrive, float sideDrive,
                           float alpha, float bias, float oddGain) noexcept;
 
-    // Apply the dynamics engine to the stereo buffer (normal mode, linked detection)
+    // Single-band dynamics stage: fills the detector key, runs the lookahead
+    // delay (always, so the audio matches the reported latency), then the
+    // compressor on the delayed audio and the comp output volume when
+    // compEnable is set
+    void runDynamicsStage (juce::AudioBuffer<float>& buf,
+                           const juce::AudioBuffer<float>& sidechain,
+                           int numSamples, bool compEnable, bool msEnable,
+                           bool useSidechain, float sidechainHpfFreq,
+                           float thresholdDb, float ratio,
+                           float attackCoeff, float releaseCoeff,
+                           float downAmount, float upAmount,
+                           float dynamicsMacro, float compOutGain) noexcept;
+
+    // Copies the key source into detectorKey (the external one M/S-encoded
+    // like the main signal) and high-passes it
+    void fillDetectorKey (const juce::AudioBuffer<float>& buf,
+                          const juce::AudioBuffer<float>& sidechain,
+                          int numSamples, bool useSidechain,
+                          float sidechainHpfFreq) noexcept;
+
+    // Apply the dynamics engine to the stereo buffer (normal mode, linked
+    // detection on detectorKey)
     void runDynamicsStereo (juce::AudioBuffer<float>& buf,
                             int numSamples,
                             float thresholdDb, float ratio,
@@ -163,11 +307,107 @@ private:
                             float downAmount, float upAmount,
                             float dynamicsMacro) noexcept;
 
+    // Mid and side engines on channels 0 / 1, each keyed by its own detectorKey channel
+    void runDynamicsMS (juce::AudioBuffer<float>& buf,
+                        int numSamples,
+                        float thresholdDb, float ratio,
+                        float attackCoeff, float releaseCoeff,
+                        float downAmount, float upAmount,
+                        float dynamicsMacro) noexcept;
+
+    // Multiband chain in place of the single-band dynamics / saturation: split,
+    // per-band dynamics and saturation, recombination (stereo buffers only)
+    void runMultiband (juce::AudioBuffer<float>& buf, int numBands,
+                       bool satEnable, bool compEnable, bool prePost, float alpha,
+                       float thresholdDb, float ratio,
+                       float attackCoeff, float releaseCoeff,
+                       float upAmount, float dynamicsMacro) noexcept;
+
+    // Linked dynamics over numFrames frames of a band, detecting every
+    // stride-th sample and holding its gain for stride samples (stride > 1
+    // runs the base-rate engine on oversampled data)
+    static void applyBandDynamics (DynamicsEngine& engine, float* dataL, float* dataR,
+                                   int numFrames, int stride,
+                                   float thresholdDb, float ratio,
+                                   float attackCoeff, float releaseCoeff,
+                                   float downAmount, float upAmount,
+                                   float dynamicsMacro) noexcept;
+
+    // The shaper's small-signal response (its ADAA average) at the oversampled
+    // rate, in place, so linear band output lines up with saturated output;
+    // history is [x[-1], x[-2]] and is carried over from the last call
+    void applyLinearAdaa (float* data, int numSamples, float (&history)[2]) const noexcept;
+
+    // Clears the crossover and band state when multiband processing starts
+    void resetMultiband() noexcept;
+
+    // M/S decode (smoothed crossfade from msBlendBuffer — click-free)
+    void decodeMidSide (juce::AudioBuffer<float>& buf, int numSamples) noexcept;
+
     // Apply sat tilt filter to buffer (block-level, no-op when slope==0)
     void applySatTilt  (juce::AudioBuffer<float>& buf, float slopeDb) noexcept;
 
     // Apply dyn tilt filter to buffer (block-level, no-op when slope==0)
     void applyDynTilt  (juce::AudioBuffer<float>& buf, float slopeDb) noexcept;
 
+    //--------------------------------------------------------------------------
+    // Oversampling factor / filter and lookahead switching. A change of
+    // "oversampling", "os_filter", "lookahead", "comp_enable" or "bands" is
+    // flagged by the listener and a message-thread timer rebuilds (see
+    // rebuildOversampling()).
+    //--------------------------------------------------------------------------
+    class OversamplingRebuilder : public juce::Timer
+                                , public juce::AudioProcessorValueTreeState::Listener
+    {
+    public:
+        explicit OversamplingRebuilder (NBS_DynaDriveAudioProcessor& p) : processor (p) {}
+
+        // Runs on the audio thread under host automation, so it only sets the
+        // flag (triggerAsyncUpdate() would post a message from there)
+        void parameterChanged (const juce::String&, float) override { pending.store (true); }
+
+        void timerCallback() override
+        {
+            if (pending.exchange (false))
+                processor.rebuildOversampling();
+        }
+
+    private:
+        NBS_DynaDriveAudioProcessor& processor;
+        std::atomic<bool> pending { false };
+    };
+
+    OversamplingRebuilder oversamplingRebuilder { *this };
+
+    // log2 of the factor selected by the "oversampling" parameter (0–3)
+    int selectOversamplingOrder() const;
+
+    // Halfband filter selected by the "os_filter" parameter
+    pfs::HalfbandFilter selectOversamplingFilter() const;
+
+    // (Re)builds the oversampler at processSpec for 2^order with the given
+    // halfbands, re-prepares the ADAA saturator at the new rate and re-reports
+    // the latency to the dry/wet mixer and the host. Not realtime safe.
+    void prepareOversampling (int order, pfs::HalfbandFilter filter);
+
+    // Lookahead in samples selected by the "lookahead" parameter; 0 when
+    // "comp_enable" is off or "bands" is not Off
+    int selectLookaheadSamples() const;
+
+    // Sets the lookahead delay and the engines' level windows and re-reports
+    // the latency. Not realtime safe (the host is told the new latency).
+    void prepareLookahead (int samples);
+
+    // Oversampling + ADAA + lookahead latency to the dry/wet mixer and the host
+    void reportLatency();
+
+    // Upsamples buf into the oversampler; the block is valid until the
+    // matching oversampler.processDown()
+    juce::dsp::AudioBlock<float> upsample (const juce::AudioBuffer<float>& buf) noexcept;
+
+    // Message thread: suspends processing and applies the selected factor,
+    // filter and lookahead
+    void rebuildOversampling();
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NBS_DynaDriveAudioProcessor)
 };
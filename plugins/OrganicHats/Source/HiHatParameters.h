@@ -0,0 +1,32 @@
+#pragma once
+#include <pfs/Parameters.h>
+
+// Parameter table shared by the processor (layout) and HiHatVoice (reads).
+// The processor owns one HiHatParameterSet; every voice reads through it,
+// so note-on and renderNextBlock() do no string lookups.
+enum HiHatParam
+{
+    kClosedTone,
+    kClosedDecay,
+    kClosedNoiseColor,
+    kOpenTone,
+    kOpenRelease,
+    kOpenNoiseColor,
+    kNumHiHatParams
+};
+
+inline constexpr std::array<pfs::ParamSpec, kNumHiHatParams> kHiHatParamSpecs {{
+    // Closed Hi-Hat parameters
+    pfs::floatParam("CLOSED_TONE", "Closed Tone", 0.0f, 100.0f, 0.01f, 1.0f, 50.0f, "%"),
+    pfs::floatParam("CLOSED_DECAY", "Closed Decay", 20.0f, 200.0f, 0.1f, 1.0f, 80.0f, "ms"),
+    pfs::floatParam("CLOSED_NOISE_COLOR", "Closed Noise Color", 0.0f, 100.0f, 0.01f, 1.0f, 50.0f, "%"),
+
+    // Open Hi-Hat parameters
+    pfs::floatParam("OPEN_TONE", "Open Tone", 0.0f, 100.0f, 0.01f, 1.0f, 50.0f, "%"),
+    pfs::floatParam("OPEN_RELEASE", "Open Release", 100.0f, 1000.0f, 0.1f, 1.0f, 400.0f, "ms"),
+    pfs::floatParam("OPEN_NOISE_COLOR", "Open Noise Color", 0.0f, 100.0f, 0.01f, 1.0f, 50.0f, "%"),
+}};
+
+static_assert(pfs::hasUniqueIds(kHiHatParamSpecs), "duplicate parameter ID");
+
+using HiHatParameterSet = pfs::ParameterSet<HiHatParam, kNumHiHatParams>;
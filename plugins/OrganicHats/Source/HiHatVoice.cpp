@@ -1,21 +1,15 @@
 #include "HiHatVoice.h"
 
-HiHatVoice::HiHatVoice(juce::AudioProcessorValueTreeState& apvts)
-    : parameters(apvts)
+HiHatVoice::HiHatVoice(const HiHatParameterSet& parameterSet)
+    : params(parameterSet)
 {
 }
 
 void HiHatVoice::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
+    juce::ignoreUnused(samplesPerBlock);
     currentSampleRate = sampleRate;
 
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
-    spec.numChannels = 1;  // Per-voice mono processing
-
-    toneFilter.prepare(spec);
-    noiseColorFilter.prepare(spec);
     toneFilter.reset();
     noiseColorFilter.reset();
 
@@ -26,9 +20,7 @@ void HiHatVoice::prepareToPlay(double sampleRate, int samplesPerBlock)
 
     for (int i = 0; i < 3; ++i)
     {
-        resonators[i].prepare(spec);
-        *resonators[i].coefficients = *juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            sampleRate, peakFreqs[i], Q, juce::Decibels::decibelsToGain(gainDB));
+        resonators[i].coefficients.makePeakFilter(sampleRate, peakFreqs[i], Q, juce::Decibels::decibelsToGain(gainDB));
         resonators[i].reset();
     }
 }
@@ -52,8 +44,7 @@ void HiHatVoice::startNote(int midiNoteNumber, float velocity,
     {
         // Closed hi-hat: Short decay, no sustain
         // Read CLOSED_DECAY parameter (20-200ms)
-        auto* decayParam = parameters.getRawParameterValue("CLOSED_DECAY");
-        float decayMs = decayParam->load();
+        float decayMs = params.get(kClosedDecay);
 
         juce::ADSR::Parameters adsrParams;
         adsrParams.attack = 0.0001f;   // 0.1ms attack
@@ -67,8 +58,7 @@ void HiHatVoice::startNote(int midiNoteNumber, float velocity,
     {
         // Open hi-hat: No decay, full sustain, long release
         // Read OPEN_RELEASE parameter (100-1000ms)
-        auto* releaseParam = parameters.getRawParameterValue("OPEN_RELEASE");
-        float releaseMs = releaseParam->load();
+        float releaseMs = params.get(kOpenRelease);
 
         juce::ADSR::Parameters adsrParams;
         adsrParams.attack = 0.0001f;   // 0.1ms attack
@@ -110,12 +100,39 @@ void HiHatVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
     if (!isVoiceActive())
         return;
 
-    // Read parameters once per block (atomic reads)
-    const char* toneParamID = isClosed ? "CLOSED_TONE" : "OPEN_TONE";
-    const char* colorParamID = isClosed ? "CLOSED_NOISE_COLOR" : "OPEN_NOISE_COLOR";
+    // Read parameters once per block (cached atomic reads)
+    float toneValue = params.get(isClosed ? kClosedTone : kOpenTone) / 100.0f;  // Normalize to 0.0-1.0
+    float colorValue = params.get(isClosed ? kClosedNoiseColor : kOpenNoiseColor) / 100.0f;
+
+    // Tone Filter coefficients (brightness control) - inputs are block-constant,
+    // so compute once per block instead of once per sample
+    // Exponential frequency mapping: 3kHz-15kHz
+    float velocityToneMod = velocityGain * 0.3f;  // Up to +30% cutoff modulation
+    float baseFreq = 3000.0f * std::pow(5.0f, toneValue);
+    float finalCutoff = baseFreq * (1.0f + velocityToneMod);
+    finalCutoff = juce::jlimit(20.0f, 20000.0f, finalCutoff);
+
+    // LP below 50%, HP above 50%
+    if (toneValue < 0.5f)
+        toneFilter.coefficients.makeLowPass(currentSampleRate, finalCutoff, 0.707f);
+    else
+        toneFilter.coefficients.makeHighPass(currentSampleRate, finalCutoff, 0.707f);
 
-    float toneValue = parameters.getRawParameterValue(toneParamID)->load() / 100.0f;  // Normalize to 0.0-1.0
-    float colorValue = parameters.getRawParameterValue(colorParamID)->load() / 100.0f;
+    // Noise Color Filter coefficients (warmth control)
+    // Bypass zone at 50% ±2%
+    const bool applyNoiseColor = std::abs(colorValue - 0.5f) > 0.02f;
+    if (applyNoiseColor)
+    {
+        // Exponential frequency mapping: 5kHz-10kHz
+        float colorFreq = 5000.0f * std::pow(2.0f, (colorValue - 0.5f) * 2.0f);
+        colorFreq = juce::jlimit(20.0f, 20000.0f, colorFreq);
+
+        // LP below 50%, HP above 50%
+        if (colorValue < 0.5f)
+            noiseColorFilter.coefficients.makeLowPass(currentSampleRate, colorFreq, 0.707f);
+        else
+            noiseColorFilter.coefficients.makeHighPass(currentSampleRate, colorFreq, 0.707f);
+    }
 
     for (int sample = 0; sample < numSamples; ++sample)
     {
@@ -123,50 +140,11 @@ void HiHatVoice::renderNextBlock(juce::AudioBuffer<float>& outputBuffer,
         float noiseSample = (noiseGenerator.nextFloat() * 2.0f) - 1.0f;
 
         // 2. Apply Tone Filter (brightness control)
-        // Exponential frequency mapping: 3kHz-15kHz
-        float velocityToneMod = velocityGain * 0.3f;  // Up to +30% cutoff modulation
-        float baseFreq = 3000.0f * std::pow(5.0f, toneValue);
-        float finalCutoff = baseFreq * (1.0f + velocityToneMod);
-        finalCutoff = juce::jlimit(20.0f, 20000.0f, finalCutoff);
-
-        // Update Tone Filter coefficients (LP below 50%, HP above 50%)
-        if (toneValue < 0.5f)
-        {
-            *toneFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                currentSampleRate, finalCutoff, 0.707f);
-        }
-        else
-        {
-            *toneFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                currentSampleRate, finalCutoff, 0.707f);
-        }
-
-        // Process through Tone Filter
         noiseSample = toneFilter.processSample(noiseSample);
 
         // 3. Apply Noise Color Filter (warmth control)
-        // Bypass zone at 50% ±2%
-        if (std::abs(colorValue - 0.5f) > 0.02f)
-        {
-            // Exponential frequency mapping: 5kHz-10kHz
-            float colorFreq = 5000.0f * std::pow(2.0f, (colorValue - 0.5f) * 2.0f);
-            colorFreq = juce::jlimit(20.0f, 20000.0f, colorFreq);
-
-            // Update Noise Color Filter coefficients (LP below 50%, HP above 50%)
-            if (colorValue < 0.5f)
-            {
-                *noiseColorFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-                    currentSampleRate, colorFreq, 0.707f);
-            }
-            else
-            {
-                *noiseColorFilter.coefficients = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-                    currentSampleRate, colorFreq, 0.707f);
-            }
-
-            // Process through Noise Color Filter
+        if (applyNoiseColor)
             noiseSample = noiseColorFilter.processSample(noiseSample);
-        }
         // else: bypass (no filtering at 50%)
 
         // 4. Apply resonators (Phase 4.3) - Fixed peaks for organic body
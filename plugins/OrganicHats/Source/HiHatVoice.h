@@ -1,12 +1,15 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
+#include <pfs/RandomSeed.h>
+#include "HiHatParameters.h"
 #include "HiHatSound.h"
 
 class HiHatVoice : public juce::SynthesiserVoice
 {
 public:
-    HiHatVoice(juce::AudioProcessorValueTreeState& apvts);
+    HiHatVoice(const HiHatParameterSet& parameterSet);
 
     bool canPlaySound(juce::SynthesiserSound* sound) override;
 
@@ -24,20 +27,20 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock);
 
 private:
-    juce::AudioProcessorValueTreeState& parameters;
+    const HiHatParameterSet& params;  // Owned by the processor
 
-    // Noise generation
-    juce::Random noiseGenerator;
+    // Noise generation (one seed per voice; fixed under the golden-render harness)
+    juce::Random noiseGenerator { pfs::nextRandomSeed() };
 
     // Envelope shaping
     juce::ADSR envelope;
 
-    // Filtering (Phase 4.2)
-    juce::dsp::IIR::Filter<float> toneFilter;
-    juce::dsp::IIR::Filter<float> noiseColorFilter;
+    // Filtering (Phase 4.2) - coefficients computed in place once per block
+    pfs::Biquad toneFilter;
+    pfs::Biquad noiseColorFilter;
 
     // Resonators (Phase 4.3) - Fixed peaks for organic body
-    std::array<juce::dsp::IIR::Filter<float>, 3> resonators;
+    std::array<pfs::Biquad, 3> resonators;
 
     double currentSampleRate = 44100.0;
 
@@ -6,73 +6,16 @@
 OrganicHatsAudioProcessor::OrganicHatsAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , parameters(*this, nullptr, "PARAMETERS", createParameterLayout())
+    , parameters(*this, nullptr, "PARAMETERS", pfs::createParameterLayout(kHiHatParamSpecs))
 {
     // Add 16 voices for polyphony (8 closed + 8 open typical use)
     for (int i = 0; i < 16; ++i)
-        synth.addVoice(new HiHatVoice(parameters));
+        synth.addVoice(new HiHatVoice(params));
 
     // Add hi-hat sound descriptor
     synth.addSound(new HiHatSound());
 }
 
-juce::AudioProcessorValueTreeState::ParameterLayout OrganicHatsAudioProcessor::createParameterLayout()
-{
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    // Closed Hi-Hat parameters
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "CLOSED_TONE", 1 },
-        "Closed Tone",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f),
-        50.0f,
-        "%"
-    ));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "CLOSED_DECAY", 1 },
-        "Closed Decay",
-        juce::NormalisableRange<float>(20.0f, 200.0f, 0.1f),
-        80.0f,
-        "ms"
-    ));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "CLOSED_NOISE_COLOR", 1 },
-        "Closed Noise Color",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f),
-        50.0f,
-        "%"
-    ));
-
-    // Open Hi-Hat parameters
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "OPEN_TONE", 1 },
-        "Open Tone",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f),
-        50.0f,
-        "%"
-    ));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "OPEN_RELEASE", 1 },
-        "Open Release",
-        juce::NormalisableRange<float>(100.0f, 1000.0f, 0.1f),
-        400.0f,
-        "ms"
-    ));
-
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "OPEN_NOISE_COLOR", 1 },
-        "Open Noise Color",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.01f),
-        50.0f,
-        "%"
-    ));
-
-    return layout;
-}
-
 OrganicHatsAudioProcessor::~OrganicHatsAudioProcessor()
 {
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "HiHatParameters.h"
 
 class OrganicHatsAudioProcessor : public juce::AudioProcessor
 {
@@ -32,7 +33,8 @@ public:
     juce::AudioProcessorValueTreeState parameters;
 
 private:
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    // Resolved once from kHiHatParamSpecs, shared by every voice
+    HiHatParameterSet params { parameters, kHiHatParamSpecs };
 
     // Synthesiser for hi-hat voice management
     juce::Synthesiser synth;
@@ -61,6 +61,7 @@ ScatterAudioProcessorEditor::ScatterAudioProcessorEditor(ScatterAudioProcessor&
     setSize(550, 600);
 
     // Phase 4.2: Start timer for grain visualization updates (30Hz = ~33ms interval)
+    processorRef.clearGrainSnapshots();
     startTimer(33);
 }
 
@@ -130,21 +131,21 @@ ScatterAudioProcessorEditor::getResource(const juce::String& url)
 
 void ScatterAudioProcessorEditor::timerCallback()
 {
-    // Get active grain positions from processor (thread-safe read)
-    auto grainData = processorRef.getActiveGrainPositions();
+    // Get the newest grain snapshot from the processor (lock-free telemetry)
+    processorRef.getActiveGrainPositions(grainSnapshot);
 
     // Build JSON array for JavaScript
     juce::String jsonData = "[";
 
-    for (size_t i = 0; i < grainData.size(); ++i)
+    for (int i = 0; i < grainSnapshot.numGrains; ++i)
     {
-        const auto& grain = grainData[i];
+        const auto& grain = grainSnapshot.grains[static_cast<size_t>(i)];
 
         jsonData += "{\"x\":" + juce::String(grain.x, 4)
                  + ",\"y\":" + juce::String(grain.y, 4)
                  + ",\"pan\":" + juce::String(grain.pan, 4) + "}";
 
-        if (i < grainData.size() - 1)
+        if (i < grainSnapshot.numGrains - 1)
             jsonData += ",";
     }
 
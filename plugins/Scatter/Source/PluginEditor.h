@@ -19,6 +19,9 @@ private:
 private:
     ScatterAudioProcessor& processorRef;
 
+    // Phase 4.2: Last grain snapshot (kept while no audio is processed)
+    ScatterAudioProcessor::GrainSnapshot grainSnapshot;
+
     // CRITICAL: Member declaration order (Pattern #11)
     // Relays → WebView → Attachments (destroyed in reverse order)
 
@@ -2,97 +2,13 @@
 #include "PluginEditor.h"
 #include <cmath>
 
-juce::AudioProcessorValueTreeState::ParameterLayout ScatterAudioProcessor::createParameterLayout()
-{
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    // delay_time - Float (100.0 to 2000.0 ms, default: 500.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "delay_time", 1 },
-        "Delay Time",
-        juce::NormalisableRange<float>(100.0f, 2000.0f, 1.0f, 1.0f),
-        500.0f,
-        "ms"
-    ));
-
-    // grain_size - Float (5.0 to 500.0 ms, default: 100.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "grain_size", 1 },
-        "Grain Size",
-        juce::NormalisableRange<float>(5.0f, 500.0f, 1.0f, 1.0f),
-        100.0f,
-        "ms"
-    ));
-
-    // density - Float (0.0 to 100.0 %, default: 50.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "density", 1 },
-        "Density",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        50.0f,
-        "%"
-    ));
-
-    // pitch_random - Float (0.0 to 100.0 %, default: 30.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "pitch_random", 1 },
-        "Pitch Random",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        30.0f,
-        "%"
-    ));
-
-    // scale - Choice (Chromatic, Major, Minor, Pentatonic, Blues)
-    layout.add(std::make_unique<juce::AudioParameterChoice>(
-        juce::ParameterID { "scale", 1 },
-        "Scale",
-        juce::StringArray { "Chromatic", "Major", "Minor", "Pentatonic", "Blues" },
-        0
-    ));
-
-    // root_note - Choice (C, C#, D, D#, E, F, F#, G, G#, A, A#, B)
-    layout.add(std::make_unique<juce::AudioParameterChoice>(
-        juce::ParameterID { "root_note", 1 },
-        "Root Note",
-        juce::StringArray { "C", "C#", "D", "D#", "E", "F", "F#", "G", "G#", "A", "A#", "B" },
-        0
-    ));
-
-    // pan_random - Float (0.0 to 100.0 %, default: 75.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "pan_random", 1 },
-        "Pan Random",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        75.0f,
-        "%"
-    ));
-
-    // feedback - Float (0.0 to 100.0 %, default: 30.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "feedback", 1 },
-        "Feedback",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        30.0f,
-        "%"
-    ));
-
-    // mix - Float (0.0 to 100.0 %, default: 50.0)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "mix", 1 },
-        "Mix",
-        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f, 1.0f),
-        50.0f,
-        "%"
-    ));
-
-    return layout;
-}
+static_assert(pfs::hasUniqueIds(ScatterAudioProcessor::kParamSpecs), "duplicate parameter ID");
 
 ScatterAudioProcessor::ScatterAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withInput("Input", juce::AudioChannelSet::stereo(), true)
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , parameters(*this, nullptr, "Parameters", createParameterLayout())
+    , parameters(*this, nullptr, "Parameters", pfs::createParameterLayout(kParamSpecs))
 {
     // Phase 3.2: Initialize scale lookup tables
     initializeScaleTables();
@@ -106,6 +22,7 @@ void ScatterAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
 {
     // Store sample rate for grain size calculations
     currentSampleRate = sampleRate;
+    params.prepare(sampleRate);
 
     // Prepare DSP spec
     spec.sampleRate = sampleRate;
@@ -156,28 +73,22 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     for (int i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
-    // Read parameters (atomic, real-time safe)
-    auto* delayTimeParam = parameters.getRawParameterValue("delay_time");
-    auto* grainSizeParam = parameters.getRawParameterValue("grain_size");
-    auto* densityParam = parameters.getRawParameterValue("density");
-    auto* pitchRandomParam = parameters.getRawParameterValue("pitch_random");
-    auto* scaleParam = parameters.getRawParameterValue("scale");
-    auto* rootNoteParam = parameters.getRawParameterValue("root_note");
-    auto* panRandomParam = parameters.getRawParameterValue("pan_random");
-    auto* feedbackParam = parameters.getRawParameterValue("feedback");
-    auto* mixParam = parameters.getRawParameterValue("mix");
-
-    float delayTimeMs = delayTimeParam->load();
-    float grainSizeMs = grainSizeParam->load();
-    float densityPercent = densityParam->load();
-    float pitchRandomPercent = pitchRandomParam->load();
-    int scaleIndex = static_cast<int>(scaleParam->load());
-    int rootNote = static_cast<int>(rootNoteParam->load());
-    float panRandomPercent = panRandomParam->load();
-    float feedbackGain = feedbackParam->load() / 100.0f * 0.95f;  // Map 0-100% to 0.0-0.95
-    float mixValue = mixParam->load() / 100.0f;  // Map 0-100% to 0.0-1.0
-
     const int numSamples = buffer.getNumSamples();
+
+    // Read parameters (cached atomics, real-time safe)
+    float grainSizeMs = params.get(kGrainSize);
+    float densityPercent = params.get(kDensity);
+    float pitchRandomPercent = params.get(kPitchRandom);
+    int scaleIndex = params.getChoice(kScale);
+    int rootNote = params.getChoice(kRootNote);
+    float panRandomPercent = params.get(kPanRandom);
+    float mixValue = params.get(kMix) / 100.0f;  // Map 0-100% to 0.0-1.0
+
+    // Feedback glides over 20 ms: a jump in a recirculating path clicks on every repeat
+    const auto feedbackRamp = params.getRamp(kFeedback, numSamples);
+    const float feedbackGainStart = feedbackRamp.start / 100.0f * 0.95f;  // Map 0-100% to 0.0-0.95
+    const float feedbackGainStep = feedbackRamp.getStep() / 100.0f * 0.95f;
+
     const int numChannels = buffer.getNumChannels();
 
     // Phase 3.3: Step 1 - Capture dry signal
@@ -222,13 +133,16 @@ void ScatterAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
 
         for (int sample = 0; sample < numSamples; ++sample)
         {
-            feedbackData[sample] = wetData[sample] * feedbackGain;
+            feedbackData[sample] = wetData[sample] * (feedbackGainStart + feedbackGainStep * static_cast<float>(sample));
         }
     }
 
     // Phase 3.3: Step 7 - Blend with dry signal using dry/wet mixer
     dryWetMixer.setWetMixProportion(mixValue);
     dryWetMixer.mixWetSamples(block);
+
+    // Phase 4.2: Grain positions for the visualization
+    publishGrainSnapshot();
 }
 
 juce::AudioProcessorEditor* ScatterAudioProcessor::createEditor()
@@ -260,16 +174,15 @@ juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter()
 // Phase 4.2: Grain Visualization Data Accessor
 // ============================================================================
 
-std::vector<ScatterAudioProcessor::GrainVisualizationData> ScatterAudioProcessor::getActiveGrainPositions() const
+void ScatterAudioProcessor::publishGrainSnapshot()
 {
-    std::vector<GrainVisualizationData> data;
+    grainSnapshot.numGrains = 0;
 
-    // Copy active grain positions (thread-safe read - audio thread writes, message thread reads)
     for (const auto& grain : grainVoices)
     {
         if (grain.active)
         {
-            GrainVisualizationData vizData;
+            auto& vizData = grainSnapshot.grains[static_cast<size_t>(grainSnapshot.numGrains++)];
 
             // X-axis: Normalized time position in delay buffer (0.0-1.0)
             vizData.x = grain.readPosition / static_cast<float>(currentDelayBufferSize);
@@ -282,12 +195,15 @@ std::vector<ScatterAudioProcessor::GrainVisualizationData> ScatterAudioProcessor
 
             // Pan position (already 0.0-1.0)
             vizData.pan = grain.pan;
-
-            data.push_back(vizData);
         }
     }
 
-    return data;
+    grainTelemetry.publish(grainSnapshot);
+}
+
+bool ScatterAudioProcessor::getActiveGrainPositions(GrainSnapshot& snapshot)
+{
+    return grainTelemetry.readLatest(snapshot);
 }
 
 // ============================================================================
@@ -1,6 +1,8 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Parameters.h>
+#include <pfs/Telemetry.h>
 #include <array>
 #include <vector>
 
@@ -32,8 +34,31 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // Parameter table: builds the layout and the cached atomic pointers below
+    enum Param
+    {
+        kDelayTime, kGrainSize, kDensity, kPitchRandom, kScale, kRootNote,
+        kPanRandom, kFeedback, kMix, kNumParams
+    };
+
+    static constexpr std::array<pfs::ParamSpec, kNumParams> kParamSpecs {{
+        pfs::floatParam("delay_time", "Delay Time", 100.0f, 2000.0f, 1.0f, 1.0f, 500.0f, "ms"),
+        pfs::floatParam("grain_size", "Grain Size", 5.0f, 500.0f, 1.0f, 1.0f, 100.0f, "ms"),
+        pfs::floatParam("density", "Density", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f, "%"),
+        pfs::floatParam("pitch_random", "Pitch Random", 0.0f, 100.0f, 0.1f, 1.0f, 30.0f, "%"),
+        pfs::choiceParam("scale", "Scale", "Chromatic|Major|Minor|Pentatonic|Blues", 0),
+        pfs::choiceParam("root_note", "Root Note", "C|C#|D|D#|E|F|F#|G|G#|A|A#|B", 0),
+        pfs::floatParam("pan_random", "Pan Random", 0.0f, 100.0f, 0.1f, 1.0f, 75.0f, "%"),
+        // feedback glides over 20 ms (applied per sample in the feedback path)
+        pfs::floatParam("feedback", "Feedback", 0.0f, 100.0f, 0.1f, 1.0f, 30.0f, "%", 0.02f),
+        pfs::floatParam("mix", "Mix", 0.0f, 100.0f, 0.1f, 1.0f, 50.0f, "%"),
+    }};
+
     juce::AudioProcessorValueTreeState parameters;
 
+    // Grain voice pool size (64 pre-allocated voices)
+    static constexpr int maxGrainVoices = 64;
+
     // Phase 4.2: Grain visualization data structure
     struct GrainVisualizationData
     {
@@ -42,11 +67,23 @@ public:
         float pan;    // Pan position (0.0-1.0)
     };
 
-    // Phase 4.2: Public accessor for grain positions (thread-safe read)
-    std::vector<GrainVisualizationData> getActiveGrainPositions() const;
+    // Every active grain at the end of one block (fixed size, no allocation)
+    struct GrainSnapshot
+    {
+        int numGrains = 0;
+        std::array<GrainVisualizationData, maxGrainVoices> grains {};
+    };
+
+    // Phase 4.2: Newest snapshot published by the audio thread. Returns false
+    // (snapshot untouched) if no block ran since the last call. Message thread only.
+    bool getActiveGrainPositions(GrainSnapshot& snapshot);
+
+    // Drops snapshots queued while the editor was closed
+    void clearGrainSnapshots() { grainTelemetry.clear(); }
 
 private:
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    // Resolved once from kParamSpecs (no string lookups in processBlock)
+    pfs::ParameterSet<Param, kNumParams> params { parameters, kParamSpecs };
 
     // Phase 3.1: Core Granular Engine Components
 
@@ -68,10 +105,13 @@ private:
     // Granular delay buffer (Lagrange3rd interpolation for future pitch shifting)
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> delayBuffer;
 
-    // Grain voice pool (64 pre-allocated voices)
-    static constexpr int maxGrainVoices = 64;
+    // Grain voice pool
     std::array<GrainVoice, maxGrainVoices> grainVoices;
 
+    // Phase 4.2: Grain positions for the editor, one snapshot per block
+    GrainSnapshot grainSnapshot;                                  // audio thread only
+    pfs::TelemetryChannel<GrainSnapshot, 64> grainTelemetry;
+
     // Grain scheduler state
     int grainSpawnCounter = 0;         // Sample counter for grain spawning
     int lastGrainSpawnInterval = 0;    // Cached spawn interval
@@ -96,6 +136,7 @@ private:
     void spawnNewGrain(float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote);
     void updateGrainScheduler(float densityPercent, float grainSizeMs, float pitchRandomPercent, float panRandomPercent, int scaleIndex, int rootNote);
     void processGrainVoices(juce::AudioBuffer<float>& buffer);
+    void publishGrainSnapshot();
     void generateHannWindow(int sizeInSamples);
     void initializeScaleTables();
     int quantizePitchToScale(float pitchSemitones, int scaleIndex, int rootNote);
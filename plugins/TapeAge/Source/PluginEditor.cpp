@@ -75,7 +75,9 @@ TapeAgeAudioProcessorEditor::TapeAgeAudioProcessorEditor(TapeAgeAudioProcessor&
     // Set editor size to match mockup dimensions (500x450 from v3-ui.html)
     setSize(500, 450);
 
-    // Phase 5.2: Start timer for VU meter updates (30 FPS)
+    // Phase 5.2: Start timer for VU meter updates (30 FPS), skipping levels
+    // queued while the editor was closed
+    processorRef.levelTelemetry.clear();
     startTimerHz(30);
 }
 
@@ -100,8 +102,17 @@ void TapeAgeAudioProcessorEditor::resized()
 void TapeAgeAudioProcessorEditor::timerCallback()
 {
     // Phase 5.2: Send VU meter updates to JavaScript
-    // Read peak level from audio processor (atomic, thread-safe)
-    float dbLevel = processorRef.outputLevel.load(std::memory_order_relaxed);
+    // Loudest block since the last tick; holds the last level while no audio is processed
+    float peakLevel = 0.0f;
+    const int numFrames = processorRef.levelTelemetry.drain([&peakLevel](const TapeAgeAudioProcessor::LevelFrame& frame) {
+        peakLevel = std::max(peakLevel, frame.peak);
+    });
+
+    // Convert to dB (clamp to -100dB minimum to avoid log(0))
+    if (numFrames > 0)
+        lastLevelDb = peakLevel > 0.00001f ? juce::Decibels::gainToDecibels(peakLevel) : -100.0f;
+
+    float dbLevel = lastLevelDb;
 
     // Emit event to JavaScript (only if WebView is visible)
     webView->emitEventIfBrowserIsVisible("updateVUMeter", dbLevel);
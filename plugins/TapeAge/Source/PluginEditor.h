@@ -16,6 +16,9 @@ public:
 private:
     TapeAgeAudioProcessor& processorRef;
 
+    // Phase 5.2: Last VU level sent to JavaScript (dB, timer thread only)
+    float lastLevelDb = -100.0f;
+
     // ⚠️ CRITICAL: Member declaration order prevents release build crashes
     // Destruction happens in REVERSE order of declaration
     // Order: Relays → WebView → Attachments
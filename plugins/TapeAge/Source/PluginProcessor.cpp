@@ -1,64 +1,22 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 
-juce::AudioProcessorValueTreeState::ParameterLayout TapeAgeAudioProcessor::createParameterLayout()
-{
-    juce::AudioProcessorValueTreeState::ParameterLayout layout;
-
-    // input - Input gain trim (-12dB to +12dB)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "input", 1 },
-        "Input",
-        juce::NormalisableRange<float>(-12.0f, 12.0f, 0.1f, 1.0f),  // -12dB to +12dB, linear
-        0.0f  // Default: 0dB (unity gain)
-    ));
-
-    // drive - Tape saturation amount
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "drive", 1 },
-        "Drive",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.001f, 1.0f),  // 0-100%, linear
-        0.5f  // Default: 50%
-    ));
-
-    // age - Tape degradation amount
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "age", 1 },
-        "Age",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.001f, 1.0f),  // 0-100%, linear
-        0.25f  // Default: 25%
-    ));
-
-    // mix - Dry/wet blend
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "mix", 1 },
-        "Mix",
-        juce::NormalisableRange<float>(0.0f, 1.0f, 0.001f, 1.0f),  // 0-100%, linear
-        1.0f  // Default: 100% wet
-    ));
-
-    // output - Output gain trim (-12dB to +12dB)
-    layout.add(std::make_unique<juce::AudioParameterFloat>(
-        juce::ParameterID { "output", 1 },
-        "Output",
-        juce::NormalisableRange<float>(-12.0f, 12.0f, 0.1f, 1.0f),  // -12dB to +12dB, linear
-        0.0f  // Default: 0dB (unity gain)
-    ));
-
-    return layout;
-}
+static_assert(pfs::hasUniqueIds(TapeAgeAudioProcessor::kParamSpecs), "duplicate parameter ID");
 
 TapeAgeAudioProcessor::TapeAgeAudioProcessor()
     : AudioProcessor(BusesProperties()
                         .withInput("Input", juce::AudioChannelSet::stereo(), true)
                         .withOutput("Output", juce::AudioChannelSet::stereo(), true))
-    , oversampler(2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple)  // 2x oversampling, 1 stage, FIR filters
-    , parameters(*this, nullptr, "Parameters", createParameterLayout())
+    , parameters(*this, nullptr, "Parameters", pfs::createParameterLayout(kParamSpecs))
 {
+    parameters.addParameterListener(kParamSpecs[kOsFilter].id, &oversamplingRebuilder);
+    oversamplingRebuilder.startTimer(50);
 }
 
 TapeAgeAudioProcessor::~TapeAgeAudioProcessor()
 {
+    oversamplingRebuilder.stopTimer();
+    parameters.removeParameterListener(kParamSpecs[kOsFilter].id, &oversamplingRebuilder);
 }
 
 void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -68,10 +26,7 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
     currentSpec.maximumBlockSize = static_cast<juce::uint32>(samplesPerBlock);
     currentSpec.numChannels = static_cast<juce::uint32>(getTotalNumOutputChannels());
     currentSampleRate = sampleRate;
-
-    // Phase 4.1: Prepare oversampling engine
-    oversampler.initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampler.reset();
+    params.prepare(sampleRate);
 
     // Phase 4.2: Prepare wow/flutter modulation
     // 200ms delay line buffer for pitch modulation (architecture.md line 28)
@@ -101,23 +56,51 @@ void TapeAgeAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock
 
     // v1.1.0: Prepare age-dependent high-frequency rolloff filters
     for (int i = 0; i < 2; ++i)
-    {
-        ageFilter[i].prepare(currentSpec);
         ageFilter[i].reset();
-        // Initialize with 20kHz lowpass (transparent at age=0)
-        auto coefficients = juce::dsp::IIR::Coefficients<float>::makeFirstOrderLowPass(sampleRate, 20000.0f);
-        ageFilter[i].coefficients = coefficients;
-    }
+
+    // Initialize with 20kHz lowpass (transparent at age=0)
+    ageCoefficients.makeFirstOrderLowPass(sampleRate, 20000.0);
 
     // Phase 4.4: Prepare dry/wet mixer
     dryWetMixer.prepare(currentSpec);
-    dryWetMixer.reset();
+
+    // Phase 4.1: Prepare oversampling engine (also sets the wet latency)
+    prepareOversampling(selectOversamplingFilter());
+}
+
+pfs::HalfbandFilter TapeAgeAudioProcessor::selectOversamplingFilter() const
+{
+    return params.getChoice(kOsFilter) == 1 ? pfs::HalfbandFilter::LowLatency : pfs::HalfbandFilter::LinearPhase;
+}
+
+void TapeAgeAudioProcessor::prepareOversampling(pfs::HalfbandFilter filter)
+{
+    oversampler.prepare(static_cast<int>(currentSpec.numChannels), 1, filter,
+                        static_cast<int>(currentSpec.maximumBlockSize));
+    oversamplerPrepared = true;
 
     // Set wet latency to compensate for oversampler + delay line latency
-    int oversamplerLatency = static_cast<int>(oversampler.getLatencyInSamples());
-    int delayLineLatency = static_cast<int>(sampleRate * 0.1);  // 100ms base delay from wow/flutter
-    int totalWetLatency = oversamplerLatency + delayLineLatency;
-    dryWetMixer.setWetLatency(static_cast<float>(totalWetLatency));
+    // (the IIR's is fractional)
+    const float oversamplerLatency = static_cast<float>(oversampler.getLatencyInSamples());
+    int delayLineLatency = static_cast<int>(currentSampleRate * 0.1);  // 100ms base delay from wow/flutter
+    dryWetMixer.setWetLatency(oversamplerLatency + static_cast<float>(delayLineLatency));
+    dryWetMixer.reset();
+}
+
+void TapeAgeAudioProcessor::rebuildOversampling()
+{
+    // Offline renders switch inside processBlock(); before the first
+    // prepareToPlay() there is nothing to rebuild
+    if (isNonRealtime() || !oversamplerPrepared)
+        return;
+
+    // suspendProcessing() takes the callback lock, so processBlock() is not
+    // running while the oversampler reallocates
+    suspendProcessing(true);
+    const auto filter = selectOversamplingFilter();
+    if (filter != oversampler.getFilter())
+        prepareOversampling(filter);
+    suspendProcessing(false);
 }
 
 void TapeAgeAudioProcessor::releaseResources()
@@ -138,14 +121,20 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     for (int i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
         buffer.clear(i, 0, buffer.getNumSamples());
 
+    // Oversampling filter change during a non-realtime render: no deadline,
+    // so re-prepare in place (live changes go through rebuildOversampling())
+    if (isNonRealtime() && selectOversamplingFilter() != oversampler.getFilter())
+        prepareOversampling(selectOversamplingFilter());
+
     // INPUT GAIN: Apply input trim FIRST (before any processing)
-    auto* inputParam = parameters.getRawParameterValue("input");
-    float inputDB = inputParam->load();
-    float inputGain = juce::Decibels::decibelsToGain(inputDB);
+    // Ramped over 20 ms so knob moves don't zipper
+    const auto inputRamp = params.getRamp(kInput, buffer.getNumSamples());
+    const float inputGainStart = juce::Decibels::decibelsToGain(inputRamp.start);
+    const float inputGainEnd = juce::Decibels::decibelsToGain(inputRamp.end);
 
-    if (inputGain != 1.0f)  // Only apply if not unity gain (optimization)
+    if (inputGainStart != 1.0f || inputGainEnd != 1.0f)  // Only apply if not unity gain (optimization)
     {
-        buffer.applyGain(inputGain);
+        buffer.applyGainRamp(0, buffer.getNumSamples(), inputGainStart, inputGainEnd);
     }
 
     // Phase 4.4: Store dry signal AFTER input gain
@@ -153,8 +142,7 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     dryWetMixer.pushDrySamples(block);
 
     // Read mix parameter (0.0 = fully dry, 1.0 = fully wet)
-    auto* mixParam = parameters.getRawParameterValue("mix");
-    float mixValue = mixParam->load();
+    float mixValue = params.get(kMix);
     dryWetMixer.setWetMixProportion(mixValue);
 
     // Phase 4.1: Core Saturation Processing
@@ -165,8 +153,7 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // 4. Downsample
 
     // Read drive parameter (0.0 to 1.0)
-    auto* driveParam = parameters.getRawParameterValue("drive");
-    float drive = driveParam->load();
+    float drive = params.get(kDrive);
 
     // Progressive curve mapping (architecture.md):
     // 0-30%: Very subtle (multiply by 1-2 before tanh)
@@ -190,7 +177,7 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     }
 
     // Upsample
-    auto oversampledBlock = oversampler.processSamplesUp(block);
+    float* const* oversampled = oversampler.processUp(buffer.getArrayOfReadPointers(), buffer.getNumSamples());
 
     // Apply tanh saturation manually in oversampled domain
     // Calculate makeup gain to compensate for volume increase (v1.1.0)
@@ -198,23 +185,24 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     // This keeps perceived loudness roughly constant
     float makeupGain = 1.0f / std::sqrt(gain);
 
-    for (size_t channel = 0; channel < oversampledBlock.getNumChannels(); ++channel)
+    // Block tanh (pfs::math: vectorised when TapeAge is built with fast maths)
+    const int numOversampledSamples = buffer.getNumSamples() * oversampler.getFactor();
+
+    for (int channel = 0; channel < oversampler.getNumChannels(); ++channel)
     {
-        auto* channelData = oversampledBlock.getChannelPointer(channel);
-        for (size_t sample = 0; sample < oversampledBlock.getNumSamples(); ++sample)
-        {
-            channelData[sample] = std::tanh(gain * channelData[sample]) * makeupGain;
-        }
+        auto* channelData = oversampled[channel];
+        juce::FloatVectorOperations::multiply(channelData, gain, numOversampledSamples);
+        pfs::math::tanh(channelData, channelData, numOversampledSamples);
+        juce::FloatVectorOperations::multiply(channelData, makeupGain, numOversampledSamples);
     }
 
     // Downsample back to original sample rate
-    oversampler.processSamplesDown(block);
+    oversampler.processDown(buffer.getArrayOfWritePointers(), buffer.getNumSamples());
 
     // Phase 4.2: Wow/Flutter Modulation
     // Processing chain: Apply pitch modulation via delay line after saturation
     // Read age parameter (0.0 to 1.0)
-    auto* ageParam = parameters.getRawParameterValue("age");
-    float age = ageParam->load();
+    float age = params.get(kAge);
 
     // Calculate LFO modulation depth based on age
     // v1.1.0: Enhanced wow depth - ±25 cents at max age (was ±10 cents)
@@ -241,35 +229,49 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     {
         auto* channelData = buffer.getWritePointer(channel);
 
-        for (int sample = 0; sample < numSamples; ++sample)
+        // LFO phases are laid out per chunk so both sines run as block calls
+        for (int chunkStart = 0; chunkStart < numSamples; chunkStart += lfoChunkSize)
         {
-            // Calculate primary wow LFO (sine wave)
-            float lfoValue = std::sin(lfoPhase[channel]);
+            const int chunkSize = juce::jmin(lfoChunkSize, numSamples - chunkStart);
+            float lfoValues[lfoChunkSize];
+            float flutterValues[lfoChunkSize];
+
+            for (int i = 0; i < chunkSize; ++i)
+            {
+                lfoValues[i] = lfoPhase[channel];
+                flutterValues[i] = flutterPhase[channel];
 
-            // v1.1.0: Calculate secondary flutter LFO and combine
-            float flutterValue = std::sin(flutterPhase[channel]);
-            float combinedModulation = lfoValue + (flutterValue * flutterDepthRatio);
+                // Advance LFO phases
+                lfoPhase[channel] += lfoPhaseIncrement;
+                if (lfoPhase[channel] >= juce::MathConstants<float>::twoPi)
+                    lfoPhase[channel] -= juce::MathConstants<float>::twoPi;
 
-            // Calculate delay time in samples
-            // Base delay at center of buffer (100ms) + combined modulation
-            float baseDelaySamples = static_cast<float>(currentSampleRate) * 0.1f;  // 100ms center
-            float modulationSamples = combinedModulation * modulationDepth * baseDelaySamples;
-            float totalDelay = baseDelaySamples + modulationSamples;
+                flutterPhase[channel] += flutterPhaseIncrement;
+                if (flutterPhase[channel] >= juce::MathConstants<float>::twoPi)
+                    flutterPhase[channel] -= juce::MathConstants<float>::twoPi;
+            }
 
-            // Push input sample to delay line
-            delayLine.pushSample(channel, channelData[sample]);
+            // Primary wow LFO and v1.1.0 secondary flutter LFO (sine waves)
+            pfs::math::sin(lfoValues, lfoValues, chunkSize);
+            pfs::math::sin(flutterValues, flutterValues, chunkSize);
 
-            // Read modulated sample from delay line
-            channelData[sample] = delayLine.popSample(channel, totalDelay);
+            for (int i = 0; i < chunkSize; ++i)
+            {
+                const int sample = chunkStart + i;
+                float combinedModulation = lfoValues[i] + (flutterValues[i] * flutterDepthRatio);
 
-            // Advance LFO phases
-            lfoPhase[channel] += lfoPhaseIncrement;
-            if (lfoPhase[channel] >= juce::MathConstants<float>::twoPi)
-                lfoPhase[channel] -= juce::MathConstants<float>::twoPi;
+                // Calculate delay time in samples
+                // Base delay at center of buffer (100ms) + combined modulation
+                float baseDelaySamples = static_cast<float>(currentSampleRate) * 0.1f;  // 100ms center
+                float modulationSamples = combinedModulation * modulationDepth * baseDelaySamples;
+                float totalDelay = baseDelaySamples + modulationSamples;
 
-            flutterPhase[channel] += flutterPhaseIncrement;
-            if (flutterPhase[channel] >= juce::MathConstants<float>::twoPi)
-                flutterPhase[channel] -= juce::MathConstants<float>::twoPi;
+                // Push input sample to delay line
+                delayLine.pushSample(channel, channelData[sample]);
+
+                // Read modulated sample from delay line
+                channelData[sample] = delayLine.popSample(channel, totalDelay);
+            }
         }
     }
 
@@ -280,19 +282,11 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         // Exponential mapping for musical response: 20kHz -> 8kHz
         float cutoffFrequency = 20000.0f * std::pow(0.4f, age);  // 0.4^1 = 0.4, so 20kHz * 0.4 = 8kHz at age=1
 
-        // Update filter coefficients if cutoff changed significantly
-        auto coefficients = juce::dsp::IIR::Coefficients<float>::makeFirstOrderLowPass(currentSampleRate, cutoffFrequency);
+        // Update filter coefficients in place (no allocation on the audio thread)
+        ageCoefficients.makeFirstOrderLowPass(currentSampleRate, cutoffFrequency);
 
-        for (int channel = 0; channel < numChannels; ++channel)
-        {
-            ageFilter[channel].coefficients = coefficients;
-            auto* channelData = buffer.getWritePointer(channel);
-
-            for (int sample = 0; sample < numSamples; ++sample)
-            {
-                channelData[sample] = ageFilter[channel].processSample(channelData[sample]);
-            }
-        }
+        for (int channel = 0; channel < juce::jmin(numChannels, 2); ++channel)
+            ageFilter[channel].process(buffer.getWritePointer(channel), numSamples, ageCoefficients);
     }
 
     // Phase 4.3: Degradation Features (Dropout + Noise)
@@ -421,13 +415,13 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
     dryWetMixer.mixWetSamples(block);
 
     // OUTPUT GAIN: Apply output trim LAST (after all processing and mixing)
-    auto* outputParam = parameters.getRawParameterValue("output");
-    float outputDB = outputParam->load();
-    float outputGain = juce::Decibels::decibelsToGain(outputDB);
+    const auto outputRamp = params.getRamp(kOutput, numSamples);
+    const float outputGainStart = juce::Decibels::decibelsToGain(outputRamp.start);
+    const float outputGainEnd = juce::Decibels::decibelsToGain(outputRamp.end);
 
-    if (outputGain != 1.0f)  // Only apply if not unity gain (optimization)
+    if (outputGainStart != 1.0f || outputGainEnd != 1.0f)  // Only apply if not unity gain (optimization)
     {
-        buffer.applyGain(outputGain);
+        buffer.applyGainRamp(0, numSamples, outputGainStart, outputGainEnd);
     }
 
     // Phase 5.2: Calculate peak level for VU meter (AFTER output gain)
@@ -438,11 +432,7 @@ void TapeAgeAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce:
         peakLevel = std::max(peakLevel, channelPeak);
     }
 
-    // Convert to dB and store atomically (clamp to -100dB minimum to avoid log(0))
-    float peakDb = peakLevel > 0.00001f
-        ? juce::Decibels::gainToDecibels(peakLevel)
-        : -100.0f;
-    outputLevel.store(peakDb, std::memory_order_relaxed);
+    levelTelemetry.publish({ peakLevel });
 }
 
 juce::AudioProcessorEditor* TapeAgeAudioProcessor::createEditor()
@@ -475,14 +465,10 @@ void TapeAgeAudioProcessor::setStateInformation(const void* data, int sizeInByte
         parameters.replaceState(juce::ValueTree::fromXml(*xmlState));
 
         // Log parameter values after restoration
-        auto* driveParam = parameters.getRawParameterValue("drive");
-        auto* ageParam = parameters.getRawParameterValue("age");
-        auto* mixParam = parameters.getRawParameterValue("mix");
-
         debugLog.appendText(
-            "  Parameters after restore - Drive: " + juce::String(driveParam->load()) +
-            ", Age: " + juce::String(ageParam->load()) +
-            ", Mix: " + juce::String(mixParam->load()) + "\n");
+            "  Parameters after restore - Drive: " + juce::String(params.get(kDrive)) +
+            ", Age: " + juce::String(params.get(kAge)) +
+            ", Mix: " + juce::String(params.get(kMix)) + "\n");
     }
 }
 
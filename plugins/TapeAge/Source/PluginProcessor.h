@@ -1,6 +1,12 @@
 #pragma once
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <pfs/Biquad.h>
+#include <pfs/FastMath.h>
+#include <pfs/Oversampler.h>
+#include <pfs/Parameters.h>
+#include <pfs/RandomSeed.h>
+#include <pfs/Telemetry.h>
 
 class TapeAgeAudioProcessor : public juce::AudioProcessor
 {
@@ -30,24 +36,48 @@ public:
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // Parameter table: builds the layout and the cached atomic pointers below
+    enum Param { kInput, kDrive, kAge, kMix, kOutput, kOsFilter, kNumParams };
+
+    static constexpr std::array<pfs::ParamSpec, kNumParams> kParamSpecs {{
+        // input/output trims (dB) glide over 20 ms; drive/age/mix are 0..1
+        pfs::floatParam("input", "Input", -12.0f, 12.0f, 0.1f, 1.0f, 0.0f, "", 0.02f),
+        pfs::floatParam("drive", "Drive", 0.0f, 1.0f, 0.001f, 1.0f, 0.5f),
+        pfs::floatParam("age", "Age", 0.0f, 1.0f, 0.001f, 1.0f, 0.25f),
+        pfs::floatParam("mix", "Mix", 0.0f, 1.0f, 0.001f, 1.0f, 1.0f),
+        pfs::floatParam("output", "Output", -12.0f, 12.0f, 0.1f, 1.0f, 0.0f, "", 0.02f),
+        // oversampling halfbands: linear-phase FIR or low-latency IIR
+        pfs::choiceParam("osFilter", "OS Filter", "Linear Phase|Low Latency", 0),
+    }};
+
     // Public access to parameters (needed by PluginEditor for WebView attachments)
     juce::AudioProcessorValueTreeState parameters;
 
     // Phase 5.2: Output Level Metering (public for PluginEditor access)
-    std::atomic<float> outputLevel { -100.0f };  // Peak level in dB (initialized to silence)
+    // One frame per block; the editor timer takes the loudest since its last tick
+    struct LevelFrame
+    {
+        float peak = 0.0f;  // Linear peak after output gain, all channels
+    };
+
+    pfs::TelemetryChannel<LevelFrame> levelTelemetry;
 
 private:
     // DSP Components (declared BEFORE parameters for initialization order)
     juce::dsp::ProcessSpec currentSpec;
 
     // Phase 4.1: Core Saturation Processing
-    juce::dsp::Oversampling<float> oversampler { 2, 1, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple };
+    // 2x around the tanh; halfbands from the "osFilter" choice. Re-preparing
+    // allocates, so a change is applied by OversamplingRebuilder.
+    pfs::Oversampler oversampler;
+    bool oversamplerPrepared { false };
 
     // Phase 4.2: Wow/Flutter Modulation
     juce::dsp::DelayLine<float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd> delayLine;
     float lfoPhase[2] { 0.0f, 0.0f };  // Separate phase per channel for stereo width
     float flutterPhase[2] { 0.0f, 0.0f };  // Secondary flutter LFO phase per channel (v1.1.0)
-    juce::Random random;
+    static constexpr int lfoChunkSize = 64;  // LFO values evaluated per block sin call
+    juce::Random random { pfs::nextRandomSeed() };
     double currentSampleRate { 44100.0 };
 
     // Phase 4.3: Degradation Features (Dropout + Noise + High-frequency Rolloff)
@@ -56,13 +86,47 @@ private:
     int dropoutSamplesRemaining { 0 };  // Current dropout duration
     float dropoutEnvelope { 1.0f };  // Smooth attack/release (1.0 = no attenuation)
     float noiseFilterState[2] { 0.0f, 0.0f };  // One-pole lowpass filter state per channel
-    juce::dsp::IIR::Filter<float> ageFilter[2];  // High-frequency rolloff per channel (v1.1.0)
+    pfs::BiquadCoefficients ageCoefficients;  // High-frequency rolloff, shared by both channels (v1.1.0)
+    pfs::BiquadState ageFilter[2];  // High-frequency rolloff state per channel
 
     // Phase 4.4: Dry/Wet Mixing
     juce::dsp::DryWetMixer<float> dryWetMixer { 20000 };  // Max latency: 192kHz * 0.1s delay line + oversampler
 
-    // Parameter layout creation
-    static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    // Resolved once from kParamSpecs (no string lookups in processBlock)
+    pfs::ParameterSet<Param, kNumParams> params { parameters, kParamSpecs };
+
+    // A change of "osFilter" is flagged by the listener and a message-thread
+    // timer re-prepares the oversampler (see rebuildOversampling())
+    class OversamplingRebuilder : public juce::Timer,
+                                  public juce::AudioProcessorValueTreeState::Listener
+    {
+    public:
+        explicit OversamplingRebuilder(TapeAgeAudioProcessor& p) : processor(p) {}
+
+        // Can run on the audio thread (host automation): only flags the change
+        void parameterChanged(const juce::String&, float) override { pending.store(true); }
+
+        void timerCallback() override
+        {
+            if (pending.exchange(false))
+                processor.rebuildOversampling();
+        }
+
+    private:
+        TapeAgeAudioProcessor& processor;
+        std::atomic<bool> pending { false };
+    };
+
+    OversamplingRebuilder oversamplingRebuilder { *this };
+
+    pfs::HalfbandFilter selectOversamplingFilter() const;
+
+    // Prepares the oversampler with the given halfbands and re-reports its
+    // latency to the dry/wet mixer. Not realtime safe.
+    void prepareOversampling(pfs::HalfbandFilter filter);
+
+    // Message thread: suspends processing and applies the selected filter
+    void rebuildOversampling();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TapeAgeAudioProcessor)
 };
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <cmath>
+
+//==============================================================================
+/**
+ * Allocation-free biquad / SVF coefficient engine.
+ *
+ * juce::dsp::IIR::Coefficients::make* returns a ref-counted heap object and is
+ * not safe to call on the audio thread. Everything here is POD, computed in
+ * place with the same closed-form (RBJ cookbook) formulas JUCE uses, so a
+ * migrated filter produces the same response with zero allocations.
+ *
+ *   BiquadCoefficients - normalised (a0 == 1) b0 b1 b2 a1 a2, in-place make*()
+ *   BiquadState        - TDF-II state, processSample(x, coeffs); one set of
+ *                        coefficients can drive any number of states
+ *   Biquad             - coefficients + state, drop-in for IIR::Filter<float>
+ *   BiquadRamp         - per-sample linear interpolation towards new coefficients
+ *   SvfCoefficients /
+ *   Svf                - TPT state-variable filter; stable under fast modulation
+ *
+ * Coefficient maths runs in double and is stored as float.
+ */
+namespace pfs
+{
+
+//==============================================================================
+struct BiquadCoefficients
+{
+    float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f;
+    float a1 = 0.0f, a2 = 0.0f;
+
+    static constexpr double kPi = 3.14159265358979323846;
+    static constexpr double kInvSqrt2 = 0.70710678118654752440;
+
+    void makeIdentity() noexcept
+    {
+        b0 = 1.0f;
+        b1 = b2 = a1 = a2 = 0.0f;
+    }
+
+    void makeFirstOrderLowPass(double sampleRate, double frequency) noexcept
+    {
+        const double n = std::tan(kPi * frequency / sampleRate);
+        setNormalised(n, n, 0.0, n + 1.0, n - 1.0, 0.0);
+    }
+
+    void makeFirstOrderHighPass(double sampleRate, double frequency) noexcept
+    {
+        const double n = std::tan(kPi * frequency / sampleRate);
+        setNormalised(1.0, -1.0, 0.0, n + 1.0, n - 1.0, 0.0);
+    }
+
+    void makeLowPass(double sampleRate, double frequency, double q = kInvSqrt2) noexcept
+    {
+        const double n = 1.0 / std::tan(kPi * frequency / sampleRate);
+        const double nSquared = n * n;
+        const double invQ = 1.0 / q;
+        const double c1 = 1.0 / (1.0 + invQ * n + nSquared);
+
+        setNormalised(c1, c1 * 2.0, c1,
+                      1.0, c1 * 2.0 * (1.0 - nSquared), c1 * (1.0 - invQ * n + nSquared));
+    }
+
+    void makeHighPass(double sampleRate, double frequency, double q = kInvSqrt2) noexcept
+    {
+        const double n = std::tan(kPi * frequency / sampleRate);
+        const double nSquared = n * n;
+        const double invQ = 1.0 / q;
+        const double c1 = 1.0 / (1.0 + invQ * n + nSquared);
+
+        setNormalised(c1, c1 * -2.0, c1,
+                      1.0, c1 * 2.0 * (nSquared - 1.0), c1 * (1.0 - invQ * n + nSquared));
+    }
+
+    // Constant 0 dB peak gain (same as IIR::Coefficients::makeBandPass)
+    void makeBandPass(double sampleRate, double frequency, double q = kInvSqrt2) noexcept
+    {
+        const double n = 1.0 / std::tan(kPi * frequency / sampleRate);
+        const double nSquared = n * n;
+        const double invQ = 1.0 / q;
+        const double c1 = 1.0 / (1.0 + invQ * n + nSquared);
+
+        setNormalised(c1 * n * invQ, 0.0, -c1 * n * invQ,
+                      1.0, c1 * 2.0 * (1.0 - nSquared), c1 * (1.0 - invQ * n + nSquared));
+    }
+
+    void makeLowShelf(double sampleRate, double cutOffFrequency, double q, double gainFactor) noexcept
+    {
+        const double A = std::sqrt(gainFactor > 0.0 ? gainFactor : 0.0);
+        const double aminus1 = A - 1.0;
+        const double aplus1 = A + 1.0;
+        const double omega = (2.0 * kPi * (cutOffFrequency > 2.0 ? cutOffFrequency : 2.0)) / sampleRate;
+        const double coso = std::cos(omega);
+        const double beta = std::sin(omega) * std::sqrt(A) / q;
+        const double aminus1TimesCoso = aminus1 * coso;
+
+        setNormalised(A * (aplus1 - aminus1TimesCoso + beta),
+                      A * 2.0 * (aminus1 - aplus1 * coso),
+                      A * (aplus1 - aminus1TimesCoso - beta),
+                      aplus1 + aminus1TimesCoso + beta,
+                      -2.0 * (aminus1 + aplus1 * coso),
+                      aplus1 + aminus1TimesCoso - beta);
+    }
+
+    void makeHighShelf(double sampleRate, double cutOffFrequency, double q, double gainFactor) noexcept
+    {
+        const double A = std::sqrt(gainFactor > 0.0 ? gainFactor : 0.0);
+        const double aminus1 = A - 1.0;
+        const double aplus1 = A + 1.0;
+        const double omega = (2.0 * kPi * (cutOffFrequency > 2.0 ? cutOffFrequency : 2.0)) / sampleRate;
+        const double coso = std::cos(omega);
+        const double beta = std::sin(omega) * std::sqrt(A) / q;
+        const double aminus1TimesCoso = aminus1 * coso;
+
+        setNormalised(A * (aplus1 + aminus1TimesCoso + beta),
+                      A * -2.0 * (aminus1 + aplus1 * coso),
+                      A * (aplus1 + aminus1TimesCoso - beta),
+                      aplus1 - aminus1TimesCoso + beta,
+                      2.0 * (aminus1 - aplus1 * coso),
+                      aplus1 - aminus1TimesCoso - beta);
+    }
+
+    void makePeakFilter(double sampleRate, double frequency, double q, double gainFactor) noexcept
+    {
+        const double A = std::sqrt(gainFactor > 0.0 ? gainFactor : 0.0);
+        const double omega = (2.0 * kPi * (frequency > 2.0 ? frequency : 2.0)) / sampleRate;
+        const double alpha = std::sin(omega) / (q * 2.0);
+        const double c2 = -2.0 * std::cos(omega);
+        const double alphaTimesA = alpha * A;
+        const double alphaOverA = alpha / A;
+
+        setNormalised(1.0 + alphaTimesA, c2, 1.0 - alphaTimesA,
+                      1.0 + alphaOverA, c2, 1.0 - alphaOverA);
+    }
+
+private:
+    void setNormalised(double nb0, double nb1, double nb2, double na0, double na1, double na2) noexcept
+    {
+        const double invA0 = 1.0 / na0;
+        b0 = static_cast<float>(nb0 * invA0);
+        b1 = static_cast<float>(nb1 * invA0);
+        b2 = static_cast<float>(nb2 * invA0);
+        a1 = static_cast<float>(na1 * invA0);
+        a2 = static_cast<float>(na2 * invA0);
+    }
+};
+
+//==============================================================================
+// Transposed direct form II — identical recursion to juce::dsp::IIR::Filter
+struct BiquadState
+{
+    float s1 = 0.0f, s2 = 0.0f;
+
+    void reset() noexcept { s1 = s2 = 0.0f; }
+
+    inline float processSample(float input, const BiquadCoefficients& c) noexcept
+    {
+        const float output = c.b0 * input + s1;
+        s1 = c.b1 * input - c.a1 * output + s2;
+        s2 = c.b2 * input - c.a2 * output;
+        return output;
+    }
+
+    void process(float* data, int numSamples, const BiquadCoefficients& c) noexcept
+    {
+        float z1 = s1, z2 = s2;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float input = data[i];
+            const float output = c.b0 * input + z1;
+            z1 = c.b1 * input - c.a1 * output + z2;
+            z2 = c.b2 * input - c.a2 * output;
+            data[i] = output;
+        }
+        s1 = z1;
+        s2 = z2;
+        snapToZero();
+    }
+
+    // Flush denormal-range state (IIR::Filter does this after every block)
+    void snapToZero() noexcept
+    {
+        if (!(s1 < -1.0e-8f || s1 > 1.0e-8f)) s1 = 0.0f;
+        if (!(s2 < -1.0e-8f || s2 > 1.0e-8f)) s2 = 0.0f;
+    }
+};
+
+//==============================================================================
+struct Biquad
+{
+    BiquadCoefficients coefficients;
+    BiquadState state;
+
+    void reset() noexcept { state.reset(); }
+    inline float processSample(float input) noexcept { return state.processSample(input, coefficients); }
+    void process(float* data, int numSamples) noexcept { state.process(data, numSamples, coefficients); }
+};
+
+//==============================================================================
+/**
+ * Per-sample coefficient interpolation for zipper-free sweeps.
+ *
+ * Call setTarget() once per block with freshly computed coefficients; next()
+ * walks the current set linearly to the target over rampSamples. Linear
+ * interpolation of direct-form coefficients is safe for the small per-block
+ * steps produced by parameter smoothing; use Svf for large, fast modulation.
+ */
+struct BiquadRamp
+{
+    BiquadCoefficients current;
+    BiquadCoefficients target;
+
+    void setImmediate(const BiquadCoefficients& c) noexcept
+    {
+        current = target = c;
+        remaining = 0;
+    }
+
+    void setTarget(const BiquadCoefficients& c, int rampSamples) noexcept
+    {
+        target = c;
+
+        if (rampSamples <= 0)
+        {
+            current = target;
+            remaining = 0;
+            return;
+        }
+
+        const float inv = 1.0f / static_cast<float>(rampSamples);
+        step.b0 = (target.b0 - current.b0) * inv;
+        step.b1 = (target.b1 - current.b1) * inv;
+        step.b2 = (target.b2 - current.b2) * inv;
+        step.a1 = (target.a1 - current.a1) * inv;
+        step.a2 = (target.a2 - current.a2) * inv;
+        remaining = rampSamples;
+    }
+
+    bool isRamping() const noexcept { return remaining > 0; }
+
+    // Advances one sample and returns the coefficients to use for it
+    inline const BiquadCoefficients& next() noexcept
+    {
+        if (remaining > 0)
+        {
+            if (--remaining == 0)
+            {
+                current = target;
+            }
+            else
+            {
+                current.b0 += step.b0;
+                current.b1 += step.b1;
+                current.b2 += step.b2;
+                current.a1 += step.a1;
+                current.a2 += step.a2;
+            }
+        }
+        return current;
+    }
+
+private:
+    BiquadCoefficients step;
+    int remaining = 0;
+};
+
+// Runs several channels through one ramp (coefficients shared across channels)
+inline void processRamped(BiquadRamp& ramp, BiquadState* states, float* const* channels,
+                          int numChannels, int numSamples) noexcept
+{
+    if (!ramp.isRamping())
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+            states[ch].process(channels[ch], numSamples, ramp.current);
+        return;
+    }
+
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const auto& c = ramp.next();
+        for (int ch = 0; ch < numChannels; ++ch)
+            channels[ch][i] = states[ch].processSample(channels[ch][i], c);
+    }
+
+    for (int ch = 0; ch < numChannels; ++ch)
+        states[ch].snapToZero();
+}
+
+//==============================================================================
+/**
+ * Topology-preserving-transform state-variable filter (Zavalishin / Simper).
+ * Coefficients are g = tan(pi fc / fs), k = 1 / Q. Interpolating g and k is
+ * always stable, which makes this the choice for per-sample cutoff modulation.
+ */
+struct SvfCoefficients
+{
+    float g = 0.0f, k = 1.41421356f;
+    float a1 = 1.0f, a2 = 0.0f, a3 = 0.0f;
+
+    void make(double sampleRate, double frequency, double q = BiquadCoefficients::kInvSqrt2) noexcept
+    {
+        const double gd = std::tan(BiquadCoefficients::kPi * frequency / sampleRate);
+        const double kd = 1.0 / q;
+        const double a1d = 1.0 / (1.0 + gd * (gd + kd));
+
+        g = static_cast<float>(gd);
+        k = static_cast<float>(kd);
+        a1 = static_cast<float>(a1d);
+        a2 = static_cast<float>(gd * a1d);
+        a3 = static_cast<float>(gd * gd * a1d);
+    }
+};
+
+struct Svf
+{
+    enum class Type
+    {
+        LowPass,
+        BandPass,
+        HighPass
+    };
+
+    float ic1eq = 0.0f, ic2eq = 0.0f;
+
+    void reset() noexcept { ic1eq = ic2eq = 0.0f; }
+
+    inline float processSample(float input, const SvfCoefficients& c, Type type) noexcept
+    {
+        const float v3 = input - ic2eq;
+        const float v1 = c.a1 * ic1eq + c.a2 * v3;
+        const float v2 = ic2eq + c.a2 * ic1eq + c.a3 * v3;
+        ic1eq = 2.0f * v1 - ic1eq;
+        ic2eq = 2.0f * v2 - ic2eq;
+
+        switch (type)
+        {
+            case Type::LowPass:  return v2;
+            case Type::BandPass: return v1;
+            case Type::HighPass: return input - c.k * v1 - v2;
+        }
+        return v2;
+    }
+};
+
+} // namespace pfs
@@ -0,0 +1,513 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+ #include <immintrin.h>
+ #define PFS_SIMD_AVX2 1
+ #define PFS_SIMD_SSE2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <emmintrin.h>
+ #define PFS_SIMD_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+ #include <arm_neon.h>
+ #define PFS_SIMD_NEON 1
+#endif
+
+//==============================================================================
+/**
+ * Vectorised fast-math kernels: tanh, sin, exp, log, pow2.
+ *
+ * Every function exists as a scalar call and as a block call
+ * (in, out, numSamples; in-place is fine). One templated kernel is written
+ * against a tiny set of lane operations and instantiated for the widest
+ * instruction set the translation unit is compiled for:
+ *
+ *   AVX2 (8 lanes, when built with -mavx2 / PFS_SIMD_AVX2=ON)
+ *   SSE2 (4 lanes, x86-64 baseline)
+ *   NEON (4 lanes, arm64)
+ *   scalar fallback
+ *
+ * Block tails are zero-padded into one more vector, so even a 3-value call
+ * runs on SIMD lanes. The scalar calls run the same kernel on one lane and
+ * share the error bounds below, but they are NOT faster than a modern libm
+ * (glibc's sinf/expf are table-driven): gather independent values and use the
+ * block form in hot loops. Nothing here allocates or branches on data
+ * (selects only), so the cost per sample is constant.
+ *
+ * Measured max error (test/fastmath, 2^24 points per range, vs double libm):
+ *
+ *   function | input range             | max abs error | max rel error
+ *   ---------+-------------------------+---------------+---------------------
+ *   tanh     | all finite x            | 1.5e-7        | 6.0e-7 (|x| >= 1e-3)
+ *   sin      | |x| <= 2pi * 4096       | 2.5e-7        | -
+ *   exp      | -87 <= x <= 88          | -             | 1.2e-7
+ *   log      | 0.25 <= x <= 4          | 1.0e-7        | -
+ *   log      | FLT_MIN <= x            | -             | 1.0e-7 (|log x| >= 0.5)
+ *   pow2     | -126 <= x <= 127        | -             | 1.2e-7
+ *
+ * Out-of-range inputs saturate rather than producing inf/NaN: exp/pow2 clamp
+ * their argument, log clamps x to FLT_MIN (so log(0) ~= -87.3).
+ *
+ * Plugins do not call pfs::fastmath directly; they call pfs::math, which
+ * resolves to the fast kernels or to <cmath> depending on the plugin's
+ * PFS_FAST_MATH compile definition (see pfs_set_math_mode() in
+ * shared/CMakeLists.txt). That keeps an exact build one CMake switch away for
+ * A/B listening and golden-render comparisons.
+ */
+namespace pfs
+{
+
+enum class MathMode
+{
+    Exact,  // <cmath>
+    Fast    // pfs::fastmath kernels
+};
+
+namespace fastmath
+{
+namespace detail
+{
+
+inline float bitsToFloat(std::int32_t i) noexcept { float f; std::memcpy(&f, &i, sizeof(f)); return f; }
+inline std::int32_t floatToBits(float f) noexcept { std::int32_t i; std::memcpy(&i, &f, sizeof(i)); return i; }
+
+//==============================================================================
+// Lane operations. Each backend provides the same static interface.
+struct ScalarOps
+{
+    using Float = float;
+    using Int = std::int32_t;
+    using Mask = bool;
+    static constexpr int width = 1;
+
+    static Float load(const float* p) noexcept { return *p; }
+    static void store(float* p, Float v) noexcept { *p = v; }
+    static Float set(float v) noexcept { return v; }
+    static Float add(Float a, Float b) noexcept { return a + b; }
+    static Float sub(Float a, Float b) noexcept { return a - b; }
+    static Float mul(Float a, Float b) noexcept { return a * b; }
+    static Float div(Float a, Float b) noexcept { return a / b; }
+    static Float min(Float a, Float b) noexcept { return a < b ? a : b; }
+    static Float max(Float a, Float b) noexcept { return a > b ? a : b; }
+    static Float abs(Float a) noexcept { return bitsToFloat(floatToBits(a) & 0x7fffffff); }
+    static Float copySign(Float magnitude, Float sign) noexcept
+    {
+        return bitsToFloat(floatToBits(magnitude) | (floatToBits(sign) & std::int32_t(0x80000000u)));
+    }
+    static Mask lessThan(Float a, Float b) noexcept { return a < b; }
+    static Float select(Mask m, Float a, Float b) noexcept { return m ? a : b; }
+
+    // Round half up; avoids lrintf, which is a libm call without -fno-math-errno
+    static Int roundToInt(Float a) noexcept
+    {
+        const float shifted = a + 0.5f;
+        const auto truncated = static_cast<Int>(shifted);
+        return truncated - (shifted < static_cast<float>(truncated) ? 1 : 0);
+    }
+    static Float toFloat(Int a) noexcept { return static_cast<float>(a); }
+    static Int asInt(Float a) noexcept { return floatToBits(a); }
+    static Float asFloat(Int a) noexcept { return bitsToFloat(a); }
+    static Int setInt(std::int32_t v) noexcept { return v; }
+    static Int addInt(Int a, Int b) noexcept { return a + b; }
+    static Int andInt(Int a, Int b) noexcept { return a & b; }
+    static Int orInt(Int a, Int b) noexcept { return a | b; }
+    static Int shiftLeft23(Int a) noexcept { return static_cast<Int>(static_cast<std::uint32_t>(a) << 23); }
+    static Int shiftRight23(Int a) noexcept { return static_cast<Int>(static_cast<std::uint32_t>(a) >> 23); }
+};
+
+#if PFS_SIMD_SSE2
+struct Sse2Ops
+{
+    using Float = __m128;
+    using Int = __m128i;
+    using Mask = __m128;
+    static constexpr int width = 4;
+
+    static Float load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static void store(float* p, Float v) noexcept { _mm_storeu_ps(p, v); }
+    static Float set(float v) noexcept { return _mm_set1_ps(v); }
+    static Float add(Float a, Float b) noexcept { return _mm_add_ps(a, b); }
+    static Float sub(Float a, Float b) noexcept { return _mm_sub_ps(a, b); }
+    static Float mul(Float a, Float b) noexcept { return _mm_mul_ps(a, b); }
+    static Float div(Float a, Float b) noexcept { return _mm_div_ps(a, b); }
+    static Float min(Float a, Float b) noexcept { return _mm_min_ps(a, b); }
+    static Float max(Float a, Float b) noexcept { return _mm_max_ps(a, b); }
+    static Float abs(Float a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    static Float copySign(Float magnitude, Float sign) noexcept
+    {
+        const auto signBit = _mm_set1_ps(-0.0f);
+        return _mm_or_ps(_mm_andnot_ps(signBit, magnitude), _mm_and_ps(signBit, sign));
+    }
+    static Mask lessThan(Float a, Float b) noexcept { return _mm_cmplt_ps(a, b); }
+    static Float select(Mask m, Float a, Float b) noexcept { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+
+    static Int roundToInt(Float a) noexcept { return _mm_cvtps_epi32(a); }
+    static Float toFloat(Int a) noexcept { return _mm_cvtepi32_ps(a); }
+    static Int asInt(Float a) noexcept { return _mm_castps_si128(a); }
+    static Float asFloat(Int a) noexcept { return _mm_castsi128_ps(a); }
+    static Int setInt(std::int32_t v) noexcept { return _mm_set1_epi32(v); }
+    static Int addInt(Int a, Int b) noexcept { return _mm_add_epi32(a, b); }
+    static Int andInt(Int a, Int b) noexcept { return _mm_and_si128(a, b); }
+    static Int orInt(Int a, Int b) noexcept { return _mm_or_si128(a, b); }
+    static Int shiftLeft23(Int a) noexcept { return _mm_slli_epi32(a, 23); }
+    static Int shiftRight23(Int a) noexcept { return _mm_srli_epi32(a, 23); }
+};
+#endif
+
+#if PFS_SIMD_AVX2
+struct Avx2Ops
+{
+    using Float = __m256;
+    using Int = __m256i;
+    using Mask = __m256;
+    static constexpr int width = 8;
+
+    static Float load(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    static void store(float* p, Float v) noexcept { _mm256_storeu_ps(p, v); }
+    static Float set(float v) noexcept { return _mm256_set1_ps(v); }
+    static Float add(Float a, Float b) noexcept { return _mm256_add_ps(a, b); }
+    static Float sub(Float a, Float b) noexcept { return _mm256_sub_ps(a, b); }
+    static Float mul(Float a, Float b) noexcept { return _mm256_mul_ps(a, b); }
+    static Float div(Float a, Float b) noexcept { return _mm256_div_ps(a, b); }
+    static Float min(Float a, Float b) noexcept { return _mm256_min_ps(a, b); }
+    static Float max(Float a, Float b) noexcept { return _mm256_max_ps(a, b); }
+    static Float abs(Float a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static Float copySign(Float magnitude, Float sign) noexcept
+    {
+        const auto signBit = _mm256_set1_ps(-0.0f);
+        return _mm256_or_ps(_mm256_andnot_ps(signBit, magnitude), _mm256_and_ps(signBit, sign));
+    }
+    static Mask lessThan(Float a, Float b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Float select(Mask m, Float a, Float b) noexcept { return _mm256_blendv_ps(b, a, m); }
+
+    static Int roundToInt(Float a) noexcept { return _mm256_cvtps_epi32(a); }
+    static Float toFloat(Int a) noexcept { return _mm256_cvtepi32_ps(a); }
+    static Int asInt(Float a) noexcept { return _mm256_castps_si256(a); }
+    static Float asFloat(Int a) noexcept { return _mm256_castsi256_ps(a); }
+    static Int setInt(std::int32_t v) noexcept { return _mm256_set1_epi32(v); }
+    static Int addInt(Int a, Int b) noexcept { return _mm256_add_epi32(a, b); }
+    static Int andInt(Int a, Int b) noexcept { return _mm256_and_si256(a, b); }
+    static Int orInt(Int a, Int b) noexcept { return _mm256_or_si256(a, b); }
+    static Int shiftLeft23(Int a) noexcept { return _mm256_slli_epi32(a, 23); }
+    static Int shiftRight23(Int a) noexcept { return _mm256_srli_epi32(a, 23); }
+};
+#endif
+
+#if PFS_SIMD_NEON
+struct NeonOps
+{
+    using Float = float32x4_t;
+    using Int = int32x4_t;
+    using Mask = uint32x4_t;
+    static constexpr int width = 4;
+
+    static Float load(const float* p) noexcept { return vld1q_f32(p); }
+    static void store(float* p, Float v) noexcept { vst1q_f32(p, v); }
+    static Float set(float v) noexcept { return vdupq_n_f32(v); }
+    static Float add(Float a, Float b) noexcept { return vaddq_f32(a, b); }
+    static Float sub(Float a, Float b) noexcept { return vsubq_f32(a, b); }
+    static Float mul(Float a, Float b) noexcept { return vmulq_f32(a, b); }
+    static Float div(Float a, Float b) noexcept { return vdivq_f32(a, b); }
+    static Float min(Float a, Float b) noexcept { return vminq_f32(a, b); }
+    static Float max(Float a, Float b) noexcept { return vmaxq_f32(a, b); }
+    static Float abs(Float a) noexcept { return vabsq_f32(a); }
+    static Float copySign(Float magnitude, Float sign) noexcept
+    {
+        return vbslq_f32(vdupq_n_u32(0x80000000u), sign, magnitude);
+    }
+    static Mask lessThan(Float a, Float b) noexcept { return vcltq_f32(a, b); }
+    static Float select(Mask m, Float a, Float b) noexcept { return vbslq_f32(m, a, b); }
+
+    static Int roundToInt(Float a) noexcept { return vcvtnq_s32_f32(a); }
+    static Float toFloat(Int a) noexcept { return vcvtq_f32_s32(a); }
+    static Int asInt(Float a) noexcept { return vreinterpretq_s32_f32(a); }
+    static Float asFloat(Int a) noexcept { return vreinterpretq_f32_s32(a); }
+    static Int setInt(std::int32_t v) noexcept { return vdupq_n_s32(v); }
+    static Int addInt(Int a, Int b) noexcept { return vaddq_s32(a, b); }
+    static Int andInt(Int a, Int b) noexcept { return vandq_s32(a, b); }
+    static Int orInt(Int a, Int b) noexcept { return vorrq_s32(a, b); }
+    static Int shiftLeft23(Int a) noexcept { return vshlq_n_s32(a, 23); }
+    static Int shiftRight23(Int a) noexcept
+    {
+        return vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(a), 23));
+    }
+};
+#endif
+
+// Widest backend first; with AVX2 the SSE2 lanes still take 4-sample tails
+#if PFS_SIMD_AVX2
+using VectorOps = Avx2Ops;
+#elif PFS_SIMD_SSE2
+using VectorOps = Sse2Ops;
+#elif PFS_SIMD_NEON
+using VectorOps = NeonOps;
+#else
+using VectorOps = ScalarOps;
+#endif
+
+//==============================================================================
+// The kernels. Written once against the lane operations above.
+template <typename Ops>
+struct Kernels
+{
+    using V = typename Ops::Float;
+
+    // p * 2^k, k in [-126, 127]; builds 2^k directly in the exponent bits
+    static V scaleByPow2(V p, typename Ops::Int k) noexcept
+    {
+        return Ops::mul(p, Ops::asFloat(Ops::shiftLeft23(Ops::addInt(k, Ops::setInt(127)))));
+    }
+
+    // 2^x: split into round(x) + f with |f| <= 0.5, minimax polynomial for 2^f
+    // (Cephes exp2f), then build 2^round(x) directly in the exponent bits.
+    static V pow2(V x) noexcept
+    {
+        x = Ops::min(Ops::max(x, Ops::set(-126.0f)), Ops::set(127.0f));
+        const auto k = Ops::roundToInt(x);
+        const V f = Ops::sub(x, Ops::toFloat(k));
+
+        V p = Ops::set(1.535336188319500e-4f);
+        p = Ops::add(Ops::mul(p, f), Ops::set(1.339887440266574e-3f));
+        p = Ops::add(Ops::mul(p, f), Ops::set(9.618437357674640e-3f));
+        p = Ops::add(Ops::mul(p, f), Ops::set(5.550332471162809e-2f));
+        p = Ops::add(Ops::mul(p, f), Ops::set(2.402264791363012e-1f));
+        p = Ops::add(Ops::mul(p, f), Ops::set(6.931472028550421e-1f));
+        p = Ops::add(Ops::mul(p, f), Ops::set(1.0f));
+
+        return scaleByPow2(p, k);
+    }
+
+    // e^x: k = round(x / ln2), r = x - k ln2 in two parts (Cody-Waite) so the
+    // reduction stays exact for large |x|, Cephes expf polynomial for e^r.
+    static V exp(V x) noexcept
+    {
+        x = Ops::min(Ops::max(x, Ops::set(-87.0f)), Ops::set(88.0f));
+        const auto k = Ops::roundToInt(Ops::mul(x, Ops::set(1.44269504088896341f)));
+        const V kf = Ops::toFloat(k);
+        V r = Ops::sub(x, Ops::mul(kf, Ops::set(0.693359375f)));
+        r = Ops::sub(r, Ops::mul(kf, Ops::set(-2.12194440e-4f)));
+
+        V p = Ops::set(1.9875691500e-4f);
+        p = Ops::add(Ops::mul(p, r), Ops::set(1.3981999507e-3f));
+        p = Ops::add(Ops::mul(p, r), Ops::set(8.3334519073e-3f));
+        p = Ops::add(Ops::mul(p, r), Ops::set(4.1665795894e-2f));
+        p = Ops::add(Ops::mul(p, r), Ops::set(1.6666665459e-1f));
+        p = Ops::add(Ops::mul(p, r), Ops::set(5.0000001201e-1f));
+        p = Ops::add(Ops::add(Ops::mul(Ops::mul(p, r), r), r), Ops::set(1.0f));
+
+        return scaleByPow2(p, k);
+    }
+
+    // Natural log: x = m * 2^e with m in [sqrt(0.5), sqrt(2)), Cephes logf
+    // polynomial for log(1 + (m - 1)), exponent added back in two parts.
+    static V log(V x) noexcept
+    {
+        x = Ops::max(x, Ops::set(1.17549435e-38f));
+
+        const auto bits = Ops::asInt(x);
+        V e = Ops::toFloat(Ops::addInt(Ops::shiftRight23(bits), Ops::setInt(-126)));
+        V m = Ops::asFloat(Ops::orInt(Ops::andInt(bits, Ops::setInt(0x007fffff)), Ops::setInt(0x3f000000)));
+
+        const auto belowSqrtHalf = Ops::lessThan(m, Ops::set(0.707106781186547524f));
+        e = Ops::select(belowSqrtHalf, Ops::sub(e, Ops::set(1.0f)), e);
+        m = Ops::select(belowSqrtHalf, Ops::sub(Ops::add(m, m), Ops::set(1.0f)), Ops::sub(m, Ops::set(1.0f)));
+
+        const V z = Ops::mul(m, m);
+
+        V y = Ops::set(7.0376836292e-2f);
+        y = Ops::add(Ops::mul(y, m), Ops::set(-1.1514610310e-1f));
+        y = Ops::add(Ops::mul(y, m), Ops::set(1.1676998740e-1f));
+        y = Ops::add(Ops::mul(y, m), Ops::set(-1.2420140846e-1f));
+        y = Ops::add(Ops::mul(y, m), Ops::set(1.4249322787e-1f));
+        y = Ops::add(Ops::mul(y, m), Ops::set(-1.6668057665e-1f));
+        y = Ops::add(Ops::mul(y, m), Ops::set(2.0000714765e-1f));
+        y = Ops::add(Ops::mul(y, m), Ops::set(-2.4999993993e-1f));
+        y = Ops::add(Ops::mul(y, m), Ops::set(3.3333331174e-1f));
+        y = Ops::mul(Ops::mul(y, m), z);
+
+        y = Ops::add(y, Ops::mul(e, Ops::set(-2.12194440e-4f)));
+        y = Ops::sub(y, Ops::mul(z, Ops::set(0.5f)));
+
+        return Ops::add(Ops::add(m, y), Ops::mul(e, Ops::set(0.693359375f)));
+    }
+
+    // sin: reduce to [-pi, pi] (three-part 2pi), fold to [-pi/2, pi/2] with
+    // min/max, then the odd Taylor series to x^11. Error grows with |x| through
+    // the reduction, so callers should keep phases wrapped.
+    static V sin(V x) noexcept
+    {
+        const auto k = Ops::toFloat(Ops::roundToInt(Ops::mul(x, Ops::set(0.159154943091895336f))));
+        x = Ops::sub(x, Ops::mul(k, Ops::set(6.28125f)));
+        x = Ops::sub(x, Ops::mul(k, Ops::set(1.9350051879882812e-3f)));
+        x = Ops::sub(x, Ops::mul(k, Ops::set(3.0199160505e-7f)));
+
+        const V pi = Ops::set(3.14159265358979324f);
+        x = Ops::min(x, Ops::sub(pi, x));
+        x = Ops::max(x, Ops::sub(Ops::sub(Ops::set(0.0f), pi), x));
+
+        const V x2 = Ops::mul(x, x);
+        V p = Ops::set(-2.50521083854417188e-8f);
+        p = Ops::add(Ops::mul(p, x2), Ops::set(2.75573192239858907e-6f));
+        p = Ops::add(Ops::mul(p, x2), Ops::set(-1.98412698412698413e-4f));
+        p = Ops::add(Ops::mul(p, x2), Ops::set(8.33333333333333333e-3f));
+        p = Ops::add(Ops::mul(p, x2), Ops::set(-1.66666666666666667e-1f));
+        return Ops::add(x, Ops::mul(Ops::mul(p, x2), x));
+    }
+
+    // tanh: (e^2|x| - 1) / (e^2|x| + 1) with the sign restored. Below
+    // |x| = 1/16 the quotient cancels, so a short odd series takes over there.
+    static V tanh(V x) noexcept
+    {
+        const V ax = Ops::min(Ops::abs(x), Ops::set(9.0f));
+        const V e = exp(Ops::add(ax, ax));
+        const V large = Ops::div(Ops::sub(e, Ops::set(1.0f)), Ops::add(e, Ops::set(1.0f)));
+
+        const V x2 = Ops::mul(ax, ax);
+        V p = Ops::set(-5.39682539682539683e-2f);
+        p = Ops::add(Ops::mul(p, x2), Ops::set(1.33333333333333333e-1f));
+        p = Ops::add(Ops::mul(p, x2), Ops::set(-3.33333333333333333e-1f));
+        const V small = Ops::add(ax, Ops::mul(Ops::mul(p, x2), ax));
+
+        return Ops::copySign(Ops::select(Ops::lessThan(ax, Ops::set(0.0625f)), small, large), x);
+    }
+};
+
+#define PFS_FASTMATH_DECLARE_KERNEL(name)                                                  \
+    struct name##Kernel                                                                    \
+    {                                                                                      \
+        template <typename Ops>                                                            \
+        static typename Ops::Float apply(typename Ops::Float x) noexcept                   \
+        {                                                                                  \
+            return Kernels<Ops>::name(x);                                                  \
+        }                                                                                  \
+    };
+
+PFS_FASTMATH_DECLARE_KERNEL(tanh)
+PFS_FASTMATH_DECLARE_KERNEL(sin)
+PFS_FASTMATH_DECLARE_KERNEL(exp)
+PFS_FASTMATH_DECLARE_KERNEL(log)
+PFS_FASTMATH_DECLARE_KERNEL(pow2)
+
+#undef PFS_FASTMATH_DECLARE_KERNEL
+
+// Runs fewer than Ops::width values through one full vector (zero-padded), so
+// short calls such as a voice's 3 oscillators still take the SIMD path
+template <typename Ops, typename Kernel>
+inline void applyPartial(const float* in, float* out, int numSamples) noexcept
+{
+    float lanes[Ops::width] = {};
+    std::memcpy(lanes, in, sizeof(float) * static_cast<size_t>(numSamples));
+    Ops::store(lanes, Kernel::template apply<Ops>(Ops::load(lanes)));
+    std::memcpy(out, lanes, sizeof(float) * static_cast<size_t>(numSamples));
+}
+
+template <typename Kernel>
+inline void applyBlock(const float* in, float* out, int numSamples) noexcept
+{
+    int i = 0;
+    for (; i + VectorOps::width <= numSamples; i += VectorOps::width)
+        VectorOps::store(out + i, Kernel::template apply<VectorOps>(VectorOps::load(in + i)));
+
+    const int remaining = numSamples - i;
+    if (remaining <= 0)
+        return;
+
+  #if PFS_SIMD_AVX2
+    if (remaining <= Sse2Ops::width)
+        applyPartial<Sse2Ops, Kernel>(in + i, out + i, remaining);
+    else
+        applyPartial<Avx2Ops, Kernel>(in + i, out + i, remaining);
+  #elif PFS_SIMD_SSE2 || PFS_SIMD_NEON
+    applyPartial<VectorOps, Kernel>(in + i, out + i, remaining);
+  #else
+    for (; i < numSamples; ++i)
+        out[i] = Kernel::template apply<ScalarOps>(in[i]);
+  #endif
+}
+
+} // namespace detail
+
+//==============================================================================
+/** Name of the instruction set the block kernels were compiled for. */
+constexpr const char* getInstructionSetName() noexcept
+{
+  #if PFS_SIMD_AVX2
+    return "AVX2";
+  #elif PFS_SIMD_SSE2
+    return "SSE2";
+  #elif PFS_SIMD_NEON
+    return "NEON";
+  #else
+    return "scalar";
+  #endif
+}
+
+// Scalar
+inline float tanh(float x) noexcept { return detail::Kernels<detail::ScalarOps>::tanh(x); }
+inline float sin(float x) noexcept  { return detail::Kernels<detail::ScalarOps>::sin(x); }
+inline float exp(float x) noexcept  { return detail::Kernels<detail::ScalarOps>::exp(x); }
+inline float log(float x) noexcept  { return detail::Kernels<detail::ScalarOps>::log(x); }
+inline float pow2(float x) noexcept { return detail::Kernels<detail::ScalarOps>::pow2(x); }
+
+// Block (in == out allowed)
+inline void tanh(const float* in, float* out, int n) noexcept { detail::applyBlock<detail::tanhKernel>(in, out, n); }
+inline void sin(const float* in, float* out, int n) noexcept  { detail::applyBlock<detail::sinKernel>(in, out, n); }
+inline void exp(const float* in, float* out, int n) noexcept  { detail::applyBlock<detail::expKernel>(in, out, n); }
+inline void log(const float* in, float* out, int n) noexcept  { detail::applyBlock<detail::logKernel>(in, out, n); }
+inline void pow2(const float* in, float* out, int n) noexcept { detail::applyBlock<detail::pow2Kernel>(in, out, n); }
+
+} // namespace fastmath
+
+//==============================================================================
+/**
+ * Mode-selected maths: MathFunctions<MathMode::Fast> forwards to
+ * pfs::fastmath, MathFunctions<MathMode::Exact> to <cmath>. Same signatures
+ * either way, so call sites never branch on the mode.
+ */
+template <MathMode mode>
+struct MathFunctions
+{
+    static constexpr bool isFast = (mode == MathMode::Fast);
+
+    static float tanh(float x) noexcept { if constexpr (isFast) return fastmath::tanh(x); else return std::tanh(x); }
+    static float sin(float x) noexcept  { if constexpr (isFast) return fastmath::sin(x);  else return std::sin(x); }
+    static float exp(float x) noexcept  { if constexpr (isFast) return fastmath::exp(x);  else return std::exp(x); }
+    static float log(float x) noexcept  { if constexpr (isFast) return fastmath::log(x);  else return std::log(x); }
+    static float pow2(float x) noexcept { if constexpr (isFast) return fastmath::pow2(x); else return std::exp2(x); }
+
+    static void tanh(const float* in, float* out, int n) noexcept
+    {
+        if constexpr (isFast) fastmath::tanh(in, out, n); else for (int i = 0; i < n; ++i) out[i] = std::tanh(in[i]);
+    }
+    static void sin(const float* in, float* out, int n) noexcept
+    {
+        if constexpr (isFast) fastmath::sin(in, out, n); else for (int i = 0; i < n; ++i) out[i] = std::sin(in[i]);
+    }
+    static void exp(const float* in, float* out, int n) noexcept
+    {
+        if constexpr (isFast) fastmath::exp(in, out, n); else for (int i = 0; i < n; ++i) out[i] = std::exp(in[i]);
+    }
+    static void log(const float* in, float* out, int n) noexcept
+    {
+        if constexpr (isFast) fastmath::log(in, out, n); else for (int i = 0; i < n; ++i) out[i] = std::log(in[i]);
+    }
+    static void pow2(const float* in, float* out, int n) noexcept
+    {
+        if constexpr (isFast) fastmath::pow2(in, out, n); else for (int i = 0; i < n; ++i) out[i] = std::exp2(in[i]);
+    }
+};
+
+// Per-plugin switch: set by pfs_set_math_mode(<target> FAST|EXACT)
+#ifndef PFS_FAST_MATH
+ #define PFS_FAST_MATH 0
+#endif
+
+constexpr MathMode kMathMode = PFS_FAST_MATH ? MathMode::Fast : MathMode::Exact;
+
+/** The plugin's configured maths: pfs::math::tanh(x), pfs::math::exp(in, out, n), ... */
+using math = MathFunctions<kMathMode>;
+
+} // namespace pfs
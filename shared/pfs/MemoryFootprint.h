@@ -0,0 +1,69 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+//==============================================================================
+/**
+ * DSP memory report: bytes a plugin instance holds after prepareToPlay().
+ *
+ *   void getMemoryFootprint(pfs::MemoryFootprint& footprint) const override
+ *   {
+ *       footprint.add("FDN A", fdnA.getMemoryFootprintBytes());
+ *       footprint.add("Pre-delay", preDelayBytes);
+ *   }
+ *
+ * The processor implements pfs::MemoryFootprintSource; the benchmark harness
+ * finds it through a plain juce::AudioProcessor* and writes the entries next
+ * to the timings. Entries cover the large buffers (delay lines, arenas), not
+ * every member, so the numbers say how many instances share an L2 before
+ * their working sets start evicting each other.
+ *
+ * Message thread / harness only; add() ignores entries past kMaxEntries.
+ */
+namespace pfs
+{
+
+class MemoryFootprint
+{
+public:
+    static constexpr int kMaxEntries = 16;
+
+    struct Entry
+    {
+        const char* name = "";
+        std::size_t bytes = 0;
+    };
+
+    void add(const char* name, std::size_t bytes) noexcept
+    {
+        if (numEntries < kMaxEntries)
+            entries[static_cast<std::size_t>(numEntries++)] = { name, bytes };
+    }
+
+    int getNumEntries() const noexcept { return numEntries; }
+    const Entry& getEntry(int index) const noexcept { return entries[static_cast<std::size_t>(index)]; }
+
+    std::size_t getTotalBytes() const noexcept
+    {
+        std::size_t total = 0;
+        for (int i = 0; i < numEntries; ++i)
+            total += entries[static_cast<std::size_t>(i)].bytes;
+        return total;
+    }
+
+private:
+    std::array<Entry, kMaxEntries> entries {};
+    int numEntries = 0;
+};
+
+//==============================================================================
+// Lets the harnesses find the report through a plain juce::AudioProcessor*
+class MemoryFootprintSource
+{
+public:
+    virtual ~MemoryFootprintSource() = default;
+    virtual void getMemoryFootprint(MemoryFootprint& footprint) const = 0;
+};
+
+} // namespace pfs
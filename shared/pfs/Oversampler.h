@@ -0,0 +1,569 @@
+#pragma once
+
+#include "FastMath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+//==============================================================================
+/**
+ * 2^order oversampler built from cascaded halfband stages, with a choice of
+ * filter per instance. A drop-in for juce::dsp::Oversampling around
+ * waveshapers, without the JUCE dependency.
+ *
+ *   HalfbandFilter::LinearPhase - Kaiser-windowed FIR halfbands run as two
+ *                                 polyphase branches (the zero taps are never
+ *                                 multiplied). Symmetric, so the latency is
+ *                                 an exact number of samples (29 at 2x).
+ *   HalfbandFilter::LowLatency  - two-path polyphase allpass IIR halfbands
+ *                                 (elliptic, power-complementary). Non-linear
+ *                                 phase, but 1.8 samples of latency at 2x
+ *                                 (2.3 at 4x) and fewer multiply-adds per
+ *                                 stage.
+ *
+ * Later stages only have to reject what would alias into the first stage's
+ * passband, so their transition bands widen and they get much cheaper.
+ * The IIR runs the two channels and the two allpass paths as four lanes of
+ * one loop, which the compiler maps onto a single SSE/NEON register.
+ *
+ * prepare() designs the filters and sizes every buffer (message thread);
+ * processUp()/processDown() never allocate.
+ */
+namespace pfs
+{
+
+enum class HalfbandFilter
+{
+    LinearPhase,
+    LowLatency
+};
+
+//==============================================================================
+class Oversampler
+{
+public:
+    static constexpr int kMaxChannels = 2;
+    static constexpr int kMaxOrder = 3;
+
+    // Message thread: designs the stages for 2^order and sizes the buffers for
+    // blocks of up to maxBlockSize samples.
+    void prepare(int channels, int order, HalfbandFilter filterType, int maxBlockSize)
+    {
+        numChannels = std::clamp(channels, 1, kMaxChannels);
+        numStages = std::clamp(order, 0, kMaxOrder);
+        filter = filterType;
+        maxSamples = std::max(maxBlockSize, 1);
+
+        latency = 0.0;
+
+        for (int s = 0; s < numStages; ++s)
+        {
+            Stage& stage = stages[s];
+            const int inputLength = maxSamples << s;
+
+            if (filter == HalfbandFilter::LowLatency)
+            {
+                stage.designIir(kIirSpecs[s].numCoefs, kIirSpecs[s].transition);
+                latency += stage.latency / static_cast<double>(2 << s);
+            }
+            else
+            {
+                stage.designFir(kFirSpecs[s].transition, kFirSpecs[s].attenuationDb);
+                latency += stage.latency / static_cast<double>(2 << s);
+                stage.scratch.assign(static_cast<size_t>(inputLength), 0.0f);
+            }
+
+            // The IIR keeps its history in the allpass states
+            const size_t historySize = filter == HalfbandFilter::LinearPhase
+                                           ? static_cast<size_t>(stage.historyLength + inputLength)
+                                           : 0;
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                stage.output[ch].assign(static_cast<size_t>(2 * inputLength), 0.0f);
+                stage.history[ch].assign(historySize, 0.0f);
+                stage.evenHistory[ch].assign(historySize, 0.0f);
+                stage.oddHistory[ch].assign(historySize, 0.0f);
+            }
+        }
+
+        // 1x: the "oversampled" block is a copy of the input
+        for (int ch = 0; ch < numChannels; ++ch)
+            passThrough[ch].assign(numStages == 0 ? static_cast<size_t>(maxSamples) : 0, 0.0f);
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        for (int s = 0; s < numStages; ++s)
+            stages[s].reset(numChannels);
+    }
+
+    int getOrder() const noexcept { return numStages; }
+    int getFactor() const noexcept { return 1 << numStages; }
+    int getNumChannels() const noexcept { return numChannels; }
+    HalfbandFilter getFilter() const noexcept { return filter; }
+
+    // Round-trip (up + down) delay in samples at the base rate. Exact for the
+    // FIR; the IIR's is its group delay at DC.
+    double getLatencyInSamples() const noexcept { return latency; }
+
+    // Upsamples numSamples (<= maxBlockSize) of each channel and returns the
+    // oversampled channels, numSamples * getFactor() long. They stay valid
+    // until processDown().
+    float* const* processUp(const float* const* input, int numSamples) noexcept
+    {
+        if (numStages == 0)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                std::copy_n(input[ch], numSamples, passThrough[ch].data());
+                channelPointers[ch] = passThrough[ch].data();
+            }
+            return channelPointers;
+        }
+
+        const float* stageInput[kMaxChannels] = {};
+        for (int ch = 0; ch < numChannels; ++ch)
+            stageInput[ch] = input[ch];
+
+        for (int s = 0; s < numStages; ++s)
+        {
+            Stage& stage = stages[s];
+            const int length = numSamples << s;
+
+            if (filter == HalfbandFilter::LowLatency)
+                stage.upIir(stageInput, numChannels, length);
+            else
+                stage.upFir(stageInput, numChannels, length);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+                stageInput[ch] = stage.output[ch].data();
+        }
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            channelPointers[ch] = stages[numStages - 1].output[ch].data();
+
+        return channelPointers;
+    }
+
+    // Downsamples the channels processUp() returned into output
+    void processDown(float* const* output, int numSamples) noexcept
+    {
+        if (numStages == 0)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                std::copy_n(passThrough[ch].data(), numSamples, output[ch]);
+            return;
+        }
+
+        for (int s = numStages - 1; s >= 0; --s)
+        {
+            Stage& stage = stages[s];
+            const int length = numSamples << s;
+
+            // Each stage writes into the buffer the stage below upsampled into
+            float* stageOutput[kMaxChannels] = {};
+            for (int ch = 0; ch < numChannels; ++ch)
+                stageOutput[ch] = s > 0 ? stages[s - 1].output[ch].data() : output[ch];
+
+            if (filter == HalfbandFilter::LowLatency)
+                stage.downIir(stageOutput, numChannels, length);
+            else
+                stage.downFir(stageOutput, numChannels, length);
+        }
+    }
+
+private:
+    static constexpr double kPi = 3.14159265358979323846;
+
+    // IIR allpass coefficients per stage; both paths get numCoefs / 2
+    static constexpr int kMaxIirCoefs = 4;
+    static constexpr int kMaxAllpasses = kMaxIirCoefs / 2;
+    static constexpr int kLanes = 4;  // channel 0 path 0/1, channel 1 path 0/1
+
+    // Four lanes wide on every backend: SSE2 (also under AVX2) and NEON, else
+    // a plain four-float loop
+  #if PFS_SIMD_SSE2
+    using LaneOps = fastmath::detail::Sse2Ops;
+  #elif PFS_SIMD_NEON
+    using LaneOps = fastmath::detail::NeonOps;
+  #else
+    struct LaneOps
+    {
+        struct Float
+        {
+            float v[kLanes];
+        };
+
+        static Float load(const float* p) noexcept { Float r; std::copy_n(p, kLanes, r.v); return r; }
+        static void store(float* p, Float a) noexcept { std::copy_n(a.v, kLanes, p); }
+        static Float add(Float a, Float b) noexcept { for (int l = 0; l < kLanes; ++l) a.v[l] += b.v[l]; return a; }
+        static Float sub(Float a, Float b) noexcept { for (int l = 0; l < kLanes; ++l) a.v[l] -= b.v[l]; return a; }
+        static Float mul(Float a, Float b) noexcept { for (int l = 0; l < kLanes; ++l) a.v[l] *= b.v[l]; return a; }
+    };
+  #endif
+
+    // Transition half-widths are relative to the stage's output rate: the
+    // passband ends at 0.25 - transition, the stopband starts at 0.25 + transition.
+    struct IirSpec
+    {
+        int numCoefs;
+        double transition;
+    };
+
+    // ~54 dB, then ~44 / ~53 dB where the later stages' stopbands begin
+    static constexpr IirSpec kIirSpecs[kMaxOrder] = { { 4, 0.05 }, { 2, 0.15 }, { 2, 0.2 } };
+
+    struct FirSpec
+    {
+        double transition;
+        double attenuationDb;
+    };
+
+    static constexpr FirSpec kFirSpecs[kMaxOrder] = { { 0.05, 90.0 }, { 0.15, 80.0 }, { 0.2, 70.0 } };
+
+    //==========================================================================
+    struct Stage
+    {
+        // Output of processUp() at this stage's rate, per channel
+        std::vector<float> output[kMaxChannels];
+
+        // Round trip delay at this stage's output rate
+        double latency = 0.0;
+
+        //----------------------------------------------------------------------
+        // IIR: lane l runs channel l / 2 through path l % 2
+        int numAllpasses = 0;
+        alignas(16) float coefs[kMaxAllpasses][kLanes] = {};
+        alignas(16) float upX[kMaxAllpasses][kLanes] = {};
+        alignas(16) float upY[kMaxAllpasses][kLanes] = {};
+        alignas(16) float downX[kMaxAllpasses][kLanes] = {};
+        alignas(16) float downY[kMaxAllpasses][kLanes] = {};
+
+        //----------------------------------------------------------------------
+        // FIR: the non-zero taps g[0..numTaps) of the even-index branch
+        // (symmetric), the odd branch being the 0.5 centre tap alone at
+        // centreDelay. Inputs are kept behind historyLength samples of past
+        // input so the convolution never wraps.
+        std::vector<float> taps;
+        int numTaps = 0;
+        int centreDelay = 0;
+        int historyLength = 0;
+        std::vector<float> history[kMaxChannels];      // up: input
+        std::vector<float> evenHistory[kMaxChannels];  // down: even input samples
+        std::vector<float> oddHistory[kMaxChannels];   // down: odd input samples
+        std::vector<float> scratch;
+
+        void reset(int channels) noexcept
+        {
+            for (int k = 0; k < kMaxAllpasses; ++k)
+                for (int l = 0; l < kLanes; ++l)
+                    upX[k][l] = upY[k][l] = downX[k][l] = downY[k][l] = 0.0f;
+
+            for (int ch = 0; ch < channels; ++ch)
+            {
+                std::fill(history[ch].begin(), history[ch].end(), 0.0f);
+                std::fill(evenHistory[ch].begin(), evenHistory[ch].end(), 0.0f);
+                std::fill(oddHistory[ch].begin(), oddHistory[ch].end(), 0.0f);
+            }
+        }
+
+        //----------------------------------------------------------------------
+        // Elliptic two-path halfband (Valenzuela & Constantinides): numCoefs
+        // first-order allpass coefficients, even ones on path 0, odd ones on
+        // path 1, each path an allpass chain in z^-2 at the output rate.
+        void designIir(int numCoefs, double transition)
+        {
+            double k = std::tan((1.0 - 4.0 * transition) * kPi / 4.0);
+            k *= k;
+            const double kk = std::pow(1.0 - k * k, 0.25);
+            const double e = 0.5 * (1.0 - kk) / (1.0 + kk);
+            const double e4 = e * e * e * e;
+            const double q = e * (1.0 + e4 * (2.0 + e4 * (15.0 + 150.0 * e4)));
+
+            const int filterOrder = 2 * numCoefs + 1;
+            double designed[kMaxIirCoefs] = {};
+
+            for (int i = 0; i < numCoefs; ++i)
+            {
+                const int c = i + 1;
+
+                double num = 0.0, den = 0.0, term = 0.0;
+                double sign = 1.0;
+                for (int n = 0; n == 0 || std::abs(term) > 1.0e-100; ++n, sign = -sign)
+                {
+                    term = sign * std::pow(q, n * (n + 1)) * std::sin((2 * n + 1) * c * kPi / filterOrder);
+                    num += term;
+                }
+                sign = -1.0;
+                for (int n = 1; n == 1 || std::abs(term) > 1.0e-100; ++n, sign = -sign)
+                {
+                    term = sign * std::pow(q, n * n) * std::cos(2 * n * c * kPi / filterOrder);
+                    den += term;
+                }
+
+                const double ww = num * std::pow(q, 0.25) / (den + 0.5);
+                const double wwSquared = ww * ww;
+                const double x = std::sqrt((1.0 - wwSquared * k) * (1.0 - wwSquared / k)) / (1.0 + wwSquared);
+                designed[i] = (1.0 - x) / (1.0 + x);
+            }
+
+            numAllpasses = numCoefs / 2;
+            for (int a = 0; a < kMaxAllpasses; ++a)
+                for (int l = 0; l < kLanes; ++l)
+                    coefs[a][l] = a < numAllpasses ? static_cast<float>(designed[2 * a + (l & 1)]) : 0.0f;
+
+            // H(z) = (A0(z^2) + z^-1 A1(z^2)) / 2 at the output rate. The
+            // upsampler delays by H's group delay, the decimator (which feeds
+            // path 0 the odd sample) by one sample less.
+            const double w = 1.0e-4;
+            const std::complex<double> z = std::polar(1.0, w);
+            const std::complex<double> zSquaredInv = 1.0 / (z * z);
+            std::complex<double> path[2] = { 1.0, 1.0 };
+            for (int i = 0; i < numCoefs; ++i)
+                path[i & 1] *= (designed[i] + zSquaredInv) / (1.0 + designed[i] * zSquaredInv);
+
+            const double groupDelay = -std::arg(0.5 * (path[0] + path[1] / z)) / w;
+            latency = 2.0 * groupDelay - 1.0;
+            historyLength = 0;
+        }
+
+        // Kaiser-windowed halfband, 4m + 3 taps so the centre tap lands on the
+        // odd branch and both branches are causal
+        void designFir(double transition, double attenuationDb)
+        {
+            const double beta = 0.1102 * (attenuationDb - 8.7);
+            const int estimate = static_cast<int>(std::ceil((attenuationDb - 7.95) / (14.36 * 2.0 * transition))) + 1;
+            const int m = std::max(estimate / 4, 1);  // ceil((estimate - 3) / 4)
+            const int length = 4 * m + 3;
+            const int half = (length - 1) / 2;
+
+            numTaps = 2 * m + 2;
+            centreDelay = m + 1;
+            historyLength = numTaps;
+            taps.assign(static_cast<size_t>(numTaps), 0.0f);
+
+            double sum = 0.0;
+            std::vector<double> designed(static_cast<size_t>(numTaps));
+            for (int j = 0; j < numTaps; ++j)
+            {
+                const int n = 2 * j - half;  // odd offset from the centre
+                const double r = static_cast<double>(n) / half;
+                const double window = besselI0(beta * std::sqrt(std::max(0.0, 1.0 - r * r))) / besselI0(beta);
+                designed[static_cast<size_t>(j)] = std::sin(0.5 * kPi * n) / (kPi * n) * window;
+                sum += designed[static_cast<size_t>(j)];
+            }
+
+            // DC gain of exactly 0.5 from the even branch
+            for (int j = 0; j < numTaps; ++j)
+                taps[static_cast<size_t>(j)] = static_cast<float>(0.5 * designed[static_cast<size_t>(j)] / sum);
+
+            latency = 2.0 * half;
+        }
+
+        static double besselI0(double x) noexcept
+        {
+            double sum = 1.0, term = 1.0;
+            for (int k = 1; k < 50; ++k)
+            {
+                const double t = x / (2.0 * k);
+                term *= t * t;
+                sum += term;
+                if (term < 1.0e-12 * sum)
+                    break;
+            }
+            return sum;
+        }
+
+        //----------------------------------------------------------------------
+        // Runs the allpass chains over length frames with the state held in
+        // registers. Each frame's four lanes come from gather(n, lanes) and go
+        // to scatter(n, lanes). One first-order allpass per path step,
+        // y = a x + x[-1] - a y[-1], so only a multiply and a subtract sit on
+        // the feedback path.
+        template <int Count, typename Gather, typename Scatter>
+        static void runAllpasses(const float (*a)[kLanes], float (*xs)[kLanes], float (*ys)[kLanes], int length,
+                                 Gather gather, Scatter scatter) noexcept
+        {
+            using Ops = LaneOps;
+
+            typename Ops::Float coef[kMaxAllpasses], x1[kMaxAllpasses], y1[kMaxAllpasses];
+            for (int k = 0; k < Count; ++k)
+            {
+                coef[k] = Ops::load(a[k]);
+                x1[k] = Ops::load(xs[k]);
+                y1[k] = Ops::load(ys[k]);
+            }
+
+            alignas(16) float lanes[kLanes];
+            for (int n = 0; n < length; ++n)
+            {
+                gather(n, lanes);
+                auto v = Ops::load(lanes);
+
+                for (int k = 0; k < Count; ++k)
+                {
+                    const auto y = Ops::sub(Ops::add(Ops::mul(coef[k], v), x1[k]), Ops::mul(coef[k], y1[k]));
+                    x1[k] = v;
+                    y1[k] = y;
+                    v = y;
+                }
+
+                Ops::store(lanes, v);
+                scatter(n, lanes);
+            }
+
+            for (int k = 0; k < Count; ++k)
+            {
+                Ops::store(xs[k], x1[k]);
+                Ops::store(ys[k], y1[k]);
+            }
+        }
+
+        template <typename Gather, typename Scatter>
+        void runIir(float (*xs)[kLanes], float (*ys)[kLanes], int length, Gather gather, Scatter scatter) noexcept
+        {
+            if (numAllpasses == 1)
+                runAllpasses<1>(coefs, xs, ys, length, gather, scatter);
+            else
+                runAllpasses<2>(coefs, xs, ys, length, gather, scatter);
+        }
+
+        void upIir(const float* const* input, int channels, int length) noexcept
+        {
+            const float* in0 = input[0];
+            const float* in1 = channels > 1 ? input[1] : in0;
+            float* out0 = output[0].data();
+            float* out1 = channels > 1 ? output[1].data() : nullptr;
+
+            // Mono runs channel 0 through the second pair of lanes too
+            runIir(upX, upY, length,
+                   [=](int n, float* lanes) noexcept
+                   {
+                       lanes[0] = lanes[1] = in0[n];
+                       lanes[2] = lanes[3] = in1[n];
+                   },
+                   [=](int n, const float* lanes) noexcept
+                   {
+                       out0[2 * n] = lanes[0];
+                       out0[2 * n + 1] = lanes[1];
+                       if (out1 != nullptr)
+                       {
+                           out1[2 * n] = lanes[2];
+                           out1[2 * n + 1] = lanes[3];
+                       }
+                   });
+        }
+
+        // Path 0 takes the odd input sample, path 1 the even one
+        void downIir(float* const* dest, int channels, int length) noexcept
+        {
+            const float* in0 = output[0].data();
+            const float* in1 = channels > 1 ? output[1].data() : in0;
+            float* out0 = dest[0];
+            float* out1 = channels > 1 ? dest[1] : nullptr;
+
+            runIir(downX, downY, length,
+                   [=](int n, float* lanes) noexcept
+                   {
+                       lanes[0] = in0[2 * n + 1];
+                       lanes[1] = in0[2 * n];
+                       lanes[2] = in1[2 * n + 1];
+                       lanes[3] = in1[2 * n];
+                   },
+                   [=](int n, const float* lanes) noexcept
+                   {
+                       out0[n] = 0.5f * (lanes[0] + lanes[1]);
+                       if (out1 != nullptr)
+                           out1[n] = 0.5f * (lanes[2] + lanes[3]);
+                   });
+        }
+
+        //----------------------------------------------------------------------
+        // Symmetric dot product over the even branch, vectorised across n:
+        // out[n] = sum_j taps[j] * in[n - j] for in[-historyLength..length)
+        void convolveEvenBranch(const float* in, float* out, int length) const noexcept
+        {
+            std::fill_n(out, length, 0.0f);
+
+            for (int j = 0; j < numTaps / 2; ++j)
+            {
+                const float g = taps[static_cast<size_t>(j)];
+                const float* near = in - j;
+                const float* far = in - (numTaps - 1 - j);
+                for (int n = 0; n < length; ++n)
+                    out[n] += g * (near[n] + far[n]);
+            }
+        }
+
+        static void shiftHistory(std::vector<float>& buffer, int historyLength, int length) noexcept
+        {
+            std::copy_n(buffer.data() + length, historyLength, buffer.data());
+        }
+
+        void upFir(const float* const* input, int channels, int length) noexcept
+        {
+            for (int ch = 0; ch < channels; ++ch)
+            {
+                float* in = history[ch].data() + historyLength;
+                std::copy_n(input[ch], length, in);
+
+                // Even outputs: 2 x the even branch; odd outputs: 2 x 0.5 x the
+                // delayed input
+                float* even = scratch.data();
+                convolveEvenBranch(in, even, length);
+
+                float* out = output[ch].data();
+                const float* centre = in - (centreDelay - 1);
+                for (int n = 0; n < length; ++n)
+                {
+                    out[2 * n] = 2.0f * even[n];
+                    out[2 * n + 1] = centre[n];
+                }
+
+                shiftHistory(history[ch], historyLength, length);
+            }
+        }
+
+        void downFir(float* const* dest, int channels, int length) noexcept
+        {
+            for (int ch = 0; ch < channels; ++ch)
+            {
+                float* even = evenHistory[ch].data() + historyLength;
+                float* odd = oddHistory[ch].data() + historyLength;
+                const float* in = output[ch].data();
+                for (int n = 0; n < length; ++n)
+                {
+                    even[n] = in[2 * n];
+                    odd[n] = in[2 * n + 1];
+                }
+
+                float* out = dest[ch];
+                convolveEvenBranch(even, out, length);
+
+                const float* centre = odd - centreDelay;
+                for (int n = 0; n < length; ++n)
+                    out[n] += 0.5f * centre[n];
+
+                shiftHistory(evenHistory[ch], historyLength, length);
+                shiftHistory(oddHistory[ch], historyLength, length);
+            }
+        }
+    };
+
+    Stage stages[kMaxOrder];
+    std::vector<float> passThrough[kMaxChannels];
+    float* channelPointers[kMaxChannels] = {};
+
+    int numChannels = 1;
+    int numStages = 0;
+    int maxSamples = 0;
+    HalfbandFilter filter = HalfbandFilter::LinearPhase;
+    double latency = 0.0;
+};
+
+} // namespace pfs
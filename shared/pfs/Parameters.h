@@ -0,0 +1,262 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+
+//==============================================================================
+/**
+ * Compile-time parameter tables.
+ *
+ *   enum Param { kGain, kPan, kNumParams };
+ *   static constexpr std::array<pfs::ParamSpec, kNumParams> kParamSpecs {{
+ *       pfs::floatParam("GAIN", "Gain", -60.0f, 0.0f, 0.1f, 1.0f, 0.0f, "dB", 0.02f),
+ *       pfs::floatParam("PAN",  "Pan", -100.0f, 100.0f, 0.1f, 1.0f, 0.0f, "%"),
+ *   }};
+ *
+ *   parameters(*this, nullptr, "Parameters", pfs::createParameterLayout(kParamSpecs))
+ *   pfs::ParameterSet<Param, kNumParams> params { parameters, kParamSpecs };
+ *
+ *   const float pan = params.get(kPan);                      // processBlock: one atomic load
+ *   const auto gain = params.getRamp(kGain, numSamples);     // glides over 20 ms
+ *   gain.multiply(buffer.getWritePointer(0));
+ *
+ * The table builds the APVTS layout (same IDs, ranges and order as the
+ * hand-written layouts it replaces, so saved state and automation are
+ * unaffected). ParameterSet resolves every std::atomic<float>* once at
+ * construction, so processBlock() and voices do no string lookups.
+ *
+ * Ramps are block-rate. A parameter with smoothingSeconds > 0 glides linearly
+ * towards each new value. getRamp() advances the glide by one block and returns
+ * the segment as start/end values, for loops like data[i] *= start + i * step.
+ * A parameter that is not moving returns a flat ramp.
+ *
+ * Unlike the rest of pfs/, this header needs juce_audio_processors.
+ */
+namespace pfs
+{
+
+//==============================================================================
+enum class ParamType
+{
+    Float,
+    Bool,
+    Choice
+};
+
+struct ParamSpec
+{
+    const char* id = "";
+    const char* name = "";
+    ParamType type = ParamType::Float;
+    float minValue = 0.0f;
+    float maxValue = 1.0f;
+    float step = 0.0f;
+    float skew = 1.0f;
+    float defaultValue = 0.0f;       // plain value; choice index; 0/1 for bools
+    const char* label = "";
+    const char* choices = "";        // "A|B|C" for ParamType::Choice
+    float smoothingSeconds = 0.0f;   // > 0: getRamp() glides over this time
+    int version = 1;
+};
+
+constexpr ParamSpec floatParam(const char* id, const char* name, float minValue, float maxValue, float step,
+                               float skew, float defaultValue, const char* label = "",
+                               float smoothingSeconds = 0.0f) noexcept
+{
+    return { id, name, ParamType::Float, minValue, maxValue, step, skew, defaultValue, label, "", smoothingSeconds, 1 };
+}
+
+constexpr ParamSpec boolParam(const char* id, const char* name, bool defaultValue) noexcept
+{
+    return { id, name, ParamType::Bool, 0.0f, 1.0f, 1.0f, 1.0f, defaultValue ? 1.0f : 0.0f, "", "", 0.0f, 1 };
+}
+
+constexpr ParamSpec choiceParam(const char* id, const char* name, const char* choices, int defaultIndex) noexcept
+{
+    return { id, name, ParamType::Choice, 0.0f, 0.0f, 1.0f, 1.0f, static_cast<float>(defaultIndex), "", choices, 0.0f, 1 };
+}
+
+namespace detail
+{
+    constexpr bool equalIds(const char* a, const char* b) noexcept
+    {
+        while (*a != '\0' && *a == *b)
+        {
+            ++a;
+            ++b;
+        }
+        return *a == *b;
+    }
+} // namespace detail
+
+// static_assert(pfs::hasUniqueIds(kParamSpecs)) next to each table
+template <std::size_t N>
+constexpr bool hasUniqueIds(const std::array<ParamSpec, N>& specs) noexcept
+{
+    for (std::size_t i = 0; i < N; ++i)
+        for (std::size_t j = i + 1; j < N; ++j)
+            if (detail::equalIds(specs[i].id, specs[j].id))
+                return false;
+    return true;
+}
+
+template <std::size_t N>
+juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout(const std::array<ParamSpec, N>& specs)
+{
+    juce::AudioProcessorValueTreeState::ParameterLayout layout;
+
+    for (const auto& spec : specs)
+    {
+        const juce::ParameterID parameterId { spec.id, spec.version };
+
+        switch (spec.type)
+        {
+            case ParamType::Float:
+                layout.add(std::make_unique<juce::AudioParameterFloat>(
+                    parameterId, spec.name,
+                    juce::NormalisableRange<float>(spec.minValue, spec.maxValue, spec.step, spec.skew),
+                    spec.defaultValue,
+                    juce::AudioParameterFloatAttributes().withLabel(spec.label)));
+                break;
+
+            case ParamType::Bool:
+                layout.add(std::make_unique<juce::AudioParameterBool>(parameterId, spec.name, spec.defaultValue >= 0.5f));
+                break;
+
+            case ParamType::Choice:
+                layout.add(std::make_unique<juce::AudioParameterChoice>(
+                    parameterId, spec.name, juce::StringArray::fromTokens(spec.choices, "|", ""),
+                    static_cast<int>(spec.defaultValue)));
+                break;
+        }
+    }
+
+    return layout;
+}
+
+//==============================================================================
+// One block of a parameter glide: sample i has value start + i * getStep()
+struct BlockRamp
+{
+    float start = 0.0f;
+    float end = 0.0f;
+    int numSamples = 0;
+
+    bool isSmoothing() const noexcept { return start != end; }
+    float getStep() const noexcept { return numSamples > 0 ? (end - start) / static_cast<float>(numSamples) : 0.0f; }
+    float getValue(int sample) const noexcept { return start + getStep() * static_cast<float>(sample); }
+
+    void fill(float* dest) const noexcept
+    {
+        const float step = getStep();
+        for (int i = 0; i < numSamples; ++i)
+            dest[i] = start + step * static_cast<float>(i);
+    }
+
+    void multiply(float* data) const noexcept
+    {
+        if (!isSmoothing())
+        {
+            for (int i = 0; i < numSamples; ++i)
+                data[i] *= start;
+            return;
+        }
+
+        const float step = getStep();
+        for (int i = 0; i < numSamples; ++i)
+            data[i] *= start + step * static_cast<float>(i);
+    }
+};
+
+//==============================================================================
+template <typename Id, std::size_t N>
+class ParameterSet
+{
+public:
+    ParameterSet(juce::AudioProcessorValueTreeState& state, const std::array<ParamSpec, N>& specs)
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            values[i] = state.getRawParameterValue(specs[i].id);
+            jassert(values[i] != nullptr); // table and layout out of sync
+
+            glides[i].smoothingSeconds = specs[i].smoothingSeconds;
+            glides[i].current = glides[i].target = values[i]->load(std::memory_order_relaxed);
+        }
+    }
+
+    //==========================================================================
+    float get(Id id) const noexcept { return values[index(id)]->load(std::memory_order_relaxed); }
+    bool getBool(Id id) const noexcept { return get(id) >= 0.5f; }
+    int getChoice(Id id) const noexcept { return static_cast<int>(get(id)); }
+
+    //==========================================================================
+    // Snaps every glide to the current value (prepareToPlay / reset)
+    void prepare(double sampleRate) noexcept
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            auto& glide = glides[i];
+            glide.rampSamples = static_cast<int>(std::lround(glide.smoothingSeconds * sampleRate));
+            glide.current = glide.target = values[i]->load(std::memory_order_relaxed);
+            glide.samplesLeft = 0;
+        }
+    }
+
+    // Audio thread: advances the parameter's glide by numSamples. Call at most
+    // once per parameter per block.
+    BlockRamp getRamp(Id id, int numSamples) noexcept
+    {
+        auto& glide = glides[index(id)];
+        const float value = get(id);
+
+        if (value != glide.target)
+        {
+            glide.target = value;
+            glide.samplesLeft = glide.rampSamples;
+        }
+
+        BlockRamp ramp;
+        ramp.start = glide.current;
+        ramp.numSamples = numSamples;
+
+        if (glide.samplesLeft <= numSamples)
+        {
+            glide.current = glide.target;
+            glide.samplesLeft = 0;
+        }
+        else
+        {
+            glide.current += (glide.target - glide.current) * static_cast<float>(numSamples) / static_cast<float>(glide.samplesLeft);
+            glide.samplesLeft -= numSamples;
+        }
+
+        // A parameter without smoothing jumps at the block start
+        if (glide.rampSamples == 0)
+            ramp.start = glide.current;
+
+        ramp.end = glide.current;
+        return ramp;
+    }
+
+private:
+    static constexpr std::size_t index(Id id) noexcept { return static_cast<std::size_t>(id); }
+
+    struct Glide
+    {
+        float smoothingSeconds = 0.0f;
+        int rampSamples = 0;
+        int samplesLeft = 0;
+        float current = 0.0f;
+        float target = 0.0f;
+    };
+
+    std::array<std::atomic<float>*, N> values {};
+    std::array<Glide, N> glides {};
+};
+
+} // namespace pfs
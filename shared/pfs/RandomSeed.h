@@ -0,0 +1,77 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+//==============================================================================
+/**
+ * Seeds for plugin-owned random generators.
+ *
+ *   juce::Random random { pfs::nextRandomSeed() };
+ *
+ * By default every call returns a fresh time-based seed, which is what a
+ * default-constructed juce::Random does. After setDeterministicRandomSeed(s),
+ * the N-th call returns a fixed function of (s, N). Processors construct their
+ * members in a fixed order, so a harness that sets the seed right before
+ * creating a processor gets identical noise, jitter and LFO phases every run.
+ * The golden renders rely on this.
+ *
+ * Call it from constructors and prepareToPlay() only, not per sample.
+ */
+namespace pfs
+{
+
+namespace detail
+{
+    struct RandomSeedState
+    {
+        std::atomic<bool> deterministic { false };
+        std::atomic<std::uint64_t> base { 0 };
+        std::atomic<std::uint64_t> counter { 0 };
+    };
+
+    inline RandomSeedState& getRandomSeedState() noexcept
+    {
+        static RandomSeedState state;
+        return state;
+    }
+
+    // SplitMix64 finaliser: neighbouring indices give unrelated seeds
+    inline std::uint64_t mixSeed(std::uint64_t x) noexcept
+    {
+        x += 0x9E3779B97F4A7C15ull;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+} // namespace detail
+
+inline void setDeterministicRandomSeed(std::int64_t seed) noexcept
+{
+    auto& state = detail::getRandomSeedState();
+    state.base.store(static_cast<std::uint64_t>(seed), std::memory_order_relaxed);
+    state.counter.store(0, std::memory_order_relaxed);
+    state.deterministic.store(true, std::memory_order_release);
+}
+
+inline void clearDeterministicRandomSeed() noexcept
+{
+    detail::getRandomSeedState().deterministic.store(false, std::memory_order_release);
+}
+
+inline std::int64_t nextRandomSeed() noexcept
+{
+    auto& state = detail::getRandomSeedState();
+    const auto index = state.counter.fetch_add(1, std::memory_order_relaxed);
+
+    std::uint64_t seed;
+    if (state.deterministic.load(std::memory_order_acquire))
+        seed = state.base.load(std::memory_order_relaxed) + index;
+    else
+        seed = static_cast<std::uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count()) ^ (index << 32);
+
+    return static_cast<std::int64_t>(detail::mixSeed(seed));
+}
+
+} // namespace pfs
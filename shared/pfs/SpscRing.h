@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+//==============================================================================
+/**
+ * Wait-free single-producer / single-consumer ring of trivially copyable items.
+ *
+ * The audio thread push()es, exactly one other thread pop()s. Neither side ever
+ * blocks or allocates; push() drops the item and returns false when the reader
+ * has fallen a full ring behind. Indices grow monotonically and are masked on
+ * access, so Capacity must be a power of two and all slots are usable.
+ */
+namespace pfs
+{
+
+#if defined(_MSC_VER)
+ #pragma warning(push)
+ #pragma warning(disable : 4324) // padded because of alignas - intended
+#endif
+
+template <typename T, std::size_t Capacity>
+class SpscRing
+{
+public:
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRing items are copied with plain assignment");
+
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+
+    // Producer side
+    bool push(const T& item) noexcept
+    {
+        const auto write = writeIndex.load(std::memory_order_relaxed);
+        if (write - readIndex.load(std::memory_order_acquire) == Capacity)
+            return false;
+
+        slots[write & kMask] = item;
+        writeIndex.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& item) noexcept
+    {
+        const auto read = readIndex.load(std::memory_order_relaxed);
+        if (read == writeIndex.load(std::memory_order_acquire))
+            return false;
+
+        item = slots[read & kMask];
+        readIndex.store(read + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Approximate from either side; exact when the other side is idle
+    std::size_t getNumReady() const noexcept
+    {
+        return writeIndex.load(std::memory_order_acquire) - readIndex.load(std::memory_order_acquire);
+    }
+
+    // Only while neither side is running (e.g. from prepareToPlay)
+    void reset() noexcept
+    {
+        writeIndex.store(0, std::memory_order_relaxed);
+        readIndex.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr std::size_t kMask = Capacity - 1;
+
+    // Separate cache lines so the two threads do not false-share
+    alignas(64) std::atomic<std::size_t> writeIndex { 0 };
+    alignas(64) std::atomic<std::size_t> readIndex { 0 };
+    alignas(64) std::array<T, Capacity> slots {};
+};
+
+#if defined(_MSC_VER)
+ #pragma warning(pop)
+#endif
+
+} // namespace pfs
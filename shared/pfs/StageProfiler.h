@@ -0,0 +1,234 @@
+#pragma once
+
+#include "SpscRing.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <initializer_list>
+
+//==============================================================================
+/**
+ * Per-stage processBlock() profiler.
+ *
+ *   PFS_PROFILE_BLOCK(profiler, numSamples, sampleRate);   // top of processBlock
+ *   {
+ *       PFS_PROFILE_STAGE(profiler, kStageFdnA);            // any scope
+ *       ...
+ *   }
+ *
+ * Both macros expand to nothing unless the build sets PFS_PROFILING=1
+ * (CMake: -DPFS_PROFILING=ON), so instrumented plugins ship with no timing code.
+ * Stage scopes may be entered any number of times per block and accumulate.
+ * When the block scope closes, one ProfileFrame (block ns, per-stage ns, buffer
+ * deadline) is pushed into a wait-free SPSC ring. The ring is sized for an editor
+ * timer draining at ~10 Hz at the smallest block size. If the reader falls behind,
+ * frames are dropped and counted.
+ *
+ * drain() runs on the reader thread (editor timer or harness). It folds every
+ * queued frame into a ProfileSummary: mean ns per stage and block, mean deadline,
+ * and the worst block load.
+ */
+#ifndef PFS_PROFILING
+ #define PFS_PROFILING 0
+#endif
+
+namespace pfs
+{
+
+//==============================================================================
+struct ProfileFrame
+{
+    static constexpr int kMaxStages = 12;
+
+    std::uint32_t numSamples = 0;
+    float sampleRate = 0.0f;
+    float blockNs = 0.0f;
+    std::array<float, kMaxStages> stageNs {};
+};
+
+struct ProfileSummary
+{
+    int numBlocks = 0;
+    int numDropped = 0;
+    double meanBlockNs = 0.0;
+    double meanDeadlineNs = 0.0;
+    double peakBlockLoad = 0.0;
+    std::array<double, ProfileFrame::kMaxStages> meanStageNs {};
+
+    // Fraction of the buffer deadline spent in processBlock (1.0 = dropout)
+    double getLoad() const noexcept { return meanDeadlineNs > 0.0 ? meanBlockNs / meanDeadlineNs : 0.0; }
+
+    double getStageLoad(int stage) const noexcept
+    {
+        return meanDeadlineNs > 0.0 ? meanStageNs[static_cast<std::size_t>(stage)] / meanDeadlineNs : 0.0;
+    }
+};
+
+//==============================================================================
+class StageProfiler
+{
+public:
+    static constexpr int kMaxStages = ProfileFrame::kMaxStages;
+    static constexpr std::size_t kRingSize = 256;
+
+    static constexpr bool isEnabled() noexcept { return PFS_PROFILING != 0; }
+
+    // Stage names are stored by pointer: pass string literals
+    StageProfiler(std::initializer_list<const char*> names) noexcept
+    {
+        for (auto* name : names)
+            if (numStages < kMaxStages)
+                stageNames[static_cast<std::size_t>(numStages++)] = name;
+    }
+
+    int getNumStages() const noexcept { return numStages; }
+    const char* getStageName(int stage) const noexcept { return stageNames[static_cast<std::size_t>(stage)]; }
+
+    static std::int64_t now() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    //==========================================================================
+    // Audio thread
+    void beginBlock(int numSamples, double sampleRate) noexcept
+    {
+        current.numSamples = static_cast<std::uint32_t>(std::max(0, numSamples));
+        current.sampleRate = static_cast<float>(sampleRate);
+        current.stageNs.fill(0.0f);
+        blockStartNs = now();
+    }
+
+    void addStageTime(int stage, std::int64_t elapsedNs) noexcept
+    {
+        current.stageNs[static_cast<std::size_t>(stage)] += static_cast<float>(elapsedNs);
+    }
+
+    void endBlock() noexcept
+    {
+        current.blockNs = static_cast<float>(now() - blockStartNs);
+
+        if (!frames.push(current))
+            numDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //==========================================================================
+    // Reader thread: folds every frame queued since the previous call
+    ProfileSummary drain() noexcept
+    {
+        ProfileSummary summary;
+        summary.numDropped = numDropped.exchange(0, std::memory_order_relaxed);
+
+        ProfileFrame frame;
+        while (frames.pop(frame))
+        {
+            if (frame.numSamples == 0 || frame.sampleRate <= 0.0f)
+                continue;
+
+            const double deadlineNs = static_cast<double>(frame.numSamples) / frame.sampleRate * 1.0e9;
+
+            ++summary.numBlocks;
+            summary.meanBlockNs += frame.blockNs;
+            summary.meanDeadlineNs += deadlineNs;
+            summary.peakBlockLoad = std::max(summary.peakBlockLoad, frame.blockNs / deadlineNs);
+
+            for (std::size_t stage = 0; stage < frame.stageNs.size(); ++stage)
+                summary.meanStageNs[stage] += frame.stageNs[stage];
+        }
+
+        if (summary.numBlocks > 0)
+        {
+            const double scale = 1.0 / summary.numBlocks;
+            summary.meanBlockNs *= scale;
+            summary.meanDeadlineNs *= scale;
+            for (auto& stageNs : summary.meanStageNs)
+                stageNs *= scale;
+        }
+
+        return summary;
+    }
+
+    // Only while the audio thread is stopped (prepareToPlay / releaseResources)
+    void reset() noexcept
+    {
+        frames.reset();
+        numDropped.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    std::array<const char*, kMaxStages> stageNames {};
+    int numStages = 0;
+
+    ProfileFrame current;
+    std::int64_t blockStartNs = 0;
+
+    std::atomic<int> numDropped { 0 };
+    SpscRing<ProfileFrame, kRingSize> frames;
+};
+
+//==============================================================================
+// Lets the harnesses find the profiler through a plain juce::AudioProcessor*
+class StageProfilerSource
+{
+public:
+    virtual ~StageProfilerSource() = default;
+    virtual StageProfiler& getStageProfiler() noexcept = 0;
+};
+
+//==============================================================================
+class ScopedBlockProfile
+{
+public:
+    ScopedBlockProfile(StageProfiler& p, int numSamples, double sampleRate) noexcept
+        : profiler(p)
+    {
+        profiler.beginBlock(numSamples, sampleRate);
+    }
+
+    ~ScopedBlockProfile() { profiler.endBlock(); }
+
+    ScopedBlockProfile(const ScopedBlockProfile&) = delete;
+    ScopedBlockProfile& operator=(const ScopedBlockProfile&) = delete;
+
+private:
+    StageProfiler& profiler;
+};
+
+class ScopedStageTimer
+{
+public:
+    ScopedStageTimer(StageProfiler& p, int stageIndex) noexcept
+        : profiler(p), stage(stageIndex), startNs(StageProfiler::now())
+    {
+    }
+
+    ~ScopedStageTimer() { profiler.addStageTime(stage, StageProfiler::now() - startNs); }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+    StageProfiler& profiler;
+    int stage;
+    std::int64_t startNs;
+};
+
+} // namespace pfs
+
+//==============================================================================
+#define PFS_PROFILE_CONCAT_INNER(a, b) a##b
+#define PFS_PROFILE_CONCAT(a, b) PFS_PROFILE_CONCAT_INNER(a, b)
+
+#if PFS_PROFILING
+ #define PFS_PROFILE_BLOCK(profiler, numSamples, sampleRate) \
+     ::pfs::ScopedBlockProfile PFS_PROFILE_CONCAT(pfsProfileBlock_, __LINE__)(profiler, numSamples, sampleRate)
+ #define PFS_PROFILE_STAGE(profiler, stage) \
+     ::pfs::ScopedStageTimer PFS_PROFILE_CONCAT(pfsProfileStage_, __LINE__)(profiler, static_cast<int>(stage))
+#else
+ #define PFS_PROFILE_BLOCK(profiler, numSamples, sampleRate) static_cast<void>(0)
+ #define PFS_PROFILE_STAGE(profiler, stage) static_cast<void>(0)
+#endif
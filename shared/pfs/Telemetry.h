@@ -0,0 +1,84 @@
+#pragma once
+
+#include "SpscRing.h"
+
+#include <atomic>
+#include <cstddef>
+
+//==============================================================================
+/**
+ * Audio-thread -> UI telemetry (meters, trigger LEDs, visualiser state).
+ *
+ *   struct MeterFrame { float peakL, peakR, gainReductionDb; };
+ *   pfs::TelemetryChannel<MeterFrame> meters;
+ *
+ *   meters.publish(frame);                                   // end of processBlock
+ *   meters.drain([&](const MeterFrame& f) { ... });          // editor timer: every frame
+ *   if (meters.readLatest(frame)) { ... }                    // editor timer: newest only
+ *
+ * Each frame is a whole POD struct copied through a pfs::SpscRing, so the
+ * reader never sees half of one block and half of the next, and the audio
+ * thread never waits. publish() is a struct copy plus two atomic index
+ * operations, cheap enough for every block.
+ *
+ * The reader decides how frames combine. drain() suits peaks (max over all
+ * frames) and triggers (OR over all frames); readLatest() suits state.
+ * While nobody reads (editor closed) the ring fills up and new frames are
+ * dropped and counted. Editors call clear() when they open so they start from
+ * fresh frames.
+ */
+namespace pfs
+{
+
+template <typename Frame, std::size_t Capacity = 256>
+class TelemetryChannel
+{
+public:
+    //==========================================================================
+    // Audio thread
+    void publish(const Frame& frame) noexcept
+    {
+        if (!ring.push(frame))
+            numDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //==========================================================================
+    // Reader thread (exactly one). Calls fn(frame) for every queued frame,
+    // oldest first. Returns how many there were.
+    template <typename Fn>
+    int drain(Fn&& fn) noexcept
+    {
+        Frame frame;
+        int numFrames = 0;
+
+        while (ring.pop(frame))
+        {
+            fn(static_cast<const Frame&>(frame));
+            ++numFrames;
+        }
+
+        return numFrames;
+    }
+
+    // Newest queued frame into `frame`, older ones discarded. Returns false (and
+    // leaves `frame` alone) if nothing was published since the last read.
+    bool readLatest(Frame& frame) noexcept
+    {
+        return drain([&frame](const Frame& queued) { frame = queued; }) > 0;
+    }
+
+    void clear() noexcept
+    {
+        drain([](const Frame&) {});
+        numDropped.store(0, std::memory_order_relaxed);
+    }
+
+    // Frames lost because the ring was full since the last call
+    int getNumDropped() noexcept { return numDropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+    SpscRing<Frame, Capacity> ring;
+    std::atomic<int> numDropped { 0 };
+};
+
+} // namespace pfs
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+// Defined by the plugin's shared-code target this harness links against
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+//==============================================================================
+// Shared helpers for the headless harnesses (benchmark, RT check, golden renders).
+// Everything here runs on the main thread with a MessageManager alive but never
+// dispatched, so processor timers are created but do not fire.
+//==============================================================================
+namespace harness
+{
+
+//==============================================================================
+// Processor lifetime
+//==============================================================================
+inline std::unique_ptr<juce::AudioProcessor> createProcessor()
+{
+    return std::unique_ptr<juce::AudioProcessor>(createPluginFilter());
+}
+
+inline int getNumBufferChannels(const juce::AudioProcessor& processor)
+{
+    return juce::jmax(1, processor.getTotalNumInputChannels(), processor.getTotalNumOutputChannels());
+}
+
+// Mirrors what a host does before the first processBlock()
+inline void prepare(juce::AudioProcessor& processor, double sampleRate, int blockSize, bool nonRealtime = false)
+{
+    processor.setNonRealtime(nonRealtime);
+    processor.setPlayConfigDetails(processor.getTotalNumInputChannels(),
+                                   processor.getTotalNumOutputChannels(),
+                                   sampleRate, blockSize);
+    processor.prepareToPlay(sampleRate, blockSize);
+}
+
+//==============================================================================
+// Parameter presets (generic: works on any processor's parameter list)
+//==============================================================================
+enum class Preset
+{
+    Default,
+    Minimum,
+    Maximum,
+    Random
+};
+
+inline const char* getPresetName(Preset preset)
+{
+    switch (preset)
+    {
+        case Preset::Default: return "default";
+        case Preset::Minimum: return "minimum";
+        case Preset::Maximum: return "maximum";
+        case Preset::Random:  return "random";
+    }
+    return "default";
+}
+
+inline bool parsePreset(const juce::String& name, Preset& preset)
+{
+    for (auto candidate : { Preset::Default, Preset::Minimum, Preset::Maximum, Preset::Random })
+    {
+        if (name.equalsIgnoreCase(getPresetName(candidate)))
+        {
+            preset = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Bypass switches stay at their defaults so min/max presets still measure the DSP path
+inline bool isBypassParameter(juce::AudioProcessorParameter& parameter)
+{
+    return parameter.getName(64).containsIgnoreCase("bypass");
+}
+
+inline void applyPreset(juce::AudioProcessor& processor, Preset preset, std::uint32_t seed = 1)
+{
+    juce::Random random(static_cast<juce::int64>(seed));
+
+    for (auto* parameter : processor.getParameters())
+    {
+        float value = parameter->getDefaultValue();
+
+        if (!isBypassParameter(*parameter))
+        {
+            switch (preset)
+            {
+                case Preset::Default: break;
+                case Preset::Minimum: value = 0.0f; break;
+                case Preset::Maximum: value = 1.0f; break;
+                case Preset::Random:  value = random.nextFloat(); break;
+            }
+        }
+
+        // NotifyingHost variant so APVTS raw values follow
+        parameter->setValueNotifyingHost(value);
+    }
+}
+
+//==============================================================================
+// Deterministic test signal: pink noise at -12 dBFS plus a MIDI note pattern
+// for processors that accept MIDI (drum machines / synths)
+//==============================================================================
+class SignalSource
+{
+public:
+    explicit SignalSource(std::uint32_t seed = 1)
+        : random(static_cast<juce::int64>(seed))
+    {
+    }
+
+    void prepare(double sampleRate)
+    {
+        noteIntervalSamples = juce::jmax(1, static_cast<int>(sampleRate * 0.25));  // 16ths at 60 BPM
+        noteLengthSamples = noteIntervalSamples / 2;
+        position = 0;
+        noteIndex = 0;
+        heldNote = -1;
+        std::fill(std::begin(pinkState), std::end(pinkState), 0.0f);
+    }
+
+    void fillAudio(juce::AudioBuffer<float>& buffer, int numInputChannels)
+    {
+        buffer.clear();
+
+        const int numSamples = buffer.getNumSamples();
+        const int channels = juce::jmin(numInputChannels, buffer.getNumChannels());
+
+        for (int sample = 0; sample < numSamples; ++sample)
+        {
+            const float value = nextPink() * 0.25f;  // ~ -12 dBFS
+            for (int channel = 0; channel < channels; ++channel)
+                buffer.setSample(channel, sample, value);
+        }
+    }
+
+    void fillMidi(juce::MidiBuffer& midi, int numSamples)
+    {
+        midi.clear();
+
+        for (int offset = 0; offset < numSamples; ++offset)
+        {
+            const auto absolute = position + offset;
+            const auto phase = static_cast<int>(absolute % noteIntervalSamples);
+
+            if (phase == noteLengthSamples && heldNote >= 0)
+            {
+                midi.addEvent(juce::MidiMessage::noteOff(1, heldNote), offset);
+                heldNote = -1;
+            }
+
+            if (phase == 0)
+            {
+                heldNote = kNotePattern[noteIndex];
+                noteIndex = (noteIndex + 1) % static_cast<int>(std::size(kNotePattern));
+                midi.addEvent(juce::MidiMessage::noteOn(1, heldNote, static_cast<juce::uint8>(100)), offset);
+            }
+        }
+
+        position += numSamples;
+    }
+
+private:
+    // Kick / snare / hats / toms and a chord spread for the pitched instruments
+    static constexpr int kNotePattern[] = { 36, 38, 42, 46, 48, 60, 64, 67 };
+
+    // Paul Kellet's economy pink filter
+    float nextPink()
+    {
+        const float white = random.nextFloat() * 2.0f - 1.0f;
+        pinkState[0] = 0.99765f * pinkState[0] + white * 0.0990460f;
+        pinkState[1] = 0.96300f * pinkState[1] + white * 0.2965164f;
+        pinkState[2] = 0.57000f * pinkState[2] + white * 1.0526913f;
+        return (pinkState[0] + pinkState[1] + pinkState[2] + white * 0.1848f) * 0.25f;
+    }
+
+    juce::Random random;
+    float pinkState[3] = { 0.0f, 0.0f, 0.0f };
+
+    juce::int64 position = 0;
+    int noteIntervalSamples = 1;
+    int noteLengthSamples = 0;
+    int noteIndex = 0;
+    int heldNote = -1;
+};
+
+//==============================================================================
+// Command line helpers
+//==============================================================================
+inline juce::String getOption(const juce::StringArray& args, const juce::String& name, const juce::String& fallback = {})
+{
+    const int index = args.indexOf(name);
+    if (index >= 0 && index + 1 < args.size())
+        return args[index + 1];
+    return fallback;
+}
+
+template <typename T>
+std::vector<T> getListOption(const juce::StringArray& args, const juce::String& name, std::vector<T> fallback)
+{
+    const auto text = getOption(args, name);
+    if (text.isEmpty())
+        return fallback;
+
+    std::vector<T> values;
+    for (const auto& token : juce::StringArray::fromTokens(text, ",", {}))
+        values.push_back(static_cast<T>(token.trim().getDoubleValue()));
+    return values;
+}
+
+inline std::int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace harness
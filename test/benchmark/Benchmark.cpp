@@ -0,0 +1,235 @@
+//==============================================================================
+// Headless throughput benchmark
+//
+// Times prepareToPlay() and processBlock() for one plugin over a matrix of
+// sample rates, block sizes and parameter presets, then writes JSON:
+//
+//   { "plugin": ..., "secondsPerCase": ..., "results": [ {
+//       "sampleRate", "blockSize", "preset", "latencySamples",
+//       "prepareNs", "nsPerSample", "realtimeFactor",
+//       "worstBlockNs", "worstBlockLoad", "memoryBytes", "memory" } ] }
+//
+// nsPerSample is wall time per sample frame (all channels). realtimeFactor is
+// rendered audio time / wall time, so > 1 means faster than realtime.
+// worstBlockLoad is the slowest block relative to its buffer deadline.
+// memoryBytes / memory ({ name: bytes }) are only written for plugins that
+// implement pfs::MemoryFootprintSource, measured right after prepareToPlay().
+//==============================================================================
+
+#include "HarnessCommon.h"
+
+#include <pfs/MemoryFootprint.h>
+
+#include <iostream>
+
+namespace
+{
+
+struct BenchmarkCase
+{
+    double sampleRate = 48000.0;
+    int blockSize = 64;
+    harness::Preset preset = harness::Preset::Default;
+};
+
+struct BenchmarkResult
+{
+    int latencySamples = 0;
+    std::int64_t prepareNs = 0;
+    double nsPerSample = 0.0;
+    double realtimeFactor = 0.0;
+    std::int64_t worstBlockNs = 0;
+    double worstBlockLoad = 0.0;
+    bool hasMemoryFootprint = false;
+    pfs::MemoryFootprint memory;
+};
+
+BenchmarkResult runCase(const BenchmarkCase& benchCase, double seconds, double warmupSeconds)
+{
+    BenchmarkResult result;
+
+    auto processor = harness::createProcessor();
+    harness::applyPreset(*processor, benchCase.preset);
+
+    const auto prepareStart = harness::nowNs();
+    harness::prepare(*processor, benchCase.sampleRate, benchCase.blockSize);
+    result.prepareNs = harness::nowNs() - prepareStart;
+    result.latencySamples = processor->getLatencySamples();
+
+    if (auto* source = dynamic_cast<pfs::MemoryFootprintSource*>(processor.get()))
+    {
+        source->getMemoryFootprint(result.memory);
+        result.hasMemoryFootprint = true;
+    }
+
+    juce::AudioBuffer<float> buffer(harness::getNumBufferChannels(*processor), benchCase.blockSize);
+    juce::MidiBuffer midi;
+    midi.ensureSize(256);
+
+    harness::SignalSource source;
+    source.prepare(benchCase.sampleRate);
+
+    const bool wantsMidi = processor->acceptsMidi();
+    const int numInputs = processor->getTotalNumInputChannels();
+
+    const auto blocksFor = [&](double duration)
+    {
+        return juce::jmax(1, static_cast<int>(duration * benchCase.sampleRate / benchCase.blockSize));
+    };
+
+    const auto renderBlock = [&]
+    {
+        source.fillAudio(buffer, numInputs);
+        if (wantsMidi)
+            source.fillMidi(midi, benchCase.blockSize);
+        else
+            midi.clear();
+
+        const auto start = harness::nowNs();
+        processor->processBlock(buffer, midi);
+        return harness::nowNs() - start;
+    };
+
+    // Warm caches, smoothers and any lazily sized state before measuring
+    for (int block = blocksFor(warmupSeconds); --block >= 0;)
+        renderBlock();
+
+    const int numBlocks = blocksFor(seconds);
+    std::int64_t totalNs = 0;
+
+    for (int block = 0; block < numBlocks; ++block)
+    {
+        const auto elapsed = renderBlock();
+        totalNs += elapsed;
+        result.worstBlockNs = juce::jmax(result.worstBlockNs, elapsed);
+    }
+
+    processor->releaseResources();
+
+    const double totalSamples = static_cast<double>(numBlocks) * benchCase.blockSize;
+    const double audioNs = totalSamples / benchCase.sampleRate * 1.0e9;
+    const double blockDeadlineNs = benchCase.blockSize / benchCase.sampleRate * 1.0e9;
+
+    result.nsPerSample = static_cast<double>(totalNs) / totalSamples;
+    result.realtimeFactor = totalNs > 0 ? audioNs / static_cast<double>(totalNs) : 0.0;
+    result.worstBlockLoad = static_cast<double>(result.worstBlockNs) / blockDeadlineNs;
+    return result;
+}
+
+void printUsage()
+{
+    std::cerr << "Usage: " << HARNESS_PLUGIN_NAME << "_Benchmark [options]\n"
+              << "  --rates    44100,48000,...   sample rates (default 44.1k-192k)\n"
+              << "  --blocks   16,32,...         block sizes (default 16-2048)\n"
+              << "  --presets  default,random    default|minimum|maximum|random\n"
+              << "  --seconds  N                 audio seconds timed per case (default 2)\n"
+              << "  --output   file.json         write JSON to a file instead of stdout\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(argv[i]);
+
+    if (args.contains("--help") || args.contains("-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    const auto rates = harness::getListOption<double>(args, "--rates",
+        { 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 });
+    const auto blocks = harness::getListOption<int>(args, "--blocks",
+        { 16, 32, 64, 128, 256, 512, 1024, 2048 });
+    const double seconds = harness::getOption(args, "--seconds", "2").getDoubleValue();
+
+    std::vector<harness::Preset> presets;
+    for (const auto& name : juce::StringArray::fromTokens(harness::getOption(args, "--presets", "default,minimum,maximum,random"), ",", {}))
+    {
+        harness::Preset preset;
+        if (!harness::parsePreset(name.trim(), preset))
+        {
+            std::cerr << "Unknown preset: " << name << "\n";
+            printUsage();
+            return 1;
+        }
+        presets.push_back(preset);
+    }
+
+    juce::Array<juce::var> results;
+
+    for (auto sampleRate : rates)
+    {
+        for (auto blockSize : blocks)
+        {
+            for (auto preset : presets)
+            {
+                const BenchmarkCase benchCase { sampleRate, blockSize, preset };
+                const auto result = runCase(benchCase, seconds, 0.25);
+
+                auto* entry = new juce::DynamicObject();
+                entry->setProperty("sampleRate", sampleRate);
+                entry->setProperty("blockSize", blockSize);
+                entry->setProperty("preset", harness::getPresetName(preset));
+                entry->setProperty("latencySamples", result.latencySamples);
+                entry->setProperty("prepareNs", static_cast<juce::int64>(result.prepareNs));
+                entry->setProperty("nsPerSample", result.nsPerSample);
+                entry->setProperty("realtimeFactor", result.realtimeFactor);
+                entry->setProperty("worstBlockNs", static_cast<juce::int64>(result.worstBlockNs));
+                entry->setProperty("worstBlockLoad", result.worstBlockLoad);
+
+                if (result.hasMemoryFootprint)
+                {
+                    auto* memory = new juce::DynamicObject();
+                    for (int i = 0; i < result.memory.getNumEntries(); ++i)
+                    {
+                        const auto& memoryEntry = result.memory.getEntry(i);
+                        memory->setProperty(memoryEntry.name, static_cast<juce::int64>(memoryEntry.bytes));
+                    }
+
+                    entry->setProperty("memoryBytes", static_cast<juce::int64>(result.memory.getTotalBytes()));
+                    entry->setProperty("memory", juce::var(memory));
+                }
+
+                results.add(juce::var(entry));
+
+                std::cerr << HARNESS_PLUGIN_NAME << " " << sampleRate << " Hz / " << blockSize
+                          << " / " << harness::getPresetName(preset) << ": "
+                          << result.nsPerSample << " ns/sample, x" << result.realtimeFactor << " realtime";
+                if (result.hasMemoryFootprint)
+                    std::cerr << ", " << (result.memory.getTotalBytes() + 512) / 1024 << " KB";
+                std::cerr << "\n";
+            }
+        }
+    }
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("plugin", HARNESS_PLUGIN_NAME);
+    root->setProperty("juceVersion", juce::SystemStats::getJUCEVersion());
+    root->setProperty("cpu", juce::SystemStats::getCpuModel());
+    root->setProperty("secondsPerCase", seconds);
+    root->setProperty("results", results);
+
+    const auto json = juce::JSON::toString(juce::var(root));
+    const auto outputPath = harness::getOption(args, "--output");
+
+    if (outputPath.isNotEmpty())
+    {
+        if (!juce::File::getCurrentWorkingDirectory().getChildFile(outputPath).replaceWithText(json))
+        {
+            std::cerr << "Could not write " << outputPath << "\n";
+            return 1;
+        }
+    }
+    else
+    {
+        std::cout << json << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,360 @@
+//==============================================================================
+// Golden-render regression test
+//
+// Renders fixed inputs through one plugin at 48 kHz / 256-sample blocks, with
+// fixed parameters and every plugin RNG seeded (pfs::setDeterministicRandomSeed
+// + juce::Random::getSystemRandom()). Each output is compared against
+//
+//   <references>/<Plugin>/<case>.wav        (32-bit float, written by --update)
+//
+// using the plugin's tolerance from budgets.json. A longer render is then timed
+// three times. The best ns/sample must stay under the plugin's CPU budget, and
+// the three outputs must be bit-identical (this catches unseeded randomness).
+//
+// Exit codes: 0 pass, 1 failure (including no references for this plugin),
+// 77 no references with --allow-missing (ctest skip).
+//==============================================================================
+
+#include "HarnessCommon.h"
+#include "golden/GoldenSignals.h"
+
+#include <pfs/RandomSeed.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iostream>
+
+namespace
+{
+
+constexpr double kSampleRate = 48000.0;
+constexpr int kBlockSize = 256;
+constexpr std::uint32_t kSeed = 1;
+constexpr int kSkipExitCode = 77;
+
+struct GoldenCase
+{
+    juce::String name;
+    harness::Preset preset = harness::Preset::Default;
+    double seconds = 1.0;
+    std::function<void(juce::AudioBuffer<float>&)> fillInput;
+    std::function<juce::MidiBuffer(int numSamples)> makeMidi;
+};
+
+struct Budget
+{
+    double maxAbsError = 1.0e-4;
+    double nsPerSample = 4000.0;
+};
+
+//==============================================================================
+std::vector<GoldenCase> makeCases(bool isInstrument)
+{
+    std::vector<GoldenCase> cases;
+
+    if (isInstrument)
+    {
+        const auto pattern = [](int numSamples) { return golden::makeNotePattern(kSampleRate, numSamples, kSeed); };
+
+        cases.push_back({ "midi-pattern", harness::Preset::Default, 1.0, nullptr, pattern });
+        cases.push_back({ "midi-chords", harness::Preset::Default, 1.0, nullptr,
+                          [](int) { return golden::makeChordSequence(kSampleRate); } });
+        cases.push_back({ "midi-random", harness::Preset::Random, 0.5, nullptr, pattern });
+        return cases;
+    }
+
+    cases.push_back({ "impulse", harness::Preset::Default, 0.75, golden::fillImpulse, nullptr });
+    cases.push_back({ "sweep", harness::Preset::Default, 0.75,
+                      [](juce::AudioBuffer<float>& input) { golden::fillSweep(input, kSampleRate, 0.5); }, nullptr });
+    cases.push_back({ "pink", harness::Preset::Default, 0.25,
+                      [](juce::AudioBuffer<float>& input) { golden::fillPinkNoise(input, kSeed); }, nullptr });
+    cases.push_back({ "pink-random", harness::Preset::Random, 0.25,
+                      [](juce::AudioBuffer<float>& input) { golden::fillPinkNoise(input, kSeed); }, nullptr });
+    cases.push_back({ "drums", harness::Preset::Default, 0.75,
+                      [](juce::AudioBuffer<float>& input) { golden::fillDrumLoop(input, kSampleRate, 0.5, kSeed); }, nullptr });
+    return cases;
+}
+
+//==============================================================================
+struct RenderResult
+{
+    juce::AudioBuffer<float> output;
+    std::int64_t processNs = 0;
+};
+
+RenderResult render(const GoldenCase& goldenCase)
+{
+    // Seed before construction: member RNGs draw their seeds in constructors
+    pfs::setDeterministicRandomSeed(kSeed);
+    juce::Random::getSystemRandom().setSeed(kSeed);
+
+    auto processor = harness::createProcessor();
+    harness::applyPreset(*processor, goldenCase.preset, kSeed);
+    harness::prepare(*processor, kSampleRate, kBlockSize);
+
+    const int numChannels = harness::getNumBufferChannels(*processor);
+    const int numInputs = processor->getTotalNumInputChannels();
+    const int numOutputs = juce::jmax(1, processor->getTotalNumOutputChannels());
+    const int numSamples = static_cast<int>(goldenCase.seconds * kSampleRate);
+
+    juce::AudioBuffer<float> input(juce::jmax(1, numInputs), numSamples);
+    input.clear();
+    if (goldenCase.fillInput != nullptr && numInputs > 0)
+        goldenCase.fillInput(input);
+
+    const auto midi = goldenCase.makeMidi != nullptr ? goldenCase.makeMidi(numSamples) : juce::MidiBuffer();
+
+    RenderResult result;
+    result.output.setSize(numOutputs, numSamples);
+
+    juce::AudioBuffer<float> buffer(numChannels, kBlockSize);
+    juce::MidiBuffer blockMidi;
+    blockMidi.ensureSize(256);
+
+    for (int start = 0; start < numSamples; start += kBlockSize)
+    {
+        const int length = juce::jmin(kBlockSize, numSamples - start);
+        juce::AudioBuffer<float> block(buffer.getArrayOfWritePointers(), numChannels, length);
+        block.clear();
+
+        for (int channel = 0; channel < numInputs; ++channel)
+            block.copyFrom(channel, 0, input, channel, start, length);
+
+        blockMidi.clear();
+        blockMidi.addEvents(midi, start, length, -start);
+
+        const auto blockStart = harness::nowNs();
+        processor->processBlock(block, blockMidi);
+        result.processNs += harness::nowNs() - blockStart;
+
+        for (int channel = 0; channel < numOutputs; ++channel)
+            result.output.copyFrom(channel, start, block, channel, 0, length);
+    }
+
+    processor->releaseResources();
+    return result;
+}
+
+//==============================================================================
+bool writeWav(const juce::File& file, const juce::AudioBuffer<float>& audio)
+{
+    file.getParentDirectory().createDirectory();
+    file.deleteFile();
+
+    auto stream = file.createOutputStream();
+    if (stream == nullptr)
+        return false;
+
+    juce::WavAudioFormat format;
+    std::unique_ptr<juce::AudioFormatWriter> writer(format.createWriterFor(stream.get(), kSampleRate,
+                                                                           static_cast<unsigned int>(audio.getNumChannels()),
+                                                                           32, {}, 0));
+    if (writer == nullptr)
+        return false;
+
+    stream.release(); // owned by the writer now
+    return writer->writeFromAudioSampleBuffer(audio, 0, audio.getNumSamples());
+}
+
+bool readWav(const juce::File& file, juce::AudioBuffer<float>& audio)
+{
+    juce::WavAudioFormat format;
+    std::unique_ptr<juce::AudioFormatReader> reader(format.createReaderFor(file.createInputStream().release(), true));
+    if (reader == nullptr)
+        return false;
+
+    audio.setSize(static_cast<int>(reader->numChannels), static_cast<int>(reader->lengthInSamples));
+    return reader->read(&audio, 0, audio.getNumSamples(), 0, true, true);
+}
+
+//==============================================================================
+struct Difference
+{
+    double maxAbsError = 0.0;
+    double errorDb = -300.0;  // RMS of the difference relative to RMS of the reference
+};
+
+Difference compare(const juce::AudioBuffer<float>& output, const juce::AudioBuffer<float>& reference)
+{
+    Difference difference;
+    double errorEnergy = 0.0;
+    double referenceEnergy = 0.0;
+
+    for (int channel = 0; channel < output.getNumChannels(); ++channel)
+    {
+        const float* out = output.getReadPointer(channel);
+        const float* ref = reference.getReadPointer(channel);
+
+        for (int sample = 0; sample < output.getNumSamples(); ++sample)
+        {
+            const double error = static_cast<double>(out[sample]) - ref[sample];
+            difference.maxAbsError = juce::jmax(difference.maxAbsError, std::abs(error));
+            errorEnergy += error * error;
+            referenceEnergy += static_cast<double>(ref[sample]) * ref[sample];
+        }
+    }
+
+    if (errorEnergy > 0.0)
+        difference.errorDb = 10.0 * std::log10(errorEnergy / juce::jmax(referenceEnergy, 1.0e-30));
+
+    return difference;
+}
+
+bool isBitIdentical(const juce::AudioBuffer<float>& a, const juce::AudioBuffer<float>& b)
+{
+    for (int channel = 0; channel < a.getNumChannels(); ++channel)
+        if (std::memcmp(a.getReadPointer(channel), b.getReadPointer(channel), sizeof(float) * static_cast<size_t>(a.getNumSamples())) != 0)
+            return false;
+    return true;
+}
+
+//==============================================================================
+Budget loadBudget(const juce::File& file)
+{
+    Budget budget;
+    const auto json = juce::JSON::parse(file);
+
+    const auto apply = [&budget](const juce::var& entry)
+    {
+        if (entry.hasProperty("maxAbsError"))
+            budget.maxAbsError = entry["maxAbsError"];
+        if (entry.hasProperty("nsPerSample"))
+            budget.nsPerSample = entry["nsPerSample"];
+    };
+
+    apply(json["default"]);
+    apply(json["plugins"][HARNESS_PLUGIN_NAME]);
+    return budget;
+}
+
+void printUsage()
+{
+    std::cerr << "Usage: " << HARNESS_PLUGIN_NAME << "_Golden [options]\n"
+              << "  --references dir     reference WAV root (default: test/golden/references)\n"
+              << "  --budgets file.json  tolerances and CPU budgets (default: test/golden/budgets.json)\n"
+              << "  --update             (re)write the references instead of comparing\n"
+              << "  --allow-missing      skip (exit 77) instead of failing when there are no references\n"
+              << "  --cases a,b          only these cases\n"
+              << "  --budget-scale x     multiply the CPU budget (slow CI machines)\n"
+              << "  --no-budget          skip the CPU budget check\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(argv[i]);
+
+    if (args.contains("--help") || args.contains("-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+    const auto referenceRoot = cwd.getChildFile(harness::getOption(args, "--references", GOLDEN_REFERENCE_DIR));
+    const auto referenceDir = referenceRoot.getChildFile(HARNESS_PLUGIN_NAME);
+    const auto budget = loadBudget(cwd.getChildFile(harness::getOption(args, "--budgets", GOLDEN_BUDGETS_FILE)));
+    const double budgetScale = harness::getOption(args, "--budget-scale", "1").getDoubleValue();
+    const bool update = args.contains("--update");
+    const bool allowMissing = args.contains("--allow-missing");
+    const auto caseFilter = juce::StringArray::fromTokens(harness::getOption(args, "--cases"), ",", {});
+
+    // A plugin without references checks nothing, so it fails unless the caller opted out
+    if (!update && !referenceDir.isDirectory())
+    {
+        std::cerr << HARNESS_PLUGIN_NAME << ": " << (allowMissing ? "" : "FAIL ") << "no references in "
+                  << referenceDir.getFullPathName() << " - run " << HARNESS_PLUGIN_NAME << "_Golden --update\n";
+        return allowMissing ? kSkipExitCode : 1;
+    }
+
+    const bool isInstrument = harness::createProcessor()->acceptsMidi();
+    const auto cases = makeCases(isInstrument);
+    bool failed = false;
+
+    for (const auto& goldenCase : cases)
+    {
+        if (!caseFilter.isEmpty() && !caseFilter.contains(goldenCase.name))
+            continue;
+
+        const auto file = referenceDir.getChildFile(goldenCase.name + ".wav");
+        const auto result = render(goldenCase);
+
+        if (update)
+        {
+            const bool written = writeWav(file, result.output);
+            std::cerr << HARNESS_PLUGIN_NAME << " " << goldenCase.name << ": "
+                      << (written ? "wrote " : "COULD NOT WRITE ") << file.getFullPathName() << "\n";
+            failed = failed || !written;
+            continue;
+        }
+
+        juce::AudioBuffer<float> reference;
+        if (!readWav(file, reference))
+        {
+            std::cerr << HARNESS_PLUGIN_NAME << " " << goldenCase.name << ": FAIL missing " << file.getFullPathName() << "\n";
+            failed = true;
+            continue;
+        }
+
+        if (reference.getNumChannels() != result.output.getNumChannels()
+            || reference.getNumSamples() != result.output.getNumSamples())
+        {
+            std::cerr << HARNESS_PLUGIN_NAME << " " << goldenCase.name << ": FAIL shape "
+                      << result.output.getNumChannels() << "x" << result.output.getNumSamples() << " vs reference "
+                      << reference.getNumChannels() << "x" << reference.getNumSamples() << "\n";
+            failed = true;
+            continue;
+        }
+
+        const auto difference = compare(result.output, reference);
+        const bool pass = difference.maxAbsError <= budget.maxAbsError;
+        failed = failed || !pass;
+
+        std::fprintf(stderr, "%s %s: max |err| %.3g (limit %.3g), err %.1f dB  %s\n",
+                     HARNESS_PLUGIN_NAME, goldenCase.name.toRawUTF8(), difference.maxAbsError,
+                     budget.maxAbsError, difference.errorDb, pass ? "PASS" : "FAIL");
+    }
+
+    //==========================================================================
+    // CPU budget + determinism: best of three 2 s renders of the first case
+    if (!args.contains("--no-budget"))
+    {
+        auto timingCase = cases.front();
+        timingCase.seconds = 2.0;
+
+        double bestNsPerSample = 0.0;
+        juce::AudioBuffer<float> firstOutput;
+        bool deterministic = true;
+
+        for (int run = 0; run < 3; ++run)
+        {
+            const auto result = render(timingCase);
+            const double nsPerSample = static_cast<double>(result.processNs) / result.output.getNumSamples();
+            bestNsPerSample = run == 0 ? nsPerSample : juce::jmin(bestNsPerSample, nsPerSample);
+
+            if (run == 0)
+                firstOutput.makeCopyOf(result.output);
+            else
+                deterministic = deterministic && isBitIdentical(firstOutput, result.output);
+        }
+
+        const double limit = budget.nsPerSample * budgetScale;
+        const bool withinBudget = bestNsPerSample <= limit;
+        failed = failed || !withinBudget || !deterministic;
+
+        std::fprintf(stderr, "%s cpu: %.1f ns/sample (budget %.1f)  %s\n", HARNESS_PLUGIN_NAME,
+                     bestNsPerSample, limit, withinBudget ? "PASS" : "FAIL");
+        if (!deterministic)
+            std::fprintf(stderr, "%s: FAIL repeated renders differ - an RNG is not seeded via pfs::nextRandomSeed()\n",
+                         HARNESS_PLUGIN_NAME);
+    }
+
+    return failed ? 1 : 0;
+}
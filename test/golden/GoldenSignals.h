@@ -0,0 +1,128 @@
+#pragma once
+
+#include "HarnessCommon.h"
+
+#include <cmath>
+
+//==============================================================================
+// Deterministic inputs for the golden renders. Everything is generated from a
+// fixed seed, so a reference WAV only changes when the plugin's output does.
+//==============================================================================
+namespace golden
+{
+
+inline void fillImpulse(juce::AudioBuffer<float>& input)
+{
+    input.clear();
+    for (int channel = 0; channel < input.getNumChannels(); ++channel)
+        input.setSample(channel, 0, 1.0f);
+}
+
+// Exponential sine sweep 20 Hz -> 20 kHz at -6 dBFS over sweepSeconds, then silence
+inline void fillSweep(juce::AudioBuffer<float>& input, double sampleRate, double sweepSeconds)
+{
+    input.clear();
+
+    const double f1 = 20.0;
+    const double f2 = juce::jmin(20000.0, sampleRate * 0.45);
+    const double rate = std::log(f2 / f1);
+    const int numSweepSamples = juce::jmin(input.getNumSamples(), static_cast<int>(sweepSeconds * sampleRate));
+
+    for (int sample = 0; sample < numSweepSamples; ++sample)
+    {
+        const double t = sample / sampleRate;
+        const double phase = juce::MathConstants<double>::twoPi * f1 * sweepSeconds / rate
+                           * (std::exp(t / sweepSeconds * rate) - 1.0);
+        const auto value = static_cast<float>(0.5 * std::sin(phase));
+
+        for (int channel = 0; channel < input.getNumChannels(); ++channel)
+            input.setSample(channel, sample, value);
+    }
+}
+
+// Same pink noise the benchmark uses (~ -12 dBFS)
+inline void fillPinkNoise(juce::AudioBuffer<float>& input, std::uint32_t seed)
+{
+    harness::SignalSource source(seed);
+    source.prepare(48000.0);
+    source.fillAudio(input, input.getNumChannels());
+}
+
+// 16th-note kick / hat / snare / hat loop at 120 BPM, synthesised (no sample files)
+inline void fillDrumLoop(juce::AudioBuffer<float>& input, double sampleRate, double loopSeconds, std::uint32_t seed)
+{
+    input.clear();
+
+    juce::Random random(static_cast<juce::int64>(seed));
+    const int stepSamples = static_cast<int>(sampleRate * 0.125);
+    const int numLoopSamples = juce::jmin(input.getNumSamples(), static_cast<int>(loopSeconds * sampleRate));
+    float previousNoise = 0.0f;
+
+    for (int sample = 0; sample < numLoopSamples; ++sample)
+    {
+        const int step = (sample / stepSamples) % 4;
+        const double t = (sample % stepSamples) / sampleRate;
+        const float noise = random.nextFloat() * 2.0f - 1.0f;
+        double value = 0.0;
+
+        if (step == 0)
+        {
+            // Kick: pitch-dropping sine
+            const double phase = juce::MathConstants<double>::twoPi * (50.0 * t + 100.0 * 0.03 * (1.0 - std::exp(-t / 0.03)));
+            value = 0.8 * std::sin(phase) * std::exp(-t / 0.25);
+        }
+        else if (step == 2)
+        {
+            // Snare: tone + noise
+            value = 0.3 * std::sin(juce::MathConstants<double>::twoPi * 180.0 * t) * std::exp(-t / 0.1)
+                  + 0.4 * noise * std::exp(-t / 0.08);
+        }
+        else
+        {
+            // Hat: differentiated (bright) noise
+            value = 0.25 * (noise - previousNoise) * std::exp(-t / 0.02);
+        }
+
+        previousNoise = noise;
+
+        for (int channel = 0; channel < input.getNumChannels(); ++channel)
+            input.setSample(channel, sample, static_cast<float>(value));
+    }
+}
+
+// The benchmark's note pattern (kick, snare, hats, toms, chord notes) over numSamples
+inline juce::MidiBuffer makeNotePattern(double sampleRate, int numSamples, std::uint32_t seed)
+{
+    harness::SignalSource source(seed);
+    source.prepare(sampleRate);
+
+    juce::MidiBuffer midi;
+    source.fillMidi(midi, numSamples);
+    return midi;
+}
+
+// Held triad, a soft high note over its release, then a fast low-velocity repeat
+inline juce::MidiBuffer makeChordSequence(double sampleRate)
+{
+    const auto at = [sampleRate](double seconds) { return static_cast<int>(seconds * sampleRate); };
+
+    juce::MidiBuffer midi;
+    for (int note : { 60, 64, 67 })
+    {
+        midi.addEvent(juce::MidiMessage::noteOn(1, note, static_cast<juce::uint8>(110)), at(0.0));
+        midi.addEvent(juce::MidiMessage::noteOff(1, note), at(0.4));
+    }
+
+    midi.addEvent(juce::MidiMessage::noteOn(1, 72, static_cast<juce::uint8>(40)), at(0.3));
+    midi.addEvent(juce::MidiMessage::noteOff(1, 72), at(0.6));
+
+    for (int hit = 0; hit < 4; ++hit)
+    {
+        midi.addEvent(juce::MidiMessage::noteOn(1, 36, static_cast<juce::uint8>(30 + hit * 25)), at(0.6 + hit * 0.05));
+        midi.addEvent(juce::MidiMessage::noteOff(1, 36), at(0.62 + hit * 0.05));
+    }
+
+    return midi;
+}
+
+} // namespace golden
@@ -0,0 +1,204 @@
+//==============================================================================
+// Headless per-stage profile dump
+//
+// Renders one plugin at a single sample rate / block size / preset and prints
+// the pfs::StageProfiler breakdown the editor CPU meter shows, then writes JSON:
+//
+//   { "plugin", "sampleRate", "blockSize", "preset", "blocks", "dropped",
+//     "deadlineNs", "meanBlockNs", "load", "peakLoad",
+//     "stages": [ { "name", "meanNs", "load" } ] }
+//
+// Loads are fractions of the buffer deadline. Only plugins that implement
+// pfs::StageProfilerSource have stages, and the build needs -DPFS_PROFILING=ON.
+//==============================================================================
+
+#include "HarnessCommon.h"
+
+#include <pfs/StageProfiler.h>
+
+#include <cstdio>
+#include <iostream>
+
+namespace
+{
+
+// Running totals across several drain() calls (the ring holds a few hundred frames)
+struct ProfileTotals
+{
+    int numBlocks = 0;
+    int numDropped = 0;
+    double blockNs = 0.0;
+    double deadlineNs = 0.0;
+    double peakBlockLoad = 0.0;
+    std::array<double, pfs::ProfileFrame::kMaxStages> stageNs {};
+
+    void add(const pfs::ProfileSummary& summary)
+    {
+        numBlocks += summary.numBlocks;
+        numDropped += summary.numDropped;
+        blockNs += summary.meanBlockNs * summary.numBlocks;
+        deadlineNs += summary.meanDeadlineNs * summary.numBlocks;
+        peakBlockLoad = juce::jmax(peakBlockLoad, summary.peakBlockLoad);
+
+        for (size_t stage = 0; stage < stageNs.size(); ++stage)
+            stageNs[stage] += summary.meanStageNs[stage] * summary.numBlocks;
+    }
+
+    double mean(double total) const { return numBlocks > 0 ? total / numBlocks : 0.0; }
+};
+
+void printUsage()
+{
+    std::cerr << "Usage: " << HARNESS_PLUGIN_NAME << "_Profile [options]\n"
+              << "  --rate     48000          sample rate (default 48000)\n"
+              << "  --block    64             block size (default 64)\n"
+              << "  --preset   default        default|minimum|maximum|random\n"
+              << "  --seconds  N              audio seconds profiled (default 5)\n"
+              << "  --output   file.json      write JSON to a file instead of stdout\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(argv[i]);
+
+    if (args.contains("--help") || args.contains("-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    const double sampleRate = harness::getOption(args, "--rate", "48000").getDoubleValue();
+    const int blockSize = harness::getOption(args, "--block", "64").getIntValue();
+    const double seconds = harness::getOption(args, "--seconds", "5").getDoubleValue();
+
+    harness::Preset preset;
+    if (!harness::parsePreset(harness::getOption(args, "--preset", "default"), preset) || blockSize <= 0 || sampleRate <= 0.0)
+    {
+        printUsage();
+        return 1;
+    }
+
+    auto processor = harness::createProcessor();
+    auto* source = dynamic_cast<pfs::StageProfilerSource*>(processor.get());
+
+    if (source == nullptr)
+    {
+        std::cerr << HARNESS_PLUGIN_NAME << " has no stage profiler (pfs::StageProfilerSource)\n";
+        return 1;
+    }
+
+    auto& profiler = source->getStageProfiler();
+
+    harness::applyPreset(*processor, preset);
+    harness::prepare(*processor, sampleRate, blockSize);
+
+    juce::AudioBuffer<float> buffer(harness::getNumBufferChannels(*processor), blockSize);
+    juce::MidiBuffer midi;
+    midi.ensureSize(256);
+
+    harness::SignalSource signal;
+    signal.prepare(sampleRate);
+
+    const bool wantsMidi = processor->acceptsMidi();
+    const int numInputs = processor->getTotalNumInputChannels();
+    const int numBlocks = juce::jmax(1, static_cast<int>(seconds * sampleRate / blockSize));
+    const int warmupBlocks = juce::jmax(1, static_cast<int>(0.25 * sampleRate / blockSize));
+    const int drainInterval = static_cast<int>(pfs::StageProfiler::kRingSize / 2);
+
+    ProfileTotals totals;
+
+    for (int block = -warmupBlocks; block < numBlocks; ++block)
+    {
+        signal.fillAudio(buffer, numInputs);
+        if (wantsMidi)
+            signal.fillMidi(midi, blockSize);
+        else
+            midi.clear();
+
+        processor->processBlock(buffer, midi);
+
+        // Warm-up frames are drained and discarded
+        if (block == -1)
+            profiler.drain();
+        else if (block >= 0 && (block + 1) % drainInterval == 0)
+            totals.add(profiler.drain());
+    }
+
+    totals.add(profiler.drain());
+    processor->releaseResources();
+
+    if (totals.numBlocks == 0)
+    {
+        std::cerr << "No profile frames recorded - configure with -DPFS_PROFILING=ON\n";
+        return 1;
+    }
+
+    const double deadlineNs = totals.mean(totals.deadlineNs);
+    const double blockNs = totals.mean(totals.blockNs);
+    const auto toLoad = [deadlineNs](double ns) { return deadlineNs > 0.0 ? ns / deadlineNs : 0.0; };
+
+    std::fprintf(stderr, "%s %.0f Hz / %d / %s: %d blocks, deadline %.1f us\n",
+                 HARNESS_PLUGIN_NAME, sampleRate, blockSize, harness::getPresetName(preset),
+                 totals.numBlocks, deadlineNs * 1.0e-3);
+
+    juce::Array<juce::var> stages;
+    double stagedNs = 0.0;
+
+    for (int stage = 0; stage < profiler.getNumStages(); ++stage)
+    {
+        const double stageNs = totals.mean(totals.stageNs[static_cast<size_t>(stage)]);
+        stagedNs += stageNs;
+
+        std::fprintf(stderr, "  %-14s %10.1f ns  %6.2f %%\n", profiler.getStageName(stage), stageNs, toLoad(stageNs) * 100.0);
+
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty("name", profiler.getStageName(stage));
+        entry->setProperty("meanNs", stageNs);
+        entry->setProperty("load", toLoad(stageNs));
+        stages.add(juce::var(entry));
+    }
+
+    const double otherNs = juce::jmax(0.0, blockNs - stagedNs);
+    std::fprintf(stderr, "  %-14s %10.1f ns  %6.2f %%\n", "(other)", otherNs, toLoad(otherNs) * 100.0);
+    std::fprintf(stderr, "  %-14s %10.1f ns  %6.2f %%  (peak %.2f %%, %d dropped)\n", "total",
+                 blockNs, toLoad(blockNs) * 100.0, totals.peakBlockLoad * 100.0, totals.numDropped);
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("plugin", HARNESS_PLUGIN_NAME);
+    root->setProperty("cpu", juce::SystemStats::getCpuModel());
+    root->setProperty("sampleRate", sampleRate);
+    root->setProperty("blockSize", blockSize);
+    root->setProperty("preset", harness::getPresetName(preset));
+    root->setProperty("blocks", totals.numBlocks);
+    root->setProperty("dropped", totals.numDropped);
+    root->setProperty("deadlineNs", deadlineNs);
+    root->setProperty("meanBlockNs", blockNs);
+    root->setProperty("load", toLoad(blockNs));
+    root->setProperty("peakLoad", totals.peakBlockLoad);
+    root->setProperty("otherNs", otherNs);
+    root->setProperty("stages", stages);
+
+    const auto json = juce::JSON::toString(juce::var(root));
+    const auto outputPath = harness::getOption(args, "--output");
+
+    if (outputPath.isNotEmpty())
+    {
+        if (!juce::File::getCurrentWorkingDirectory().getChildFile(outputPath).replaceWithText(json))
+        {
+            std::cerr << "Could not write " << outputPath << "\n";
+            return 1;
+        }
+    }
+    else
+    {
+        std::cout << json << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+//==============================================================================
+// Real-time safety checker
+//
+// Renders one plugin headlessly and arms the RT hooks (RTSafetyHooks.h) only
+// around processBlock(). Every heap allocation/free, mutex lock or file open
+// made from inside processBlock is reported once per unique call stack.
+//
+// The render deliberately stresses the paths hosts hit in practice:
+//   - block sizes that vary between 1 and the prepared maximum
+//   - parameter changes between blocks (coefficient rebuilds, smoother retargets)
+//   - MIDI note patterns for instruments
+//
+// Exit code: 0 = clean, 2 = violations found, 1 = usage error.
+//==============================================================================
+
+#include "HarnessCommon.h"
+#include "RTSafetyHooks.h"
+
+#include <cxxabi.h>
+#include <execinfo.h>
+
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace
+{
+
+// Frames belonging to record() and the hook itself
+constexpr int kHookFrames = 2;
+
+struct ViolationGroup
+{
+    rtcheck::ViolationKind kind;
+    juce::String detail;
+    juce::StringArray stack;
+    std::int64_t firstBlock = -1;
+    int count = 0;
+};
+
+juce::String demangleFrame(const char* symbolLine)
+{
+    juce::String line(symbolLine);
+    const int start = line.indexOf("_Z");
+    if (start < 0)
+        return line;
+
+    int end = start;
+    while (end < line.length() && !juce::String("+) ").containsChar(line[end]))
+        ++end;
+
+    const auto mangled = line.substring(start, end);
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(mangled.toRawUTF8(), nullptr, nullptr, &status);
+    if (status != 0 || demangled == nullptr)
+        return line;
+
+    const auto result = line.replaceSection(start, end - start, demangled);
+    std::free(demangled);
+    return result;
+}
+
+juce::StringArray symbolise(const rtcheck::Violation& violation)
+{
+    juce::StringArray stack;
+    const int first = juce::jmin(kHookFrames, violation.numFrames);
+    const int count = violation.numFrames - first;
+
+    if (count <= 0)
+        return stack;
+
+    char** symbols = backtrace_symbols(violation.frames + first, count);
+    for (int i = 0; i < count; ++i)
+        stack.add(symbols != nullptr ? demangleFrame(symbols[i]) : juce::String::toHexString((juce::pointer_sized_int) violation.frames[first + i]));
+    std::free(symbols);
+    return stack;
+}
+
+// Groups identical call stacks so a per-sample allocation is reported once
+std::vector<ViolationGroup> collectViolations()
+{
+    std::map<std::string, size_t> index;
+    std::vector<ViolationGroup> groups;
+
+    for (int i = 0; i < rtcheck::getNumViolations(); ++i)
+    {
+        const auto& violation = rtcheck::getViolation(i);
+
+        std::string key(rtcheck::getViolationKindName(violation.kind));
+        key.append(reinterpret_cast<const char*>(violation.frames + juce::jmin(kHookFrames, violation.numFrames)),
+                   sizeof(void*) * static_cast<size_t>(juce::jmax(0, violation.numFrames - kHookFrames)));
+        if (violation.kind == rtcheck::ViolationKind::FileOpen)
+            key.append(violation.detail);
+
+        auto found = index.find(key);
+        if (found == index.end())
+        {
+            ViolationGroup group { violation.kind, violation.detail, symbolise(violation), violation.blockIndex, 0 };
+            found = index.emplace(key, groups.size()).first;
+            groups.push_back(std::move(group));
+        }
+
+        ++groups[found->second].count;
+    }
+
+    return groups;
+}
+
+void printUsage()
+{
+    std::cerr << "Usage: " << HARNESS_PLUGIN_NAME << "_RTCheck [options]\n"
+              << "  --rates    48000,...        sample rates (default 44100,96000)\n"
+              << "  --blocks   512,...          maximum block sizes (default 64,512)\n"
+              << "  --seconds  N                audio seconds per case (default 2)\n"
+              << "  --json     file.json        also write the report as JSON\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    rtcheck::initialise();
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(argv[i]);
+
+    if (args.contains("--help") || args.contains("-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    const auto rates = harness::getListOption<double>(args, "--rates", { 44100.0, 96000.0 });
+    const auto blocks = harness::getListOption<int>(args, "--blocks", { 64, 512 });
+    const double seconds = harness::getOption(args, "--seconds", "2").getDoubleValue();
+
+    juce::Array<juce::var> jsonCases;
+    int totalGroups = 0;
+
+    for (auto sampleRate : rates)
+    {
+        for (auto maxBlockSize : blocks)
+        {
+            auto processor = harness::createProcessor();
+            harness::applyPreset(*processor, harness::Preset::Default);
+            harness::prepare(*processor, sampleRate, maxBlockSize);
+
+            juce::AudioBuffer<float> storage(harness::getNumBufferChannels(*processor), maxBlockSize);
+            juce::MidiBuffer midi;
+            midi.ensureSize(256);
+
+            harness::SignalSource source;
+            source.prepare(sampleRate);
+
+            juce::Random random(7);
+            auto& parameters = processor->getParameters();
+
+            // Hosts may deliver any size up to the prepared maximum
+            const int blockSizes[] = { maxBlockSize, maxBlockSize / 2, 1, juce::jmin(37, maxBlockSize), maxBlockSize - 1 };
+
+            rtcheck::clearViolations();
+
+            juce::int64 renderedSamples = 0;
+            const auto totalSamples = static_cast<juce::int64>(seconds * sampleRate);
+
+            for (std::int64_t blockIndex = 0; renderedSamples < totalSamples; ++blockIndex)
+            {
+                const int numSamples = juce::jmax(1, blockSizes[blockIndex % static_cast<std::int64_t>(std::size(blockSizes))]);
+
+                // Automation: nudge one parameter every 8 blocks (outside the armed window)
+                if (blockIndex % 8 == 7 && !parameters.isEmpty())
+                {
+                    auto* parameter = parameters[random.nextInt(parameters.size())];
+                    if (!harness::isBypassParameter(*parameter))
+                        parameter->setValueNotifyingHost(random.nextFloat());
+                }
+
+                juce::AudioBuffer<float> buffer(storage.getArrayOfWritePointers(), storage.getNumChannels(), numSamples);
+                source.fillAudio(buffer, processor->getTotalNumInputChannels());
+                if (processor->acceptsMidi())
+                    source.fillMidi(midi, numSamples);
+                else
+                    midi.clear();
+
+                rtcheck::arm(blockIndex);
+                processor->processBlock(buffer, midi);
+                rtcheck::disarm();
+
+                renderedSamples += numSamples;
+            }
+
+            const auto groups = collectViolations();
+            totalGroups += static_cast<int>(groups.size());
+
+            std::cout << "== " << HARNESS_PLUGIN_NAME << " @ " << sampleRate << " Hz, max block " << maxBlockSize
+                      << ": " << groups.size() << " unique violation(s)";
+            if (rtcheck::getNumDroppedViolations() > 0)
+                std::cout << " (" << rtcheck::getNumDroppedViolations() << " events not recorded, table full)";
+            std::cout << "\n";
+
+            juce::Array<juce::var> jsonGroups;
+
+            for (const auto& group : groups)
+            {
+                std::cout << "\n[" << rtcheck::getViolationKindName(group.kind) << "] " << group.detail
+                          << " x" << group.count << " (first in block " << group.firstBlock << ")\n";
+                for (const auto& frame : group.stack)
+                    std::cout << "    " << frame << "\n";
+
+                auto* entry = new juce::DynamicObject();
+                entry->setProperty("kind", rtcheck::getViolationKindName(group.kind));
+                entry->setProperty("detail", group.detail);
+                entry->setProperty("count", group.count);
+                entry->setProperty("firstBlock", static_cast<juce::int64>(group.firstBlock));
+
+                juce::Array<juce::var> frames;
+                for (const auto& frame : group.stack)
+                    frames.add(frame);
+                entry->setProperty("stack", frames);
+                jsonGroups.add(juce::var(entry));
+            }
+
+            auto* jsonCase = new juce::DynamicObject();
+            jsonCase->setProperty("sampleRate", sampleRate);
+            jsonCase->setProperty("maxBlockSize", maxBlockSize);
+            jsonCase->setProperty("violations", jsonGroups);
+            jsonCases.add(juce::var(jsonCase));
+
+            processor->releaseResources();
+        }
+    }
+
+    const auto jsonPath = harness::getOption(args, "--json");
+    if (jsonPath.isNotEmpty())
+    {
+        auto* root = new juce::DynamicObject();
+        root->setProperty("plugin", HARNESS_PLUGIN_NAME);
+        root->setProperty("cases", jsonCases);
+        juce::File::getCurrentWorkingDirectory().getChildFile(jsonPath).replaceWithText(juce::JSON::toString(juce::var(root)));
+    }
+
+    std::cout << "\n" << HARNESS_PLUGIN_NAME << ": " << (totalGroups == 0 ? "RT-safe" : "NOT RT-safe") << "\n";
+    return totalGroups == 0 ? 0 : 2;
+}
@@ -0,0 +1,408 @@
+#include "RTSafetyHooks.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdarg>
+#include <cstddef>
+#include <cstring>
+
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__APPLE__)
+ #include <mach/mach.h>
+ #include <malloc/malloc.h>
+#endif
+
+namespace rtcheck
+{
+
+//==============================================================================
+// Violation table (fixed size, written only by the armed thread)
+//==============================================================================
+namespace
+{
+constexpr int kMaxViolations = 1024;
+
+Violation violations[kMaxViolations];
+std::atomic<int> numViolations { 0 };
+std::atomic<int> numDropped { 0 };
+
+// Trivially-initialised TLS: safe to touch from inside malloc
+thread_local bool threadArmed = false;
+thread_local bool insideHook = false;
+thread_local std::int64_t threadBlockIndex = -1;
+
+void copyDetail(char* dest, const char* source)
+{
+    if (source == nullptr)
+        return;
+
+    std::size_t i = 0;
+    for (; i + 1 < static_cast<std::size_t>(Violation::kMaxDetail) && source[i] != '\0'; ++i)
+        dest[i] = source[i];
+    dest[i] = '\0';
+}
+
+void record(ViolationKind kind, const char* detail)
+{
+    if (!threadArmed || insideHook)
+        return;
+
+    insideHook = true;  // backtrace() and friends must not re-enter
+
+    const int index = numViolations.load(std::memory_order_relaxed);
+    if (index < kMaxViolations)
+    {
+        auto& violation = violations[index];
+        violation.kind = kind;
+        violation.blockIndex = threadBlockIndex;
+        violation.detail[0] = '\0';
+        copyDetail(violation.detail, detail);
+        violation.numFrames = backtrace(violation.frames, Violation::kMaxFrames);
+        numViolations.store(index + 1, std::memory_order_release);
+    }
+    else
+    {
+        numDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    insideHook = false;
+}
+} // namespace
+
+const char* getViolationKindName(ViolationKind kind)
+{
+    switch (kind)
+    {
+        case ViolationKind::Allocation:   return "allocation";
+        case ViolationKind::Deallocation: return "deallocation";
+        case ViolationKind::Lock:         return "lock";
+        case ViolationKind::FileOpen:     return "file-open";
+    }
+    return "unknown";
+}
+
+void arm(std::int64_t blockIndex)
+{
+    threadBlockIndex = blockIndex;
+    threadArmed = true;
+}
+
+void disarm()
+{
+    threadArmed = false;
+}
+
+int getNumViolations()                     { return numViolations.load(std::memory_order_acquire); }
+const Violation& getViolation(int index)   { return violations[index]; }
+int getNumDroppedViolations()              { return numDropped.load(std::memory_order_relaxed); }
+
+void clearViolations()
+{
+    numViolations.store(0, std::memory_order_release);
+    numDropped.store(0, std::memory_order_relaxed);
+}
+
+#if defined(__APPLE__)
+//==============================================================================
+// macOS: swap the function pointers of the primary malloc zone
+//==============================================================================
+namespace
+{
+malloc_zone_t* hookedZone = nullptr;
+malloc_zone_t originalZone;
+
+void* zoneMalloc(malloc_zone_t* zone, size_t size)
+{
+    record(ViolationKind::Allocation, "malloc");
+    return originalZone.malloc(zone, size);
+}
+
+void* zoneCalloc(malloc_zone_t* zone, size_t count, size_t size)
+{
+    record(ViolationKind::Allocation, "calloc");
+    return originalZone.calloc(zone, count, size);
+}
+
+void* zoneRealloc(malloc_zone_t* zone, void* ptr, size_t size)
+{
+    record(ViolationKind::Allocation, "realloc");
+    return originalZone.realloc(zone, ptr, size);
+}
+
+void* zoneMemalign(malloc_zone_t* zone, size_t alignment, size_t size)
+{
+    record(ViolationKind::Allocation, "memalign");
+    return originalZone.memalign(zone, alignment, size);
+}
+
+void zoneFree(malloc_zone_t* zone, void* ptr)
+{
+    if (ptr != nullptr)
+        record(ViolationKind::Deallocation, "free");
+    originalZone.free(zone, ptr);
+}
+
+void zoneFreeDefiniteSize(malloc_zone_t* zone, void* ptr, size_t size)
+{
+    if (ptr != nullptr)
+        record(ViolationKind::Deallocation, "free");
+    originalZone.free_definite_size(zone, ptr, size);
+}
+
+void installZoneHooks()
+{
+    vm_address_t* zones = nullptr;
+    unsigned int count = 0;
+
+    if (malloc_get_all_zones(mach_task_self(), nullptr, &zones, &count) != KERN_SUCCESS || count == 0)
+        return;
+
+    hookedZone = reinterpret_cast<malloc_zone_t*>(zones[0]);
+    originalZone = *hookedZone;
+
+    vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(hookedZone), sizeof(malloc_zone_t), 0,
+               VM_PROT_READ | VM_PROT_WRITE);
+
+    hookedZone->malloc = zoneMalloc;
+    hookedZone->calloc = zoneCalloc;
+    hookedZone->realloc = zoneRealloc;
+    hookedZone->free = zoneFree;
+    if (originalZone.version >= 5 && originalZone.memalign != nullptr)
+        hookedZone->memalign = zoneMemalign;
+    if (originalZone.version >= 6 && originalZone.free_definite_size != nullptr)
+        hookedZone->free_definite_size = zoneFreeDefiniteSize;
+
+    vm_protect(mach_task_self(), reinterpret_cast<vm_address_t>(hookedZone), sizeof(malloc_zone_t), 0,
+               VM_PROT_READ);
+}
+
+int hookedMutexLock(pthread_mutex_t* mutex)
+{
+    record(ViolationKind::Lock, "pthread_mutex_lock");
+    return pthread_mutex_lock(mutex);
+}
+
+int hookedCondWait(pthread_cond_t* cond, pthread_mutex_t* mutex)
+{
+    record(ViolationKind::Lock, "pthread_cond_wait");
+    return pthread_cond_wait(cond, mutex);
+}
+
+int hookedOpen(const char* path, int flags, ...)
+{
+    record(ViolationKind::FileOpen, path);
+
+    mode_t mode = 0;
+    if ((flags & O_CREAT) != 0)
+    {
+        va_list args;
+        va_start(args, flags);
+        mode = static_cast<mode_t>(va_arg(args, int));
+        va_end(args);
+    }
+    return open(path, flags, mode);
+}
+
+FILE* hookedFopen(const char* path, const char* mode)
+{
+    record(ViolationKind::FileOpen, path);
+    return fopen(path, mode);
+}
+
+// dyld does not apply an image's interpose tuples to calls made from that image,
+// so the replacements above can call the originals directly.
+#define RTCHECK_INTERPOSE(replacement, original) \
+    __attribute__((used)) static const struct { const void* r; const void* o; } interpose_##original \
+        __attribute__((section("__DATA,__interpose"))) = { (const void*) (unsigned long) &replacement, \
+                                                           (const void*) (unsigned long) &original };
+
+RTCHECK_INTERPOSE(hookedMutexLock, pthread_mutex_lock)
+RTCHECK_INTERPOSE(hookedCondWait, pthread_cond_wait)
+RTCHECK_INTERPOSE(hookedOpen, open)
+RTCHECK_INTERPOSE(hookedFopen, fopen)
+} // namespace
+
+void initialise()
+{
+    void* frames[4];
+    backtrace(frames, 4);  // First call loads the unwinder (allocates)
+
+    if (hookedZone == nullptr)
+        installZoneHooks();
+}
+
+#else
+//==============================================================================
+// Linux/glibc: resolve the next definitions once, before anything is armed
+//==============================================================================
+namespace
+{
+using MutexLockFn = int (*)(pthread_mutex_t*);
+using CondWaitFn = int (*)(pthread_cond_t*, pthread_mutex_t*);
+using OpenFn = int (*)(const char*, int, ...);
+using FopenFn = FILE* (*)(const char*, const char*);
+
+MutexLockFn nextMutexLock = nullptr;
+CondWaitFn nextCondWait = nullptr;
+OpenFn nextOpen = nullptr;
+OpenFn nextOpen64 = nullptr;
+FopenFn nextFopen = nullptr;
+FopenFn nextFopen64 = nullptr;
+
+template <typename Fn>
+void resolveNext(Fn& fn, const char* name)
+{
+    if (fn == nullptr)
+        fn = reinterpret_cast<Fn>(dlsym(RTLD_NEXT, name));
+}
+
+void resolveAll()
+{
+    resolveNext(nextMutexLock, "pthread_mutex_lock");
+    resolveNext(nextCondWait, "pthread_cond_wait");
+    resolveNext(nextOpen, "open");
+    resolveNext(nextOpen64, "open64");
+    resolveNext(nextFopen, "fopen");
+    resolveNext(nextFopen64, "fopen64");
+}
+
+__attribute__((constructor(101))) void resolveAtLoad()
+{
+    resolveAll();
+}
+
+mode_t readMode(int flags, va_list args)
+{
+    return (flags & O_CREAT) != 0 ? static_cast<mode_t>(va_arg(args, int)) : 0;
+}
+} // namespace
+
+void initialise()
+{
+    resolveAll();
+
+    void* frames[4];
+    backtrace(frames, 4);  // First call dlopens libgcc_s (allocates)
+}
+
+#endif
+
+} // namespace rtcheck
+
+#if !defined(__APPLE__)
+//==============================================================================
+// glibc entry points. Exception specifications must match the libc headers.
+//==============================================================================
+extern "C"
+{
+void* __libc_malloc(size_t);
+void* __libc_calloc(size_t, size_t);
+void* __libc_realloc(void*, size_t);
+void* __libc_memalign(size_t, size_t);
+void __libc_free(void*);
+
+void* malloc(size_t size) noexcept
+{
+    rtcheck::record(rtcheck::ViolationKind::Allocation, "malloc");
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t count, size_t size) noexcept
+{
+    rtcheck::record(rtcheck::ViolationKind::Allocation, "calloc");
+    return __libc_calloc(count, size);
+}
+
+void* realloc(void* ptr, size_t size) noexcept
+{
+    rtcheck::record(rtcheck::ViolationKind::Allocation, "realloc");
+    return __libc_realloc(ptr, size);
+}
+
+void* memalign(size_t alignment, size_t size) noexcept
+{
+    rtcheck::record(rtcheck::ViolationKind::Allocation, "memalign");
+    return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept
+{
+    rtcheck::record(rtcheck::ViolationKind::Allocation, "aligned_alloc");
+    return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** result, size_t alignment, size_t size) noexcept
+{
+    rtcheck::record(rtcheck::ViolationKind::Allocation, "posix_memalign");
+    *result = __libc_memalign(alignment, size);
+    return *result != nullptr || size == 0 ? 0 : ENOMEM;
+}
+
+void free(void* ptr) noexcept
+{
+    if (ptr != nullptr)
+        rtcheck::record(rtcheck::ViolationKind::Deallocation, "free");
+    __libc_free(ptr);
+}
+
+int pthread_mutex_lock(pthread_mutex_t* mutex) noexcept
+{
+    rtcheck::record(rtcheck::ViolationKind::Lock, "pthread_mutex_lock");
+    rtcheck::resolveNext(rtcheck::nextMutexLock, "pthread_mutex_lock");
+    return rtcheck::nextMutexLock(mutex);
+}
+
+int pthread_cond_wait(pthread_cond_t* cond, pthread_mutex_t* mutex)
+{
+    rtcheck::record(rtcheck::ViolationKind::Lock, "pthread_cond_wait");
+    rtcheck::resolveNext(rtcheck::nextCondWait, "pthread_cond_wait");
+    return rtcheck::nextCondWait(cond, mutex);
+}
+
+int open(const char* path, int flags, ...)
+{
+    rtcheck::record(rtcheck::ViolationKind::FileOpen, path);
+
+    va_list args;
+    va_start(args, flags);
+    const mode_t mode = rtcheck::readMode(flags, args);
+    va_end(args);
+
+    rtcheck::resolveNext(rtcheck::nextOpen, "open");
+    return rtcheck::nextOpen(path, flags, mode);
+}
+
+int open64(const char* path, int flags, ...)
+{
+    rtcheck::record(rtcheck::ViolationKind::FileOpen, path);
+
+    va_list args;
+    va_start(args, flags);
+    const mode_t mode = rtcheck::readMode(flags, args);
+    va_end(args);
+
+    rtcheck::resolveNext(rtcheck::nextOpen64, "open64");
+    return rtcheck::nextOpen64(path, flags, mode);
+}
+
+FILE* fopen(const char* path, const char* mode)
+{
+    rtcheck::record(rtcheck::ViolationKind::FileOpen, path);
+    rtcheck::resolveNext(rtcheck::nextFopen, "fopen");
+    return rtcheck::nextFopen(path, mode);
+}
+
+FILE* fopen64(const char* path, const char* mode)
+{
+    rtcheck::record(rtcheck::ViolationKind::FileOpen, path);
+    rtcheck::resolveNext(rtcheck::nextFopen64, "fopen64");
+    return rtcheck::nextFopen64(path, mode);
+}
+} // extern "C"
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+
+//==============================================================================
+// Real-time safety hooks
+//
+// Interposes the heap (malloc family), mutex locking and file opening for the
+// whole process. Hooks only record while the CALLING thread is armed, so the
+// harness arms around processBlock() and everything else runs untouched.
+//
+// Recording is allocation-free: violations go into a fixed table with their raw
+// return addresses; symbolisation happens later, after disarm().
+//
+// Coverage:
+//   Linux/glibc - malloc/calloc/realloc/free/memalign family, pthread_mutex_lock,
+//                 pthread_cond_wait, open/open64/fopen/fopen64
+//   macOS       - default malloc zone (malloc/calloc/realloc/free/memalign),
+//                 pthread_mutex_lock, pthread_cond_wait, open, fopen via __interpose
+//==============================================================================
+namespace rtcheck
+{
+
+enum class ViolationKind
+{
+    Allocation,
+    Deallocation,
+    Lock,
+    FileOpen
+};
+
+const char* getViolationKindName(ViolationKind kind);
+
+struct Violation
+{
+    static constexpr int kMaxFrames = 48;
+    static constexpr int kMaxDetail = 128;
+
+    ViolationKind kind = ViolationKind::Allocation;
+    std::int64_t blockIndex = -1;
+    int numFrames = 0;
+    void* frames[kMaxFrames] = {};
+    char detail[kMaxDetail] = {};  // File path for FileOpen, symbol name otherwise
+};
+
+// Call once at startup before arming (primes the unwinder, which allocates on first use)
+void initialise();
+
+// Arm/disarm the calling thread. blockIndex is stored with every violation.
+void arm(std::int64_t blockIndex);
+void disarm();
+
+int getNumViolations();
+const Violation& getViolation(int index);
+int getNumDroppedViolations();
+void clearViolations();
+
+} // namespace rtcheck
@@ -0,0 +1,484 @@
+//==============================================================================
+// pfs_render - offline batch renderer
+//
+// Streams WAV/AIFF files through a chain of this repo's plugins (hosted as the
+// VST3 bundles the build produces), faster than realtime and without a DAW:
+//
+//   pfs_render --chain TapeAge,NBS_DynaDrive,Chaosverb --output out/ stems/
+//
+// Every worker thread owns one chain and pulls files from a shared queue.
+// Stages process the same buffer in place. Plugins are told they run
+// non-realtime (isNonRealtime() == true) and are re-prepared for every file.
+// Throughput is printed per file and can also be written as JSON (--report).
+//==============================================================================
+
+#include "RenderChain.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+
+//==============================================================================
+struct Options
+{
+    std::vector<render::StageSpec> chain;
+    juce::File pluginRoot;
+    juce::File outputDir;
+    juce::File reportFile;
+    juce::File saveStatesDir;
+    juce::String format;        // empty = same as the input file
+    int numJobs = 1;
+    int blockSize = 1024;
+    int bitDepth = 24;
+    double tailSeconds = -1.0;  // < 0 = the chain's reported tail, capped at kMaxAutoTailSeconds
+};
+
+struct FileResult
+{
+    juce::File input;
+    juce::File output;
+    double audioSeconds = 0.0;
+    double renderedSeconds = 0.0;
+    double processSeconds = 0.0;
+    double wallSeconds = 0.0;
+    juce::String error;
+
+    double getRealtimeFactor() const { return processSeconds > 0.0 ? renderedSeconds / processSeconds : 0.0; }
+};
+
+constexpr double kMaxAutoTailSeconds = 30.0;
+
+double nowSeconds()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+juce::String getOption(const juce::StringArray& args, const juce::String& name, const juce::String& fallback = {})
+{
+    const int index = args.indexOf(name);
+    if (index >= 0 && index + 1 < args.size())
+        return args[index + 1];
+    return fallback;
+}
+
+void printUsage()
+{
+    std::cerr << "Usage: pfs_render (--chain A,B,.. | --config chain.json) --output dir [options] inputs...\n"
+              << "  inputs               audio files or directories (searched for .wav/.aif/.aiff)\n"
+              << "  --chain A,B,C        plugin names (found under --plugin-dir) or .vst3 paths\n"
+              << "  --config chain.json  [ { \"plugin\": \"Chaosverb\", \"state\": \"hall.vstpreset\",\n"
+              << "                           \"parameters\": { \"decay\": 0.7, \"mix\": \"35 %\" } }, ... ]\n"
+              << "                       numbers are normalised 0..1, strings are display text\n"
+              << "  --output dir         where rendered files go (same file names)\n"
+              << "  --jobs N             worker threads, one chain each (default: CPU count)\n"
+              << "  --block N            block size (default 1024)\n"
+              << "  --tail seconds       silence rendered after each file (default: the chain's tail, max 30)\n"
+              << "  --format wav|aiff    output format (default: same as input)\n"
+              << "  --bits 16|24|32      output bit depth (default 24, 32 = float)\n"
+              << "  --plugin-dir dir     where to look for <Name>.vst3 (default: this build's plugins)\n"
+              << "  --save-states dir    write each stage's state blob (reuse with \"state\")\n"
+              << "  --report file.json   per-file throughput report\n";
+}
+
+//==============================================================================
+bool parseChain(const juce::StringArray& args, Options& options, juce::String& error)
+{
+    const auto configPath = getOption(args, "--config");
+
+    if (configPath.isNotEmpty())
+    {
+        const auto configFile = juce::File::getCurrentWorkingDirectory().getChildFile(configPath);
+        const auto json = juce::JSON::parse(configFile);
+
+        if (!json.isArray())
+        {
+            error = "could not parse " + configPath + " (expected a JSON array of stages)";
+            return false;
+        }
+
+        for (const auto& stage : *json.getArray())
+        {
+            render::StageSpec spec;
+            spec.plugin = stage["plugin"].toString();
+
+            if (stage.hasProperty("state"))
+                spec.stateFile = configFile.getParentDirectory().getChildFile(stage["state"].toString());
+
+            if (auto* parameters = stage["parameters"].getDynamicObject())
+                spec.parameters = parameters->getProperties();
+
+            options.chain.push_back(std::move(spec));
+        }
+    }
+    else
+    {
+        for (const auto& name : juce::StringArray::fromTokens(getOption(args, "--chain"), ",", {}))
+        {
+            render::StageSpec spec;
+            spec.plugin = name.trim();
+            options.chain.push_back(std::move(spec));
+        }
+    }
+
+    for (const auto& spec : options.chain)
+    {
+        if (spec.plugin.isEmpty())
+        {
+            error = "every stage needs a plugin";
+            return false;
+        }
+    }
+
+    if (options.chain.empty())
+        error = "no plugins given (--chain or --config)";
+
+    return error.isEmpty();
+}
+
+juce::Array<juce::File> collectInputs(const juce::StringArray& paths, juce::AudioFormatManager& audioFormats)
+{
+    juce::Array<juce::File> files;
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+
+    for (const auto& path : paths)
+    {
+        const auto file = cwd.getChildFile(path);
+
+        if (file.isDirectory())
+        {
+            auto found = file.findChildFiles(juce::File::findFiles, true, audioFormats.getWildcardForAllFormats());
+            found.sort();
+            files.addArray(found);
+        }
+        else if (file.existsAsFile())
+        {
+            files.add(file);
+        }
+        else
+        {
+            std::cerr << "Skipping " << path << " (not found)\n";
+        }
+    }
+
+    return files;
+}
+
+//==============================================================================
+// Name -> <plugin-dir>/**/<Name>.vst3 (or .component), or a path used as-is
+bool resolvePlugins(const Options& options, juce::AudioPluginFormatManager& pluginFormats,
+                    juce::Array<juce::PluginDescription>& descriptions, juce::String& error)
+{
+    for (const auto& spec : options.chain)
+    {
+        auto location = juce::File::getCurrentWorkingDirectory().getChildFile(spec.plugin);
+
+        if (!location.exists())
+        {
+            juce::Array<juce::File> found;
+            for (const auto& extension : { ".vst3", ".component" })
+                found.addArray(options.pluginRoot.findChildFiles(juce::File::findFilesAndDirectories, true,
+                                                                 spec.plugin + extension));
+
+            if (found.isEmpty())
+            {
+                error = "could not find " + spec.plugin + ".vst3 under " + options.pluginRoot.getFullPathName();
+                return false;
+            }
+
+            location = found.getFirst();
+        }
+
+        juce::OwnedArray<juce::PluginDescription> types;
+        for (auto* format : pluginFormats.getFormats())
+            if (format->fileMightContainThisPluginType(location.getFullPathName()))
+                format->findAllTypesForFile(types, location.getFullPathName());
+
+        if (types.isEmpty())
+        {
+            error = "no plugin in " + location.getFullPathName();
+            return false;
+        }
+
+        descriptions.add(*types.getFirst());
+    }
+
+    return true;
+}
+
+//==============================================================================
+FileResult renderFile(render::RenderChain& chain, juce::AudioFormatManager& audioFormats,
+                      const juce::File& input, const Options& options)
+{
+    FileResult result;
+    result.input = input;
+
+    const double wallStart = nowSeconds();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(audioFormats.createReaderFor(input));
+    if (reader == nullptr || reader->sampleRate <= 0.0)
+    {
+        result.error = "unreadable";
+        return result;
+    }
+
+    const double sampleRate = reader->sampleRate;
+    chain.prepare(sampleRate);
+
+    const double tailSeconds = options.tailSeconds >= 0.0 ? options.tailSeconds
+                                                          : juce::jmin(kMaxAutoTailSeconds, chain.getTailLengthSeconds());
+    const auto latency = static_cast<juce::int64>(chain.getLatencySamples());
+    const auto outputLength = reader->lengthInSamples + static_cast<juce::int64>(tailSeconds * sampleRate);
+    const auto renderLength = outputLength + latency;
+
+    const auto extension = options.format.isNotEmpty() ? "." + options.format : input.getFileExtension();
+    result.output = options.outputDir.getChildFile(input.getFileNameWithoutExtension() + extension);
+
+    auto* writerFormat = audioFormats.findFormatForFileExtension(extension);
+    if (writerFormat == nullptr)
+    {
+        result.error = "no writer for " + extension;
+        return result;
+    }
+
+    result.output.deleteFile();
+    auto stream = result.output.createOutputStream();
+    std::unique_ptr<juce::AudioFormatWriter> writer;
+
+    if (stream != nullptr)
+        writer.reset(writerFormat->createWriterFor(stream.get(), sampleRate,
+                                                   static_cast<unsigned int>(chain.getNumOutputChannels()),
+                                                   options.bitDepth, {}, 0));
+    if (writer == nullptr)
+    {
+        result.error = "could not write " + result.output.getFullPathName();
+        return result;
+    }
+
+    stream.release(); // owned by the writer now
+
+    double processSeconds = 0.0;
+
+    for (juce::int64 position = 0; position < renderLength; position += options.blockSize)
+    {
+        const auto numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(options.blockSize), renderLength - position));
+        auto block = chain.getBlock(numSamples);
+
+        // Reads past the end of the file return silence (the tail); mono files fill both channels
+        block.clear();
+        reader->read(&block, 0, numSamples, position, true, true);
+
+        const double processStart = nowSeconds();
+        chain.process(block);
+        processSeconds += nowSeconds() - processStart;
+
+        // Drop the chain's latency from the start so output lines up with the input
+        const auto skip = static_cast<int>(juce::jlimit(static_cast<juce::int64>(0), static_cast<juce::int64>(numSamples), latency - position));
+        if (!writer->writeFromAudioSampleBuffer(block, skip, numSamples - skip))
+        {
+            result.error = "write failed";
+            break;
+        }
+    }
+
+    writer.reset();
+    chain.release();
+
+    result.audioSeconds = static_cast<double>(reader->lengthInSamples) / sampleRate;
+    result.renderedSeconds = static_cast<double>(outputLength) / sampleRate;
+    result.processSeconds = processSeconds;
+    result.wallSeconds = nowSeconds() - wallStart;
+    return result;
+}
+
+juce::var toJson(const FileResult& result)
+{
+    auto* entry = new juce::DynamicObject();
+    entry->setProperty("input", result.input.getFullPathName());
+    entry->setProperty("output", result.output.getFullPathName());
+    entry->setProperty("audioSeconds", result.audioSeconds);
+    entry->setProperty("renderedSeconds", result.renderedSeconds);
+    entry->setProperty("processSeconds", result.processSeconds);
+    entry->setProperty("wallSeconds", result.wallSeconds);
+    entry->setProperty("realtimeFactor", result.getRealtimeFactor());
+    if (result.error.isNotEmpty())
+        entry->setProperty("error", result.error);
+    return juce::var(entry);
+}
+
+} // namespace
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    juce::StringArray args;
+    for (int i = 1; i < argc; ++i)
+        args.add(argv[i]);
+
+    if (args.isEmpty() || args.contains("--help") || args.contains("-h"))
+    {
+        printUsage();
+        return args.isEmpty() ? 1 : 0;
+    }
+
+    // Everything that is not an option (or an option's value) is an input path
+    static const juce::StringArray valueOptions { "--chain", "--config", "--output", "--jobs", "--block", "--tail",
+                                                  "--format", "--bits", "--plugin-dir", "--save-states", "--report" };
+    juce::StringArray inputPaths;
+    for (int i = 0; i < args.size(); ++i)
+    {
+        if (valueOptions.contains(args[i]))
+            ++i;
+        else if (!args[i].startsWith("--"))
+            inputPaths.add(args[i]);
+    }
+
+    const auto cwd = juce::File::getCurrentWorkingDirectory();
+
+    Options options;
+    options.pluginRoot = cwd.getChildFile(getOption(args, "--plugin-dir", PFS_RENDER_PLUGIN_ROOT));
+    options.outputDir = cwd.getChildFile(getOption(args, "--output"));
+    options.format = getOption(args, "--format").trimCharactersAtStart(".").toLowerCase();
+    options.numJobs = getOption(args, "--jobs", juce::String(juce::SystemStats::getNumCpus())).getIntValue();
+    options.blockSize = getOption(args, "--block", "1024").getIntValue();
+    options.bitDepth = getOption(args, "--bits", "24").getIntValue();
+    options.tailSeconds = getOption(args, "--tail", "-1").getDoubleValue();
+
+    if (getOption(args, "--report").isNotEmpty())
+        options.reportFile = cwd.getChildFile(getOption(args, "--report"));
+    if (getOption(args, "--save-states").isNotEmpty())
+        options.saveStatesDir = cwd.getChildFile(getOption(args, "--save-states"));
+
+    juce::String error;
+    if (getOption(args, "--output").isEmpty() || options.numJobs <= 0 || options.blockSize <= 0
+        || !parseChain(args, options, error))
+    {
+        if (error.isNotEmpty())
+            std::cerr << error << "\n";
+        printUsage();
+        return 1;
+    }
+
+    juce::AudioFormatManager audioFormats;
+    audioFormats.registerBasicFormats();
+
+    juce::AudioPluginFormatManager pluginFormats;
+    pluginFormats.addDefaultFormats();
+
+    juce::Array<juce::PluginDescription> descriptions;
+    if (!resolvePlugins(options, pluginFormats, descriptions, error))
+    {
+        std::cerr << error << "\n";
+        return 1;
+    }
+
+    const auto inputs = collectInputs(inputPaths, audioFormats);
+    if (inputs.isEmpty() && options.saveStatesDir == juce::File())
+    {
+        std::cerr << "No input files\n";
+        return 1;
+    }
+
+    if (!options.outputDir.createDirectory())
+    {
+        std::cerr << "Could not create " << options.outputDir.getFullPathName() << "\n";
+        return 1;
+    }
+
+    //==========================================================================
+    // Instances are created on this (message) thread; workers only prepare and process them
+    const int numChains = juce::jmax(1, juce::jmin(options.numJobs, inputs.size()));
+    std::vector<std::unique_ptr<render::RenderChain>> chains;
+
+    for (int i = 0; i < numChains; ++i)
+    {
+        auto chain = std::make_unique<render::RenderChain>();
+        error = chain->create(pluginFormats, descriptions, options.chain, 48000.0, options.blockSize);
+        if (error.isNotEmpty())
+        {
+            std::cerr << error << "\n";
+            return 1;
+        }
+        chains.push_back(std::move(chain));
+    }
+
+    if (options.saveStatesDir != juce::File() && !chains.front()->saveStates(options.saveStatesDir))
+        std::cerr << "Could not write every state to " << options.saveStatesDir.getFullPathName() << "\n";
+
+    std::vector<FileResult> results(static_cast<size_t>(inputs.size()));
+    std::atomic<int> nextFile { 0 };
+    std::mutex printLock;
+
+    const double batchStart = nowSeconds();
+    std::vector<std::thread> workers;
+
+    for (auto& chain : chains)
+    {
+        workers.emplace_back([&, chainPtr = chain.get()]
+        {
+            for (int index = nextFile++; index < inputs.size(); index = nextFile++)
+            {
+                auto result = renderFile(*chainPtr, audioFormats, inputs.getReference(index), options);
+
+                {
+                    const std::lock_guard<std::mutex> lock(printLock);
+                    if (result.error.isNotEmpty())
+                        std::fprintf(stderr, "%s: FAILED (%s)\n", result.input.getFileName().toRawUTF8(), result.error.toRawUTF8());
+                    else
+                        std::fprintf(stderr, "%s: %.1f s audio in %.2f s (%.1fx realtime)\n",
+                                     result.input.getFileName().toRawUTF8(), result.renderedSeconds,
+                                     result.wallSeconds, result.getRealtimeFactor());
+                }
+
+                results[static_cast<size_t>(index)] = std::move(result);
+            }
+        });
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    //==========================================================================
+    const double batchSeconds = nowSeconds() - batchStart;
+    double totalAudioSeconds = 0.0;
+    int numFailed = 0;
+    juce::Array<juce::var> files;
+
+    for (const auto& result : results)
+    {
+        totalAudioSeconds += result.renderedSeconds;
+        numFailed += result.error.isNotEmpty() ? 1 : 0;
+        files.add(toJson(result));
+    }
+
+    std::fprintf(stderr, "%d files, %.1f s audio in %.2f s on %d threads (%.1fx realtime), %d failed\n",
+                 inputs.size(), totalAudioSeconds, batchSeconds, numChains,
+                 batchSeconds > 0.0 ? totalAudioSeconds / batchSeconds : 0.0, numFailed);
+
+    if (options.reportFile != juce::File())
+    {
+        juce::StringArray chainNames;
+        for (const auto& spec : options.chain)
+            chainNames.add(spec.plugin);
+
+        auto* root = new juce::DynamicObject();
+        root->setProperty("chain", chainNames.joinIntoString(","));
+        root->setProperty("jobs", numChains);
+        root->setProperty("blockSize", options.blockSize);
+        root->setProperty("wallSeconds", batchSeconds);
+        root->setProperty("audioSeconds", totalAudioSeconds);
+        root->setProperty("files", files);
+
+        if (!options.reportFile.replaceWithText(juce::JSON::toString(juce::var(root))))
+            std::cerr << "Could not write " << options.reportFile.getFullPathName() << "\n";
+    }
+
+    return numFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include <memory>
+#include <vector>
+
+//==============================================================================
+// One chain of hosted plugins (e.g. TapeAge -> NBS_DynaDrive -> Chaosverb).
+//
+// Every stage processes the same AudioBuffer in place, so nothing is copied
+// between stages. Each worker thread owns one RenderChain. Instances are created
+// and configured on the main (message) thread, then only prepared and processed
+// on their worker.
+//==============================================================================
+namespace render
+{
+
+struct StageSpec
+{
+    juce::String plugin;           // name ("Chaosverb") or path to a .vst3 / .component
+    juce::File stateFile;          // .vstpreset, or a blob written by --save-states
+    juce::NamedValueSet parameters; // parameter ID -> normalised value (number) or display text (string)
+};
+
+class RenderChain
+{
+public:
+    // Returns an empty string on success, otherwise what went wrong
+    juce::String create(juce::AudioPluginFormatManager& formats,
+                        const juce::Array<juce::PluginDescription>& descriptions,
+                        const std::vector<StageSpec>& specs,
+                        double initialSampleRate, int blockSize)
+    {
+        maxBlockSize = blockSize;
+
+        for (size_t index = 0; index < specs.size(); ++index)
+        {
+            juce::String error;
+            auto instance = formats.createPluginInstance(descriptions.getReference(static_cast<int>(index)),
+                                                         initialSampleRate, blockSize, error);
+            if (instance == nullptr)
+                return specs[index].plugin + ": " + error;
+
+            if (!applyLayout(*instance))
+                return specs[index].plugin + ": no mono or stereo bus layout";
+
+            auto stateError = applyState(*instance, specs[index]);
+            if (stateError.isNotEmpty())
+                return specs[index].plugin + ": " + stateError;
+
+            stages.push_back(std::move(instance));
+        }
+
+        numChannels = 1;
+        for (auto& stage : stages)
+            numChannels = juce::jmax(numChannels, stage->getTotalNumInputChannels(), stage->getTotalNumOutputChannels());
+
+        buffer.setSize(numChannels, maxBlockSize);
+        return {};
+    }
+
+    int getNumChannels() const noexcept { return numChannels; }
+
+    int getNumOutputChannels() const
+    {
+        return stages.empty() ? numChannels : juce::jmax(1, stages.back()->getTotalNumOutputChannels());
+    }
+
+    // Sum of the stages' reported latencies (trimmed from the start of each render)
+    int getLatencySamples() const
+    {
+        int latency = 0;
+        for (auto& stage : stages)
+            latency += stage->getLatencySamples();
+        return latency;
+    }
+
+    double getTailLengthSeconds() const
+    {
+        double tail = 0.0;
+        for (auto& stage : stages)
+            tail += stage->getTailLengthSeconds();
+        return tail;
+    }
+
+    // Called before every file so tails and smoothers from the previous file never leak
+    void prepare(double sampleRate)
+    {
+        for (auto& stage : stages)
+        {
+            stage->releaseResources();
+            stage->setNonRealtime(true);
+            stage->setRateAndBufferSizeDetails(sampleRate, maxBlockSize);
+            stage->prepareToPlay(sampleRate, maxBlockSize);
+        }
+    }
+
+    void release()
+    {
+        for (auto& stage : stages)
+            stage->releaseResources();
+    }
+
+    // The block to fill before process(); numSamples <= the block size passed to create()
+    juce::AudioBuffer<float> getBlock(int numSamples)
+    {
+        return juce::AudioBuffer<float>(buffer.getArrayOfWritePointers(), numChannels, numSamples);
+    }
+
+    void process(juce::AudioBuffer<float>& block)
+    {
+        for (auto& stage : stages)
+        {
+            midi.clear();
+
+            // A stage with fewer outputs than the buffer leaves the extra channels
+            // holding its input. Clear them so they don't reach the next stage.
+            stage->processBlock(block, midi);
+
+            for (int channel = stage->getTotalNumOutputChannels(); channel < numChannels; ++channel)
+                block.clear(channel, 0, block.getNumSamples());
+        }
+    }
+
+    bool saveStates(const juce::File& directory) const
+    {
+        bool ok = directory.createDirectory().wasOk();
+
+        for (size_t index = 0; index < stages.size(); ++index)
+        {
+            juce::MemoryBlock state;
+            stages[index]->getStateInformation(state);
+
+            const auto name = juce::File::createLegalFileName(juce::String(static_cast<int>(index) + 1) + "-"
+                                                              + stages[index]->getName() + ".state");
+            ok = directory.getChildFile(name).replaceWithData(state.getData(), state.getSize()) && ok;
+        }
+
+        return ok;
+    }
+
+private:
+    static bool applyLayout(juce::AudioPluginInstance& instance)
+    {
+        for (const auto& set : { juce::AudioChannelSet::stereo(), juce::AudioChannelSet::mono() })
+        {
+            auto layout = instance.getBusesLayout();
+
+            if (layout.inputBuses.size() > 0)
+                layout.inputBuses.getReference(0) = set;
+            if (layout.outputBuses.size() > 0)
+                layout.outputBuses.getReference(0) = set;
+
+            // Sidechains and aux buses stay disabled
+            for (int bus = 1; bus < layout.inputBuses.size(); ++bus)
+                layout.inputBuses.getReference(bus) = juce::AudioChannelSet::disabled();
+            for (int bus = 1; bus < layout.outputBuses.size(); ++bus)
+                layout.outputBuses.getReference(bus) = juce::AudioChannelSet::disabled();
+
+            if (instance.setBusesLayout(layout))
+                return true;
+        }
+
+        return false;
+    }
+
+    static juce::String applyState(juce::AudioPluginInstance& instance, const StageSpec& spec)
+    {
+        if (spec.stateFile != juce::File())
+        {
+            juce::MemoryBlock data;
+            if (!spec.stateFile.loadFileAsData(data))
+                return "could not read " + spec.stateFile.getFullPathName();
+
+            if (spec.stateFile.hasFileExtension("vstpreset"))
+            {
+               #if JUCE_PLUGINHOST_VST3
+                if (!juce::VST3PluginFormat::setStateFromVSTPresetFile(&instance, data, true))
+                    return "could not load " + spec.stateFile.getFileName();
+               #else
+                return ".vstpreset needs a VST3 host build";
+               #endif
+            }
+            else
+            {
+                instance.setStateInformation(data.getData(), static_cast<int>(data.getSize()));
+            }
+        }
+
+        // Parameters override the state blob
+        for (const auto& entry : spec.parameters)
+        {
+            auto* parameter = findParameter(instance, entry.name.toString());
+            if (parameter == nullptr)
+                return "no parameter '" + entry.name.toString() + "'";
+
+            const float normalised = entry.value.isString() ? parameter->getValueForText(entry.value.toString())
+                                                            : static_cast<float>(entry.value);
+            parameter->setValueNotifyingHost(juce::jlimit(0.0f, 1.0f, normalised));
+        }
+
+        return {};
+    }
+
+    static juce::AudioProcessorParameter* findParameter(juce::AudioPluginInstance& instance, const juce::String& id)
+    {
+        for (auto* parameter : instance.getParameters())
+        {
+            if (auto* hosted = dynamic_cast<juce::HostedAudioProcessorParameter*>(parameter))
+                if (hosted->getParameterID() == id)
+                    return parameter;
+
+            if (parameter->getName(256).equalsIgnoreCase(id))
+                return parameter;
+        }
+
+        return nullptr;
+    }
+
+    std::vector<std::unique_ptr<juce::AudioPluginInstance>> stages;
+    juce::AudioBuffer<float> buffer;
+    juce::MidiBuffer midi;
+    int numChannels = 2;
+    int maxBlockSize = 1024;
+};
+
+} // namespace render